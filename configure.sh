@@ -49,6 +49,7 @@ The following flags enable optional features (disable with --no-<option name>).
   --muzzle                 complete silence (no non-result output)
   --coverage               support for gcov coverage testing
   --profiling              support for gprof profiling
+  --parallel-bab           worker threads for --parallel-bab
   --unit-testing           support for unit testing
   --python-bindings        build Python bindings based on new C++ API
   --python-only-src        create only Python bindings source files
@@ -138,6 +139,7 @@ cocoa=default
 muzzle=default
 ninja=default
 profiling=default
+parallel_bab=default
 python_bindings=default
 python_only_src=default
 pyvenv=default
@@ -314,6 +316,9 @@ do
     --profiling) profiling=ON;;
     --no-profiling) profiling=OFF;;
 
+    --parallel-bab) parallel_bab=ON;;
+    --no-parallel-bab) parallel_bab=OFF;;
+
     --editline) editline=ON;;
     --no-editline) editline=OFF;;
 
@@ -425,6 +430,8 @@ fi
   && cmake_opts="$cmake_opts -DENABLE_VALGRIND=$valgrind"
 [ $profiling != default ] \
   && cmake_opts="$cmake_opts -DENABLE_PROFILING=$profiling"
+[ $parallel_bab != default ] \
+  && cmake_opts="$cmake_opts -DENABLE_PARALLEL_BAB=$parallel_bab"
 [ $editline != default ] \
   && cmake_opts="$cmake_opts -DUSE_EDITLINE=$editline"
 [ $cln != default ] \
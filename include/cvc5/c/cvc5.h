@@ -4533,6 +4533,26 @@ CVC5_EXPORT const Cvc5Term* cvc5_get_learned_literals(Cvc5* cvc5,
                                                       Cvc5LearnedLitType type,
                                                       size_t* size);
 
+/**
+ * Get a list of clauses learned by the SAT solver that are entailed by the
+ * current set of assertions.
+ *
+ * The returned clauses are given in terms of the symbols of the input, and
+ * only clauses whose size is at most the value of option
+ * `learned-clauses-max-size` are returned.
+ *
+ * @warning This function is experimental and may change in future versions.
+ *
+ * @param cvc5 The solver instance.
+ * @param size The size of the resulting list of clauses.
+ * @return A list of clauses learned during the last satisfiability checks in
+ *         the current context.
+ *
+ * @note The resulting Cvc5Term array pointer is only valid until the next call
+ *       to this function.
+ */
+CVC5_EXPORT const Cvc5Term* cvc5_get_learned_clauses(Cvc5* cvc5, size_t* size);
+
 /**
  * Get the value of the given term in the current model.
  *
@@ -6134,6 +6134,24 @@ class CVC5_EXPORT Solver
   std::vector<Term> getLearnedLiterals(
       modes::LearnedLitType t = modes::LearnedLitType::INPUT) const;
 
+  /**
+   * Get a list of clauses learned by the SAT solver that are entailed by the
+   * current set of assertions.
+   *
+   * The returned clauses are given in terms of the symbols of the input, and
+   * only clauses whose size is at most the value of option
+   * `learned-clauses-max-size` are returned. They may be given to another
+   * solver instance (that shares the term manager of this solver) via
+   * Solver::assertFormula() to avoid relearning them in a closely related
+   * query.
+   *
+   * @warning This function is experimental and may change in future versions.
+   *
+   * @return A list of clauses learned during the last satisfiability checks
+   * in the current context.
+   */
+  std::vector<Term> getLearnedClauses() const;
+
   /**
    * Get the value of the given term in the current model.
    *
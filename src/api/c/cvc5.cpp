@@ -5134,6 +5134,23 @@ const Cvc5Term* cvc5_get_learned_literals(Cvc5* cvc5,
   return res.data();
 }
 
+const Cvc5Term* cvc5_get_learned_clauses(Cvc5* cvc5, size_t* size)
+{
+  static thread_local std::vector<Cvc5Term> res;
+  CVC5_CAPI_TRY_CATCH_BEGIN;
+  CVC5_CAPI_CHECK_NOT_NULL(cvc5);
+  CVC5_CAPI_CHECK_NOT_NULL(size);
+  res.clear();
+  auto cls = cvc5->d_solver.getLearnedClauses();
+  for (const auto& t : cls)
+  {
+    res.push_back(cvc5->d_tm->export_term(t));
+  }
+  *size = res.size();
+  CVC5_CAPI_TRY_CATCH_END;
+  return res.data();
+}
+
 Cvc5Term cvc5_get_value(Cvc5* cvc5, Cvc5Term term)
 {
   Cvc5Term res = nullptr;
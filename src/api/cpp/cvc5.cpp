@@ -8039,6 +8039,26 @@ std::vector<Term> Solver::getLearnedLiterals(modes::LearnedLitType t) const
   CVC5_API_TRY_CATCH_END;
 }
 
+std::vector<Term> Solver::getLearnedClauses() const
+{
+  CVC5_API_TRY_CATCH_BEGIN;
+  CVC5_API_CHECK(d_slv->getOptions().smt.produceLearnedClauses)
+      << "cannot get learned clauses unless enabled (try "
+         "--"
+      << internal::options::smt::longName::produceLearnedClauses << ")";
+  CVC5_API_RECOVERABLE_CHECK(d_slv->getSmtMode() == internal::SmtMode::UNSAT
+                             || d_slv->getSmtMode() == internal::SmtMode::SAT
+                             || d_slv->getSmtMode()
+                                    == internal::SmtMode::SAT_UNKNOWN)
+      << "cannot get learned clauses unless after a UNSAT, SAT or UNKNOWN "
+         "response.";
+  //////// all checks before this line
+  std::vector<internal::Node> cls = d_slv->getLearnedClauses();
+  return Term::nodeVectorToTerms(&d_tm, cls);
+  ////////
+  CVC5_API_TRY_CATCH_END;
+}
+
 Term Solver::getValueHelper(const Term& term) const
 {
   // Note: Term is checked in the caller to avoid double checks
@@ -2444,6 +2444,26 @@ public class Solver extends AbstractPointer
 
   private native long[] getLearnedLiterals(long pointer, int type);
 
+  /**
+   * Get a list of clauses learned by the SAT solver that are entailed by the
+   * current set of assertions.
+   *
+   * The returned clauses are given in terms of the symbols of the input, and
+   * only clauses whose size is at most the value of option
+   * {@code learned-clauses-max-size} are returned.
+   *
+   * @api.note This method is experimental and may change in future versions.
+   *
+   * @return The list of learned clauses.
+   */
+  public Term[] getLearnedClauses()
+  {
+    long[] retPointers = getLearnedClauses(pointer);
+    return Utils.getTerms(retPointers);
+  }
+
+  private native long[] getLearnedClauses(long pointer);
+
   /**
    * Get the list of asserted formulas.
    *
@@ -449,6 +449,7 @@ cdef extern from "<cvc5/cvc5.h>" namespace "cvc5":
         vector[Proof] getProof(ProofComponent c) except +
         string proofToString(Proof proof, ProofFormat format, const map[Term, string]& assertionNames) except +
         vector[Term] getLearnedLiterals(LearnedLitType type) except +
+        vector[Term] getLearnedClauses() except +
         vector[Term] getAssertions() except +
         string getInfo(const string& flag) except +
         string getOption(const string& option) except +
@@ -3655,6 +3655,25 @@ cdef class Solver:
             lits.append(_term(self.tm, a))
         return lits
 
+    def getLearnedClauses(self):
+        """
+            Get a list of clauses learned by the SAT solver that are entailed
+            by the current set of assertions.
+
+            The returned clauses are given in terms of the symbols of the
+            input, and only clauses whose size is at most the value of option
+            ``learned-clauses-max-size`` are returned.
+
+            .. warning:: This function is experimental and may change in future
+                         versions.
+
+            :return: The list of learned clauses.
+        """
+        cls = []
+        for a in self.csolver.getLearnedClauses():
+            cls.append(_term(self.tm, a))
+        return cls
+
     def getAssertions(self):
         """
             Get the list of asserted formulas.
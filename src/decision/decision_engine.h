@@ -59,6 +59,19 @@ class DecisionEngine : protected EnvObj
    * @param lems The lemmas to add.
    */
   virtual void addLocalAssertions(const std::vector<TNode>& lems) {}
+  /**
+   * Notify that lem was added as a lemma, which includes theory conflicts.
+   * @param lem The lemma.
+   */
+  virtual void notifyLemma(TNode lem) {}
+  /**
+   * Notify that the theory literal lit was asserted by the SAT solver. This
+   * is only called if needsAssertedNotify() returns true.
+   * @param lit The asserted literal.
+   */
+  virtual void notifyAsserted(TNode lit) {}
+  /** Does this engine need to be notified of asserted literals? */
+  virtual bool needsAssertedNotify() const { return false; }
 
  protected:
   /** Get next internal, the engine-specific implementation of getNext */
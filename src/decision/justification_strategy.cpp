@@ -15,6 +15,8 @@
 
 #include "decision/justification_strategy.h"
 
+#include <unordered_set>
+
 #include "expr/node_algorithm.h"
 #include "prop/skolem_def_manager.h"
 
@@ -24,6 +26,15 @@ using namespace cvc5::internal::prop;
 namespace cvc5::internal {
 namespace decision {
 
+namespace {
+
+/** Decay factor of the activity of theory atoms */
+const double s_activityDecay = 0.95;
+/** Activity above which all activities are rescaled */
+const double s_activityLimit = 1e100;
+
+}  // namespace
+
 JustificationStrategy::JustificationStrategy(Env& env,
                                              prop::CDCLTSatSolver* ss,
                                              prop::CnfStream* cs)
@@ -39,9 +50,12 @@ JustificationStrategy::JustificationStrategy(Env& env,
       d_stack(context()),
       d_lastDecisionLit(context()),
       d_currStatusDec(false),
+      d_activityInc(1.0),
       d_useRlvOrder(options().decision.jhRlvOrder),
       d_decisionStopOnly(options().decision.decisionMode
                          == options::DecisionMode::STOPONLY),
+      d_useActivity(options().decision.decisionMode
+                    == options::DecisionMode::JUSTIFICATION_ACTIVITY),
       d_jhSkMode(options().decision.jhSkolemMode),
       d_jhSkRlvMode(options().decision.jhSkolemRlvMode),
       d_stats(statisticsRegistry())
@@ -240,8 +254,9 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
   // NOTE: if i>0, we just computed the value of the (i-1)^th child
   // i.e. i == 0 || lastChildVal != SAT_VALUE_UNKNOWN,
   // however this does not hold when backtracking has occurred.
-  // if i=0, we shouldn't have a last child value
-  Assert(i > 0 || lastChildVal == SAT_VALUE_UNKNOWN)
+  // if i=0, we shouldn't have a last child value, unless we just processed a
+  // child preferred by getPreferredChild
+  Assert(i > 0 || lastChildVal == SAT_VALUE_UNKNOWN || d_useActivity)
       << "in getNextJustifyNode, value given for non-existent last child";
   // we are trying to make the value of curr equal to currDesiredVal
   SatValue currDesiredVal = currPol ? jc.second : invertValue(jc.second);
@@ -273,6 +288,20 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
           // NOTE: if v == SAT_VALUE_UNKNOWN, then we can add this to a watch
           // list and short circuit processing in the children of this node.
         }
+        if (value == SAT_VALUE_UNKNOWN && d_useActivity)
+        {
+          size_t pi = getPreferredChild(curr, currDesiredVal);
+          if (pi != 0)
+          {
+            // Try the preferred child first. We revert the child index so
+            // that we scan again from the first child when the preferred
+            // child has been assigned, which terminates since we only prefer
+            // unassigned children.
+            ++(d_stats.d_numActivityChoices);
+            ji->revertChildIndex();
+            i = pi;
+          }
+        }
       }
       desiredVal = currDesiredVal;
     }
@@ -338,13 +367,21 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
       }
       // if first branch is already wrong or second branch is already correct,
       // try to make condition false. Note that we arbitrarily choose true here
-      // if both children are unknown. If both children have the same value
-      // and that value is not unknown, desiredVal will be ignored, since
-      // value is set above.
-      desiredVal =
-          (val1 == invertValue(currDesiredVal) || val2 == currDesiredVal)
-              ? SAT_VALUE_FALSE
-              : SAT_VALUE_TRUE;
+      // (or the saved phase) if both children are unknown. If both children
+      // have the same value and that value is not unknown, desiredVal will be
+      // ignored, since value is set above.
+      if (val1 == invertValue(currDesiredVal) || val2 == currDesiredVal)
+      {
+        desiredVal = SAT_VALUE_FALSE;
+      }
+      else if (val1 == SAT_VALUE_UNKNOWN && val2 == SAT_VALUE_UNKNOWN)
+      {
+        desiredVal = getPhaseValue(curr[0], SAT_VALUE_TRUE);
+      }
+      else
+      {
+        desiredVal = SAT_VALUE_TRUE;
+      }
     }
     else if (i == 1)
     {
@@ -374,8 +411,8 @@ JustifyNode JustificationStrategy::getNextJustifyNode(
       SatValue val1 = d_jcache.lookupValue(curr[1]);
       if (val1 == SAT_VALUE_UNKNOWN)
       {
-        // not forced, arbitrarily choose true
-        desiredVal = SAT_VALUE_TRUE;
+        // not forced, arbitrarily choose true (or the saved phase)
+        desiredVal = getPhaseValue(curr[0], SAT_VALUE_TRUE);
       }
       else
       {
@@ -589,5 +626,108 @@ bool JustificationStrategy::isTheoryLiteral(TNode n)
   return expr::isTheoryAtom(n.getKind() == Kind::NOT ? n[0] : n);
 }
 
+void JustificationStrategy::notifyLemma(TNode lem)
+{
+  if (!d_useActivity)
+  {
+    return;
+  }
+  Trace("jh-activity") << "bump atoms of " << lem << std::endl;
+  std::unordered_set<TNode> visited;
+  std::vector<TNode> visit;
+  visit.push_back(lem);
+  TNode cur;
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    if (expr::isTheoryAtom(cur))
+    {
+      double& act = d_activity[cur];
+      act += d_activityInc;
+      if (act > s_activityLimit)
+      {
+        // rescale all activities
+        for (std::pair<const Node, double>& a : d_activity)
+        {
+          a.second /= s_activityLimit;
+        }
+        d_activityInc /= s_activityLimit;
+      }
+      continue;
+    }
+    visit.insert(visit.end(), cur.begin(), cur.end());
+  } while (!visit.empty());
+  // decay by increasing the amount for future bumps
+  d_activityInc /= s_activityDecay;
+}
+
+void JustificationStrategy::notifyAsserted(TNode lit)
+{
+  bool pol = lit.getKind() != Kind::NOT;
+  d_phase[pol ? lit : lit[0]] = pol;
+}
+
+bool JustificationStrategy::needsAssertedNotify() const
+{
+  return d_useActivity;
+}
+
+size_t JustificationStrategy::getPreferredChild(TNode curr,
+                                                SatValue desiredVal)
+{
+  size_t best = 0;
+  double bestAct = 0;
+  bool bestPhase = false;
+  for (size_t i = 0, nchild = curr.getNumChildren(); i < nchild; i++)
+  {
+    TNode c = curr[i];
+    if (!isTheoryLiteral(c) || d_jcache.lookupValue(c) != SAT_VALUE_UNKNOWN)
+    {
+      continue;
+    }
+    bool pol = c.getKind() != Kind::NOT;
+    TNode atom = pol ? c : c[0];
+    double act = getActivity(atom);
+    std::unordered_map<Node, bool>::const_iterator it = d_phase.find(atom);
+    bool phase = it != d_phase.end()
+                 && ((it->second == pol) == (desiredVal == SAT_VALUE_TRUE));
+    if (act > bestAct || (act == bestAct && phase && !bestPhase))
+    {
+      best = i;
+      bestAct = act;
+      bestPhase = phase;
+    }
+  }
+  return best;
+}
+
+SatValue JustificationStrategy::getPhaseValue(TNode c, SatValue dflt)
+{
+  if (!d_useActivity || !isTheoryLiteral(c))
+  {
+    return dflt;
+  }
+  bool pol = c.getKind() != Kind::NOT;
+  std::unordered_map<Node, bool>::const_iterator it =
+      d_phase.find(pol ? c : c[0]);
+  if (it == d_phase.end())
+  {
+    return dflt;
+  }
+  ++(d_stats.d_numSavedPhases);
+  return it->second == pol ? SAT_VALUE_TRUE : SAT_VALUE_FALSE;
+}
+
+double JustificationStrategy::getActivity(TNode a) const
+{
+  std::unordered_map<Node, double>::const_iterator it = d_activity.find(a);
+  return it == d_activity.end() ? 0 : it->second;
+}
+
 }  // namespace decision
 }  // namespace cvc5::internal
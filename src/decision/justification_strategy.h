@@ -18,6 +18,8 @@
 #ifndef CVC5__DECISION__JUSTIFICATION_STRATEGY_H
 #define CVC5__DECISION__JUSTIFICATION_STRATEGY_H
 
+#include <unordered_map>
+
 #include "context/cdinsert_hashmap.h"
 #include "context/cdo.h"
 #include "decision/assertion_list.h"
@@ -113,6 +115,16 @@ namespace decision {
  * then (ite A (= k 1) (= k 2)) would not be added as a relevant skolem
  * definition, and Q alone would have sufficed to show the input formula
  * was satisfied.
+ *
+ * In decision mode justification-activity, this class additionally maintains
+ * a VSIDS-like activity for theory atoms, which is bumped for the atoms of
+ * each lemma (including theory conflicts), and the phase that each theory
+ * atom was last asserted with, which is kept across check-sat calls. When
+ * satisfying a disjunction (or a negated conjunction), the unassigned theory
+ * literal child with the highest activity is tried first, preferring
+ * children whose saved phase satisfies the disjunction. When the desired
+ * value of a child is arbitrary, e.g. for the condition of an ITE whose
+ * branches are both unassigned, its saved phase is used.
  */
 class JustificationStrategy : public DecisionEngine
 {
@@ -157,6 +169,12 @@ class JustificationStrategy : public DecisionEngine
    * @param lems The lemmas to add.
    */
   void addLocalAssertions(const std::vector<TNode>& lems) override;
+  /** Bumps the activity of the theory atoms of lem, if using activity. */
+  void notifyLemma(TNode lem) override;
+  /** Saves the phase of the atom of lit. */
+  void notifyAsserted(TNode lit) override;
+  /** Returns true if using activity. */
+  bool needsAssertedNotify() const override;
 
  private:
   /**
@@ -204,6 +222,24 @@ class JustificationStrategy : public DecisionEngine
   JustifyNode getNextJustifyNode(JustifyInfo* ji, prop::SatValue& lastChildVal);
   /** Is n a theory literal? */
   static bool isTheoryLiteral(TNode n);
+  //------------------------------------ theory activity
+  /**
+   * Get the index of the child of curr to satisfy first, where curr is a
+   * disjunction (or a negated conjunction) for which it suffices to make a
+   * single child have value desiredVal. This is the index of an unassigned
+   * theory literal child with the highest activity, where ties are broken
+   * in favor of children whose saved phase gives them value desiredVal.
+   * Returns 0 if no child is preferred over the first one.
+   */
+  size_t getPreferredChild(TNode curr, prop::SatValue desiredVal);
+  /**
+   * Get the desired value for child c, whose desired value is arbitrary.
+   * Returns the value of c under the saved phase if c is a theory literal
+   * with a saved phase, and dflt otherwise.
+   */
+  prop::SatValue getPhaseValue(TNode c, prop::SatValue dflt);
+  /** Get the activity of theory atom a */
+  double getActivity(TNode a) const;
   /** The assertions, which are user-context dependent. */
   AssertionList d_assertions;
   /** The local assertions, which are SAT-context depdendent */
@@ -220,11 +256,20 @@ class JustificationStrategy : public DecisionEngine
   Node d_currUnderStatus;
   /** Whether we have added a decision while considering d_currUnderStatus */
   bool d_currStatusDec;
+  //------------------------------------ theory activity
+  /** Activity of theory atoms, which is context-independent */
+  std::unordered_map<Node, double> d_activity;
+  /** The amount by which to bump activity */
+  double d_activityInc;
+  /** The phase each theory atom was last asserted with */
+  std::unordered_map<Node, bool> d_phase;
   //------------------------------------ options
   /** using relevancy order */
   bool d_useRlvOrder;
   /** using stop only */
   bool d_decisionStopOnly;
+  /** using theory activity and phase saving */
+  bool d_useActivity;
   /** skolem mode */
   options::JutificationSkolemMode d_jhSkMode;
   /** skolem relevancy mode */
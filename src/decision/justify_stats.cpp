@@ -25,7 +25,10 @@ JustifyStatistics::JustifyStatistics(StatisticsRegistry& sr)
       d_numStatusBacktrack(sr.registerInt("JustifyStrategy::StatusBacktrack")),
       d_maxStackSize(sr.registerInt("JustifyStrategy::MaxStackSize")),
       d_maxAssertionsSize(sr.registerInt("JustifyStrategy::MaxAssertionsSize")),
-      d_maxSkolemDefsSize(sr.registerInt("JustifyStrategy::MaxSkolemDefsSize"))
+      d_maxSkolemDefsSize(sr.registerInt("JustifyStrategy::MaxSkolemDefsSize")),
+      d_numActivityChoices(
+          sr.registerInt("JustifyStrategy::ActivityChoices")),
+      d_numSavedPhases(sr.registerInt("JustifyStrategy::SavedPhases"))
 {
 }
 
@@ -40,6 +40,10 @@ class JustifyStatistics
   IntStat d_maxAssertionsSize;
   /** Maximum skolem definition size we considered */
   IntStat d_maxSkolemDefsSize;
+  /** Number of times we chose a child of a disjunction based on activity */
+  IntStat d_numActivityChoices;
+  /** Number of times we used a saved phase for an arbitrary value */
+  IntStat d_numSavedPhases;
 };
 
 }
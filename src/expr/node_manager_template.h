@@ -116,6 +116,8 @@ class NodeManager
   SkolemManager* getSkolemManager() { return d_skManager.get(); }
   /** Get this node manager's bound variable manager */
   BoundVarManager* getBoundVarManager() { return d_bvManager.get(); }
+  /** Get the number of nodes created by this node manager so far */
+  size_t getNumNodesCreated() const { return d_nextId; }
 
   /**
    * Return the datatype at the given index owned by this class. Type nodes are
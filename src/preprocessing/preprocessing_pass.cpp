@@ -19,6 +19,7 @@
 #include "preprocessing/preprocessing_pass_context.h"
 #include "printer/printer.h"
 #include "smt/env.h"
+#include "smt/profiler.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5::internal {
@@ -27,6 +28,7 @@ namespace preprocessing {
 PreprocessingPassResult PreprocessingPass::apply(
     AssertionPipeline* assertionsToPreprocess) {
   TimerStat::CodeTimer codeTimer(d_timer);
+  Profiler::Scope profilerScope(profiler(), d_name);
   Trace("preprocessing") << "PRE " << d_name << std::endl;
   verbose(2) << d_name << "..." << std::endl;
   PreprocessingPassResult result = applyInternal(assertionsToPreprocess);
@@ -18,12 +18,16 @@
 #include "prop/cadical.h"
 
 #include <deque>
+#include <unordered_set>
 
 #include "base/check.h"
 #include "options/base_options.h"
 #include "options/main_options.h"
 #include "options/proof_options.h"
+#include "options/prop_options.h"
+#include "prop/sat_stats_sampler.h"
 #include "prop/theory_proxy.h"
+#include "prop/xor_propagator.h"
 #include "util/resource_manager.h"
 #include "util/statistics_registry.h"
 #include "util/string.h"
@@ -76,10 +80,16 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
   CadicalPropagator(prop::TheoryProxy* proxy,
                     context::Context* context,
                     CaDiCaL::Solver& solver,
-                    StatisticsRegistry& stats)
+                    StatisticsRegistry& stats,
+                    bool nativeXor,
+                    size_t maxXorComponent)
       : d_proxy(proxy), d_context(*context), d_solver(solver), d_stats(stats)
   {
     d_var_info.emplace_back();  // 0: Not used
+    if (nativeXor)
+    {
+      d_xor.reset(new XorPropagator(stats, maxXorComponent));
+    }
   }
 
   /**
@@ -121,6 +131,7 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
       {
         continue;
       }
+      ++d_num_assignments;
 
       bool is_decision = d_solver.is_decision(lit);
 
@@ -144,6 +155,10 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
       {
         info.assignment = lit;
         d_assignments.push_back(slit);
+        if (d_xor)
+        {
+          d_xor->assign(slit);
+        }
         if (info.is_theory_atom)
         {
           Trace("cadical::propagator") << "enqueue: " << slit << std::endl;
@@ -205,6 +220,7 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     d_context.push();
     d_assignment_control.push_back(d_assignments.size());
     d_decisions.emplace_back();
+    ++d_num_decisions;
     Trace("cadical::propagator")
         << "notif::decision: new level " << d_decisions.size() << std::endl;
     ++d_stats.notifyNewDecision;
@@ -255,12 +271,22 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
       auto& info = d_var_info[var];
       Trace("cadical::propagator") << "unassign: " << var << std::endl;
       info.assignment = 0;
+      if (d_xor)
+      {
+        d_xor->unassign(var);
+        d_xor_propagated.erase(var);
+      }
     }
 
     // Notify theory proxy about backtrack
     d_proxy->notifyBacktrack();
     // Clear the propgations since they are not valid anymore.
     d_propagations.clear();
+    if (d_xor)
+    {
+      d_xor->notifyBacktrack();
+      d_xor_propagations.clear();
+    }
     ++d_stats.notifyBacktrack;
 
     Trace("cadical::propagator") << "notif::backtrack end" << std::endl;
@@ -280,6 +306,14 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     Trace("cadical::propagator") << "cb::check_found_model" << std::endl;
     bool recheck = false;
 
+    // XOR constraints are not known to the SAT solver. If the search was
+    // stopped early, assignments are not propagated through them and we have
+    // to check them on the full model.
+    if (d_xor && !model.empty() && !check_xor_model(model))
+    {
+      return false;
+    }
+
     if (d_found_solution)
     {
       return true;
@@ -457,6 +491,15 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     }
     ++d_stats.cbPropagate;
     Trace("cadical::propagator") << "cb::propagate" << std::endl;
+    // XOR propagations are cheap, we process them before the theory check.
+    if (d_xor && d_decisions.size() >= current_user_level())
+    {
+      int lit = xor_propagate();
+      if (lit != 0 || !d_new_clauses.empty())
+      {
+        return lit;
+      }
+    }
     if (d_propagations.empty())
     {
       // Only propagate if all activation literals are processed. Activation
@@ -489,7 +532,15 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
       Assert(d_reason.empty());
       SatLiteral slit = toSatLiteral(propagated_lit);
       SatClause clause;
-      d_proxy->explainPropagation(slit, clause);
+      if (d_xor && d_xor_propagated.find(slit.getSatVariable())
+                       != d_xor_propagated.end())
+      {
+        d_xor->explain(slit, clause);
+      }
+      else
+      {
+        d_proxy->explainPropagation(slit, clause);
+      }
       // Add activation literal to reason
       SatLiteral alit = current_activation_lit();
       if (alit != undefSatLiteral)
@@ -665,6 +716,51 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     info.is_theory_atom = is_theory_atom;
   }
 
+  /**
+   * Add XOR constraint clause[0] ^ ... ^ clause[n-1] = rhs in the current user
+   * level.
+   * @return False if the constraint is inconsistent with the XOR constraints
+   *         of the current user level.
+   */
+  bool add_xor(const SatClause& clause, bool rhs)
+  {
+    Assert(d_xor);
+    bool res = d_xor->addXor(clause, rhs, current_user_level());
+    // Notify current assignments of variables that were not XOR variables.
+    for (const SatLiteral& lit : clause)
+    {
+      int32_t assign = d_var_info[lit.getSatVariable()].assignment;
+      if (assign != 0)
+      {
+        d_xor->assign(toSatLiteral(assign));
+      }
+    }
+    return res;
+  }
+
+  /**
+   * Return true if the XOR constraint over clause can be added via add_xor()
+   * without exceeding the maximal size of an XOR component.
+   */
+  bool can_add_xor(const SatClause& clause) const
+  {
+    Assert(d_xor);
+    return d_xor->canAddXor(clause);
+  }
+
+  /** Return true if XOR constraints are handled by this propagator. */
+  bool has_xor() const { return d_xor != nullptr; }
+
+  /**
+   * Get the number of decisions and of assignments of active variables
+   * notified so far. Assignments include decisions.
+   */
+  void get_search_counters(SatSearchCounters& counters) const
+  {
+    counters.d_decisions = d_num_decisions;
+    counters.d_propagations = d_num_assignments;
+  }
+
   /**
    * Checks whether the theory engine is done, no new clauses need to be added
    * and the current model is consistent.
@@ -775,6 +871,12 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     // Re-add fixed active vars in the order they were added to d_active_vars.
     d_active_vars.insert(d_active_vars.end(), fixed.rbegin(), fixed.rend());
 
+    // Remove the XOR constraints of the popped user level.
+    if (d_xor)
+    {
+      d_xor->userPop(user_level);
+    }
+
     // We are at decicion level 0 at this point.
     Assert(d_decisions.empty());
     Assert(d_assignment_control.empty());
@@ -893,6 +995,69 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
     }
   }
 
+  /**
+   * Retrieve XOR propagations and return the next one. Queues the conflict
+   * clause if the XOR constraints are in conflict with the current
+   * assignment.
+   *
+   * @return The next XOR propagation, or 0 if there is none.
+   */
+  int xor_propagate()
+  {
+    std::vector<SatLiteral> props;
+    SatClause conflict;
+    if (!d_xor->propagate(props, conflict))
+    {
+      Trace("cadical::propagator") << "xor conflict: " << conflict << std::endl;
+      add_clause(conflict);
+    }
+    d_xor_propagations.insert(d_xor_propagations.end(), props.begin(), props.end());
+    while (!d_xor_propagations.empty())
+    {
+      SatLiteral next = d_xor_propagations.front();
+      d_xor_propagations.pop_front();
+      // may have been assigned in the meantime
+      if (value(next) == SAT_VALUE_TRUE)
+      {
+        continue;
+      }
+      d_xor_propagated.insert(next.getSatVariable());
+      Trace("cadical::propagator") << "propagate (xor): " << next << std::endl;
+      return toCadicalLit(next);
+    }
+    return 0;
+  }
+
+  /**
+   * Check the XOR constraints on a full model. Queues a clause excluding the
+   * model if it violates an XOR constraint.
+   *
+   * @param model The full assignment.
+   * @return True if the model satisfies all XOR constraints.
+   */
+  bool check_xor_model(const std::vector<int>& model)
+  {
+    std::vector<bool> values(d_var_info.size(), false);
+    for (int lit : model)
+    {
+      SatVariable var = std::abs(lit);
+      if (var < values.size())
+      {
+        values[var] = lit > 0;
+      }
+    }
+    SatClause conflict;
+    if (d_xor->check([&values](SatVariable var) { return values[var]; },
+                     conflict))
+    {
+      return true;
+    }
+    Trace("cadical::propagator")
+        << "xor constraint violated by model: " << conflict << std::endl;
+    add_clause(conflict);
+    return false;
+  }
+
   /**
    * Get next propagation.
    *
@@ -985,6 +1150,13 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
   /** Used by cb_propagate() to return propagated literals. */
   std::deque<SatLiteral> d_propagations;
 
+  /** The propagator for XOR constraints, if native XOR reasoning is used. */
+  std::unique_ptr<XorPropagator> d_xor;
+  /** Used by cb_propagate() to return literals propagated by d_xor. */
+  std::deque<SatLiteral> d_xor_propagations;
+  /** The currently assigned variables that were propagated by d_xor. */
+  std::unordered_set<SatVariable> d_xor_propagated;
+
   /**
    * Used by add_clause() to buffer added clauses, which will be added via
    * cb_add_reason_clause_lit().
@@ -1001,6 +1173,11 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
 
   bool d_found_solution = false;
 
+  /** Number of new decision levels notified by the SAT solver. */
+  uint64_t d_num_decisions = 0;
+  /** Number of notified assignments of active variables. */
+  uint64_t d_num_assignments = 0;
+
   /** Flag indicating if SAT solver is in search(). */
   bool d_in_search = false;
 
@@ -1049,8 +1226,11 @@ class CadicalPropagator : public CaDiCaL::ExternalPropagator,
 class ClauseLearner : public CaDiCaL::Learner
 {
  public:
-  ClauseLearner(TheoryProxy& proxy, int32_t clause_size)
-      : d_proxy(proxy), d_max_clause_size(clause_size)
+  ClauseLearner(TheoryProxy& proxy, int32_t clause_size, bool notify)
+      : d_proxy(proxy),
+        d_max_clause_size(clause_size),
+        d_notify(notify),
+        d_num_learned(0)
   {
   }
   ~ClauseLearner() override {}
@@ -1069,17 +1249,31 @@ class ClauseLearner : public CaDiCaL::Learner
     }
     else
     {
-      d_proxy.notifySatClause(d_clause);
+      ++d_num_learned;
+      if (d_notify)
+      {
+        d_proxy.notifySatClause(d_clause);
+      }
       d_clause.clear();
     }
   }
 
+  /**
+   * Number of clauses learned so far. Since every conflict produces a learned
+   * clause, this approximates the number of conflicts.
+   */
+  uint64_t num_learned() const { return d_num_learned; }
+
  private:
   TheoryProxy& d_proxy;
   /** Intermediate literals buffer. */
   std::vector<SatLiteral> d_clause;
   /** Maximum size of clauses to get notified about. */
   int32_t d_max_clause_size;
+  /** Whether to notify the theory proxy about learned clauses. */
+  bool d_notify;
+  /** Number of clauses learned so far. */
+  uint64_t d_num_learned;
 };
 
 CadicalSolver::CadicalSolver(Env& env,
@@ -1247,8 +1441,52 @@ ClauseId CadicalSolver::addXorClause(SatClause& clause,
                                      bool rhs,
                                      bool removable)
 {
-  Unreachable() << "CaDiCaL does not support adding XOR clauses.";
-  return 0;
+  if (!nativeXor())
+  {
+    Unreachable() << "CaDiCaL only supports adding XOR clauses in CDCL(T) "
+                     "mode with native XOR reasoning.";
+  }
+  Trace("cadical::propagator")
+      << "addXorClause: " << clause << " = " << rhs << std::endl;
+  ++d_statistics.d_numXorClauses;
+  if (!d_propagator->can_add_xor(clause))
+  {
+    // The component of the constraint would exceed the maximal size, encode
+    // it as the clauses excluding the assignments of the wrong parity. The
+    // XOR constraints of the CNF stream have at most three literals.
+    Assert(clause.size() <= 3);
+    ++d_statistics.d_numXorFallbacks;
+    size_t n = clause.size();
+    for (uint32_t mask = 0; mask < (uint32_t(1) << n); ++mask)
+    {
+      // mask assigns true to the literals of its bits
+      bool parity = false;
+      SatClause c;
+      for (size_t i = 0; i < n; ++i)
+      {
+        bool value = (mask >> i) & 1;
+        parity ^= value;
+        c.push_back(value ? ~clause[i] : clause[i]);
+      }
+      if (parity != rhs)
+      {
+        addClause(c, removable);
+      }
+    }
+    return ClauseIdError;
+  }
+  if (!d_propagator->add_xor(clause, rhs))
+  {
+    // inconsistent XOR constraints, add the empty clause for this user level
+    SatClause empty{SatLiteral(d_false)};
+    addClause(empty, removable);
+  }
+  return ClauseIdError;
+}
+
+bool CadicalSolver::nativeXor()
+{
+  return d_propagator && d_propagator->has_xor();
 }
 
 SatVariable CadicalSolver::newVar(bool isTheoryAtom, bool canErase)
@@ -1314,11 +1552,28 @@ uint32_t CadicalSolver::getAssertionLevel() const
 
 bool CadicalSolver::ok() const { return d_inSatMode; }
 
+bool CadicalSolver::getSearchCounters(SatSearchCounters& counters) const
+{
+  if (!d_propagator)
+  {
+    return false;
+  }
+  d_propagator->get_search_counters(counters);
+  if (d_clause_learner)
+  {
+    counters.d_conflicts = d_clause_learner->num_learned();
+  }
+  return true;
+}
+
 CadicalSolver::Statistics::Statistics(StatisticsRegistry& registry,
                                       const std::string& prefix)
     : d_numSatCalls(registry.registerInt(prefix + "cadical::calls_to_solve")),
       d_numVariables(registry.registerInt(prefix + "cadical::variables")),
       d_numClauses(registry.registerInt(prefix + "cadical::clauses")),
+      d_numXorClauses(registry.registerInt(prefix + "cadical::xor_clauses")),
+      d_numXorFallbacks(
+          registry.registerInt(prefix + "cadical::xor_clause_fallbacks")),
       d_solveTime(registry.registerTimer(prefix + "cadical::solve_time"))
   {
 }
@@ -1329,11 +1584,19 @@ void CadicalSolver::initialize(prop::TheoryProxy* theoryProxy,
                                PropPfManager* ppm)
 {
   d_proxy = theoryProxy;
-  d_propagator.reset(new CadicalPropagator(
-      theoryProxy, d_context, *d_solver, statisticsRegistry()));
-  if (!d_env.getPlugins().empty())
+  // Native XOR reasoning is not supported with proofs.
+  bool nativeXor = options().prop.satXor && !d_env.isSatProofProducing();
+  d_propagator.reset(new CadicalPropagator(theoryProxy,
+                                           d_context,
+                                           *d_solver,
+                                           statisticsRegistry(),
+                                           nativeXor,
+                                           options().prop.satXorMaxComponent));
+  bool hasPlugins = !d_env.getPlugins().empty();
+  // the learner is also used to count conflicts for the statistics sampler
+  if (hasPlugins || SatStatsSampler::isEnabled(options()))
   {
-    d_clause_learner.reset(new ClauseLearner(*theoryProxy, 0));
+    d_clause_learner.reset(new ClauseLearner(*theoryProxy, 0, hasPlugins));
     d_solver->connect_learner(d_clause_learner.get());
   }
 
@@ -45,6 +45,12 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
 
   ClauseId addXorClause(SatClause& clause, bool rhs, bool removable) override;
 
+  /**
+   * Returns true if XOR clauses are handled natively, i.e., in CDCL(T) mode
+   * with option --sat-xor.
+   */
+  bool nativeXor() override;
+
   SatVariable newVar(bool isTheoryAtom = false, bool canErase = true) override;
 
   SatVariable trueVar() override;
@@ -67,6 +73,8 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
 
   bool ok() const override;
 
+  bool getSearchCounters(SatSearchCounters& counters) const override;
+
   /* CDCLTSatSolver interface --------------------------------------------- */
 
   void initialize(prop::TheoryProxy* theoryProxy, PropPfManager* ppm) override;
@@ -154,6 +162,8 @@ class CadicalSolver : public CDCLTSatSolver, protected EnvObj
     IntStat d_numSatCalls;
     IntStat d_numVariables;
     IntStat d_numClauses;
+    IntStat d_numXorClauses;
+    IntStat d_numXorFallbacks;
     TimerStat d_solveTime;
     Statistics(StatisticsRegistry& registry, const std::string& prefix);
   };
@@ -49,6 +49,7 @@ CnfStream::CnfStream(Env& env,
       d_registrar(registrar),
       d_name(name),
       d_removable(false),
+      d_numClauses(0),
       d_stats(statisticsRegistry(), name)
 {
 }
@@ -56,6 +57,7 @@ CnfStream::CnfStream(Env& env,
 bool CnfStream::assertClause(TNode node, SatClause& c)
 {
   Trace("cnf") << "Inserting into stream " << c << " node = " << node << "\n";
+  ++d_numClauses;
 
   ClauseId clauseId = d_satSolver->addClause(c, d_removable);
 
@@ -316,6 +318,14 @@ void CnfStream::handleXor(TNode xorNode)
 
   SatLiteral xorLit = newLiteral(xorNode);
 
+  if (d_satSolver->nativeXor())
+  {
+    // xorLit <-> (a xor b) is the same as a xor b xor xorLit = false
+    SatClause clause{a, b, xorLit};
+    d_satSolver->addXorClause(clause, false, d_removable);
+    return;
+  }
+
   assertClause(xorNode.negate(), a, b, ~xorLit);
   assertClause(xorNode.negate(), ~a, ~b, ~xorLit);
   assertClause(xorNode, a, ~b, xorLit);
@@ -609,6 +619,13 @@ void CnfStream::convertAndAssertXor(TNode node, bool negated)
   Assert(node.getKind() == Kind::XOR);
   Trace("cnf") << "CnfStream::convertAndAssertXor(" << node
                << ", negated = " << (negated ? "true" : "false") << ")\n";
+  if (d_satSolver->nativeXor() && !d_removable)
+  {
+    // p XOR q = !negated
+    SatClause clause{toCNF(node[0], false), toCNF(node[1], false)};
+    d_satSolver->addXorClause(clause, !negated, d_removable);
+    return;
+  }
   if (!negated) {
     // p XOR q
     SatLiteral p = toCNF(node[0], false);
@@ -122,6 +122,9 @@ class CnfStream : protected EnvObj
    */
   bool hasLiteral(TNode node) const;
 
+  /** Returns the number of clauses asserted to the SAT solver so far. */
+  uint64_t getNumClauses() const { return d_numClauses; }
+
   /**
    * Ensure that the given node will have a designated SAT literal that is
    * definitionally equal to it.  The result of this function is that the Node
@@ -349,6 +352,9 @@ class CnfStream : protected EnvObj
    */
   bool d_removable;
 
+  /** The number of clauses asserted via assertClause so far */
+  uint64_t d_numClauses;
+
   /** Pointer to resource manager for associated SolverEngine */
   ResourceManager* d_resourceManager;
 
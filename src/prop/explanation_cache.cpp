@@ -0,0 +1,113 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache of explanations for theory propagations.
+ */
+
+#include "prop/explanation_cache.h"
+
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+ExplanationCache::ExplanationCache(Env& env, size_t limit)
+    : EnvObj(env),
+      d_stamps(context()),
+      d_nextStamp(0),
+      d_cache(userContext()),
+      d_limit(limit),
+      d_stats(statisticsRegistry())
+{
+}
+
+ExplanationCache::~ExplanationCache() {}
+
+void ExplanationCache::notifyAsserted(TNode lit) { setTimestamp(lit); }
+
+void ExplanationCache::notifyPropagated(TNode lit) { setTimestamp(lit); }
+
+void ExplanationCache::setTimestamp(TNode lit)
+{
+  // A literal that is propagated is asserted afterwards; we keep the
+  // earlier timestamp.
+  if (d_stamps.find(lit) == d_stamps.end())
+  {
+    d_stamps.insert(lit, d_nextStamp);
+    d_nextStamp++;
+  }
+}
+
+Node ExplanationCache::lookup(TNode lit)
+{
+  ++d_stats.d_lookups;
+  NodeNodeMap::const_iterator it = d_cache.find(lit);
+  if (it == d_cache.end())
+  {
+    return Node::null();
+  }
+  NodeStampMap::const_iterator its = d_stamps.find(lit);
+  if (its == d_stamps.end() || !isValidExplanation(it->second, its->second))
+  {
+    Trace("prop-explain-cache")
+        << "...cached explanation for " << lit << " is stale" << std::endl;
+    ++d_stats.d_stale;
+    return Node::null();
+  }
+  ++d_stats.d_hits;
+  return it->second;
+}
+
+void ExplanationCache::store(TNode lit, const Node& exp)
+{
+  if (d_cache.size() >= d_limit && d_cache.find(lit) == d_cache.end())
+  {
+    ++d_stats.d_full;
+    return;
+  }
+  ++d_stats.d_stored;
+  d_cache.insert(lit, exp);
+}
+
+bool ExplanationCache::isValidExplanation(const Node& exp,
+                                          uint64_t stamp) const
+{
+  NodeStampMap::const_iterator its;
+  if (exp.getKind() == Kind::AND)
+  {
+    for (const Node& e : exp)
+    {
+      its = d_stamps.find(e);
+      if (its == d_stamps.end() || its->second >= stamp)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (exp.isConst())
+  {
+    // trivial explanation
+    return exp.getConst<bool>();
+  }
+  its = d_stamps.find(exp);
+  return its != d_stamps.end() && its->second < stamp;
+}
+
+ExplanationCache::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_lookups(sr.registerInt("ExplanationCache::lookups")),
+      d_hits(sr.registerInt("ExplanationCache::hits")),
+      d_stale(sr.registerInt("ExplanationCache::stale")),
+      d_stored(sr.registerInt("ExplanationCache::stored")),
+      d_full(sr.registerInt("ExplanationCache::full"))
+{
+}
+
+}  // namespace prop
+}  // namespace cvc5::internal
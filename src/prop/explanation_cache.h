@@ -0,0 +1,111 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Cache of explanations for theory propagations.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROP__EXPLANATION_CACHE_H
+#define CVC5__PROP__EXPLANATION_CACHE_H
+
+#include "context/cdhashmap.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+/**
+ * A bounded cache of explanations for literals propagated by the theory
+ * engine.
+ *
+ * An explanation (and exp l) for a propagated literal l is a valid theory
+ * lemma (=> exp l) in the user context in which it was computed. Hence, it
+ * may be reused as the reason for l whenever l is propagated again later in
+ * the same user context, e.g. after a restart or after backtracking, provided
+ * that every literal in exp was asserted before l. The latter is required by
+ * the SAT solvers, which expect reasons to only contain literals that appear
+ * earlier on the trail.
+ *
+ * To check this requirement, this class assigns a timestamp to each literal
+ * the first time it is asserted or propagated in the current SAT context. The
+ * cached explanations themselves are user-context dependent, so that they are
+ * discarded when the user context level they were computed in is popped.
+ */
+class ExplanationCache : protected EnvObj
+{
+  using NodeStampMap = context::CDHashMap<Node, uint64_t>;
+  using NodeNodeMap = context::CDHashMap<Node, Node>;
+
+ public:
+  /**
+   * @param env The environment.
+   * @param limit The maximum number of explanations stored, over all user
+   * context levels.
+   */
+  ExplanationCache(Env& env, size_t limit);
+  ~ExplanationCache();
+  /** Notify that lit was asserted to the theory engine. */
+  void notifyAsserted(TNode lit);
+  /** Notify that lit was propagated by the theory engine. */
+  void notifyPropagated(TNode lit);
+  /**
+   * Get the cached explanation for propagated literal lit.
+   * @param lit The propagated literal.
+   * @return A conjunction of literals (or a single literal) that explains lit
+   * in the current SAT context, or the null node if no such explanation is
+   * cached.
+   */
+  Node lookup(TNode lit);
+  /**
+   * Store exp as the explanation of propagated literal lit. This replaces
+   * a (stale) explanation already cached for lit. It is a no-op if lit has no
+   * cached explanation and the limit of this cache has been reached.
+   */
+  void store(TNode lit, const Node& exp);
+
+ private:
+  /** Set the timestamp of lit, if it does not already have one. */
+  void setTimestamp(TNode lit);
+  /**
+   * Returns true if all literals in exp have timestamps smaller than stamp.
+   */
+  bool isValidExplanation(const Node& exp, uint64_t stamp) const;
+  /** Timestamp of the literals asserted in the current SAT context. */
+  NodeStampMap d_stamps;
+  /** The next timestamp, which is monotonically increasing. */
+  uint64_t d_nextStamp;
+  /** The cached explanations, user-context dependent. */
+  NodeNodeMap d_cache;
+  /** The maximum number of entries of d_cache */
+  size_t d_limit;
+  /** Statistics about the cache */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Total number of lookups */
+    IntStat d_lookups;
+    /** Number of lookups that returned a cached explanation */
+    IntStat d_hits;
+    /** Number of lookups whose cached explanation was not applicable */
+    IntStat d_stale;
+    /** Number of explanations stored */
+    IntStat d_stored;
+    /** Number of explanations not stored due to the limit */
+    IntStat d_full;
+  };
+  Statistics d_stats;
+};
+
+}  // namespace prop
+}  // namespace cvc5::internal
+
+#endif
@@ -171,7 +171,9 @@ Solver::Solver(Env& env,
       //
       ,
       learntsize_adjust_start_confl(100),
-      learntsize_adjust_inc(1.5)
+      learntsize_adjust_inc(1.5),
+      retain_learnts_size(0),
+      track_lbd(false)
 
       // Statistics: (formerly in 'SolverStats')
       //
@@ -187,7 +189,8 @@ Solver::Solver(Env& env,
       clauses_literals(0),
       learnts_literals(0),
       max_literals(0),
-      tot_literals(0)
+      tot_literals(0),
+      retained_learnts(0)
 
       ,
       ok(true),
@@ -199,7 +202,8 @@ Solver::Solver(Env& env,
       simpDB_props(0),
       order_heap(VarOrderLt(activity)),
       progress_estimate(0),
-      remove_satisfied(!enableIncremental)
+      remove_satisfied(!enableIncremental),
+      lbd_stamp(0)
 
       // Resource constraints:
       //
@@ -391,7 +395,8 @@ CRef Solver::reason(Var x) {
     d_pfManager->notifyCurrPropagationInsertedAtLevel(explLevel);
   }
   // Construct the reason
-  CRef real_reason = ca.alloc(explLevel, explanation, true);
+  // Theory explanations are valid independently of the user level
+  CRef real_reason = ca.alloc(explLevel, explanation, true, true);
   vardata[x] = VarData(
       real_reason, level(x), user_level(x), intro_level(x), trail_index(x));
   clauses_removable.push(real_reason);
@@ -501,7 +506,7 @@ bool Solver::addClause_(vec<Lit>& ps, bool removable, ClauseId& id)
         lemma_lt lt(*this);
         sort(ps, lt);
 
-        cr = ca.alloc(clauseLevel, ps, false);
+        cr = ca.alloc(clauseLevel, ps, false, removable || assertionLevel == 0);
         clauses_persistent.push(cr);
         attachClause(cr);
         if (needProof() && clauseLevel < assertionLevel)
@@ -859,6 +864,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
   int index = trail.size() - 1;
 
   int max_resolution_level = 0;  // Maximal level of the resolved clauses
+  analyze_global = true;
 
     if (needProof())
     {
@@ -874,6 +880,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
         // in turn may lead to reallocations that invalidate c.
         Clause& c = ca[confl];
         max_resolution_level = std::max(max_resolution_level, c.level());
+        analyze_global = analyze_global && c.global();
 
         if (c.removable()) claBumpActivity(c);
       }
@@ -915,6 +922,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
             {
               max_resolution_level =
                   std::max(max_resolution_level, user_level(var(q)));
+              analyze_global = analyze_global && user_level(var(q)) == 0;
             }
 
             // FIXME: can we do it lazily if we actually need the proof?
@@ -1029,17 +1037,40 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 }
 
 
+int Solver::computeLBD(const vec<Lit>& lits)
+{
+  lbd_stamp++;
+  int lbd = 0;
+  for (int i = 0; i < lits.size(); i++)
+  {
+    int l = level(var(lits[i]));
+    if (l >= lbd_seen.size())
+    {
+      lbd_seen.growTo(l + 1, 0);
+    }
+    if (lbd_seen[l] != lbd_stamp)
+    {
+      lbd_seen[l] = lbd_stamp;
+      lbd++;
+    }
+  }
+  return lbd;
+}
+
 // Check if 'p' can be removed. 'abstract_levels' is used to abort early if the algorithm is
 // visiting literals at levels that cannot be removed later.
 bool Solver::litRedundant(Lit p, uint32_t abstract_levels)
 {
     analyze_stack.clear(); analyze_stack.push(p);
     int top = analyze_toclear.size();
+    // whether all clauses used to show that p is redundant are global
+    bool global = true;
     while (analyze_stack.size() > 0){
         CRef c_reason = reason(var(analyze_stack.last()));
         Assert(c_reason != CRef_Undef);
         Clause& c = ca[c_reason];
         int c_size = c.size();
+        global = global && c.global();
         analyze_stack.pop();
 
         // Since calling reason might relocate to resize, c is not necesserily the right reference, we must
@@ -1063,9 +1094,14 @@ bool Solver::litRedundant(Lit p, uint32_t abstract_levels)
               return false;
             }
           }
+          else if (level(var(p2)) == 0)
+          {
+            global = global && user_level(var(p2)) == 0;
+          }
         }
     }
 
+    analyze_global = analyze_global && global;
     return true;
 }
 
@@ -1409,12 +1445,45 @@ void Solver::removeSatisfied(vec<CRef>& cs)
     cs.shrink(i - j);
 }
 
+bool Solver::canRetainClause(const Clause& c, int level) const
+{
+  if (!c.removable() || !c.global() || c.size() > retain_learnts_size
+      || needProof() || assertionLevelOnly())
+  {
+    return false;
+  }
+  for (int k = 0, size = c.size(); k < size; ++k)
+  {
+    if (intro_level(var(c[k])) > level)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void Solver::removeClausesAboveLevel(vec<CRef>& cs, int level)
 {
     int i, j;
     for (i = j = 0; i < cs.size(); i++){
         Clause& c = ca[cs[i]];
         if (c.level() > level) {
+          if (canRetainClause(c, level))
+          {
+            // The clause does not depend on the popped assertions and all of
+            // its variables remain, hence we can keep it at the new level.
+            Trace("minisat") << "retain learnt clause at level " << level
+                             << std::endl;
+            int newLevel = 0;
+            for (int k = 0, size = c.size(); k < size; ++k)
+            {
+              newLevel = std::max(newLevel, intro_level(var(c[k])));
+            }
+            c.level(newLevel);
+            retained_learnts++;
+            cs[j++] = cs[i];
+            continue;
+          }
           SatClause satClause;
           vec<Lit> clauseLits;
           MinisatSatSolver::toSatClause(c, satClause);
@@ -1522,6 +1591,10 @@ lbool Solver::search(int nof_conflicts)
       // Analyze the conflict
       learnt_clause.clear();
       int max_level = analyze(confl, learnt_clause, backtrack_level);
+      if (track_lbd)
+      {
+        d_proxy->notifyLearnedClauseLbd(computeLBD(learnt_clause));
+      }
       cancelUntil(backtrack_level);
 
       // Assert the conflict clause and the asserting literal
@@ -1541,7 +1614,8 @@ lbool Solver::search(int nof_conflicts)
       {
         CRef cr = ca.alloc(assertionLevelOnly() ? assertionLevel : max_level,
                            learnt_clause,
-                           true);
+                           true,
+                           analyze_global);
         // Call notifySatClause here.
         SatClause satClause;
         MinisatSatSolver::toSatClause(ca[cr], satClause);
@@ -2077,7 +2151,8 @@ CRef Solver::updateLemmas() {
         }
       }
 
-      lemma_ref = ca.alloc(clauseLevel, lemma, removable);
+      lemma_ref = ca.alloc(
+          clauseLevel, lemma, removable, removable || assertionLevel == 0);
       // notify cnf stream that this clause's proof must be saved to resist
       // context-popping
       if (needProof() && clauseLevel < assertionLevel)
@@ -2153,7 +2228,7 @@ void ClauseAllocator::reloc(CRef& cr, ClauseAllocator& to)
   Clause& c = operator[](cr);
   if (c.reloced()) { cr = c.relocation(); return; }
 
-  cr = to.alloc(c.level(), c, c.removable());
+  cr = to.alloc(c.level(), c, c.removable(), c.global());
   c.relocate(cr);
   // Copy extra data-fields:
   // (This could be cleaned-up. Generalize Clause-constructor to be applicable here instead?)
@@ -110,6 +110,13 @@ class Solver : protected EnvObj
   /** Shrink 'cs' to contain only clauses below given level */
   void removeClausesAboveLevel(vec<CRef>& cs, int level);
 
+  /**
+   * Returns true if the learnt clause c, whose level is above the given level,
+   * can be retained at that level. This is the case if c is global, short
+   * enough and all of its variables were introduced at or below the level.
+   */
+  bool canRetainClause(const Clause& c, int level) const;
+
   /** True if we are currently solving. */
   bool minisat_busy;
 
@@ -364,12 +371,17 @@ public:
  int learntsize_adjust_start_confl;
  double learntsize_adjust_inc;
 
+ int retain_learnts_size;  // Maximal size of global learnt clauses that are
+                           // retained on pop if all their variables remain
+                           // (0 = none).
+ bool track_lbd;  // Notify the theory proxy of the LBD of learnt clauses.
+
  // Statistics: (read-only member variable)
  //
  int64_t solves, starts, decisions, rnd_decisions, propagations, conflicts,
      resources_consumed;
  int64_t dec_vars, clauses_literals, learnts_literals, max_literals,
-     tot_literals;
+     tot_literals, retained_learnts;
 
 protected:
 
@@ -474,7 +486,10 @@ protected:
     vec<char>           seen;
     vec<Lit>            analyze_stack;
     vec<Lit>            analyze_toclear;
+    bool                analyze_global;     // Set by 'analyze()': true if the learnt clause only depends on global clauses.
     vec<Lit>            add_tmp;
+    vec<uint64_t>       lbd_seen;           // Used by 'computeLBD()': the last stamp of each decision level.
+    uint64_t            lbd_stamp;          // Used by 'computeLBD()': the current stamp.
 
     double              max_learnts;
     double              learntsize_adjust_confl;
@@ -505,6 +520,7 @@ protected:
     int      analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
     void     analyzeFinal     (Lit p, vec<Lit>& out_conflict);                         // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()') - true if p is redundant
+    int      computeLBD       (const vec<Lit>& lits);                                  // Number of distinct decision levels of 'lits'.
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
@@ -191,7 +191,8 @@ class Clause {
         unsigned removable : 1;
         unsigned has_extra : 1;
         unsigned reloced   : 1;
-        unsigned size      : 27;
+        unsigned global    : 1;
+        unsigned size      : 26;
         unsigned level     : 32; }                            header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
@@ -199,11 +200,12 @@ class Clause {
 
     // NOTE: This constructor cannot be used directly (doesn't allocate enough memory).
     template<class V>
-    Clause(const V& ps, bool use_extra, bool removable, int level) {
+    Clause(const V& ps, bool use_extra, bool removable, int level, bool global) {
         header.mark      = 0;
         header.removable = removable;
         header.has_extra = use_extra;
         header.reloced   = 0;
+        header.global    = global;
         header.size      = ps.size();
         header.level     = level;
 
@@ -227,6 +229,10 @@ public:
     }
 
     int          level       ()      const   { return header.level; }
+    void         level       (int l)         { header.level = l; }
+    // True if the clause is entailed by the clauses of user level 0 and
+    // theory lemmas only, i.e. it remains valid after any pop.
+    bool         global      ()      const   { return header.global; }
     int          size        ()      const   { return header.size; }
     void shrink(int i)
     {
@@ -288,7 +294,10 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
         RegionAllocator<uint32_t>::moveTo(to); }
 
     template<class Lits>
-    CRef alloc(int level, const Lits& ps, bool removable = false)
+    CRef alloc(int level,
+               const Lits& ps,
+               bool removable = false,
+               bool global = false)
     {
       Assert(sizeof(Lit) == sizeof(uint32_t));
       Assert(sizeof(float) == sizeof(uint32_t));
@@ -296,7 +305,7 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
 
       CRef cid = RegionAllocator<uint32_t>::alloc(
           clauseWord32Size(ps.size(), use_extra));
-      new (lea(cid)) Clause(ps, use_extra, removable, level);
+      new (lea(cid)) Clause(ps, use_extra, removable, level, global);
 
       return cid;
     }
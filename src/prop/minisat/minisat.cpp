@@ -17,6 +17,9 @@
 
 #include "prop/minisat/minisat.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "options/base_options.h"
 #include "options/decision_options.h"
 #include "options/proof_options.h"
@@ -24,6 +27,7 @@
 #include "options/smt_options.h"
 #include "proof/clause_id.h"
 #include "prop/minisat/simp/SimpSolver.h"
+#include "prop/sat_stats_sampler.h"
 #include "util/statistics_stats.h"
 
 namespace cvc5::internal {
@@ -163,6 +167,11 @@ void MinisatSatSolver::setupOptions() {
   d_minisat->clause_decay = options().prop.satClauseDecay;
   d_minisat->restart_first = options().prop.satRestartFirst;
   d_minisat->restart_inc = options().prop.satRestartInc;
+  // clause sizes fit in an int, so larger limits retain every clause
+  d_minisat->retain_learnts_size = static_cast<int>(
+      std::min<uint64_t>(options().prop.satRetainLearnedSize,
+                         std::numeric_limits<int>::max()));
+  d_minisat->track_lbd = SatStatsSampler::isEnabled(options());
 }
 
 ClauseId MinisatSatSolver::addClause(SatClause& clause, bool removable)
@@ -250,6 +259,15 @@ bool MinisatSatSolver::ok() const {
   return d_minisat->okay();
 }
 
+bool MinisatSatSolver::getSearchCounters(SatSearchCounters& counters) const
+{
+  counters.d_decisions = d_minisat->decisions;
+  counters.d_propagations = d_minisat->propagations;
+  counters.d_conflicts = d_minisat->conflicts;
+  counters.d_restarts = d_minisat->starts;
+  return true;
+}
+
 void MinisatSatSolver::interrupt() {
   d_minisat->interrupt();
 }
@@ -343,7 +361,9 @@ MinisatSatSolver::Statistics::Statistics(StatisticsRegistry& registry)
       d_statMaxLiterals(
           registry.registerReference<int64_t>("sat::max_literals")),
       d_statTotLiterals(
-          registry.registerReference<int64_t>("sat::tot_literals"))
+          registry.registerReference<int64_t>("sat::tot_literals")),
+      d_statRetainedLearnts(
+          registry.registerReference<int64_t>("sat::retained_learnts"))
 {
 }
 
@@ -357,6 +377,7 @@ void MinisatSatSolver::Statistics::init(Minisat::SimpSolver* minisat){
   d_statLearntsLiterals.set(minisat->learnts_literals);
   d_statMaxLiterals.set(minisat->max_literals);
   d_statTotLiterals.set(minisat->tot_literals);
+  d_statRetainedLearnts.set(minisat->retained_learnts);
 }
 void MinisatSatSolver::Statistics::deinit()
 {
@@ -369,6 +390,7 @@ void MinisatSatSolver::Statistics::deinit()
   d_statLearntsLiterals.reset();
   d_statMaxLiterals.reset();
   d_statTotLiterals.reset();
+  d_statRetainedLearnts.reset();
 }
 
 }  // namespace prop
@@ -67,6 +67,8 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
 
   bool ok() const override;
 
+  bool getSearchCounters(SatSearchCounters& counters) const override;
+
   void interrupt() override;
 
   SatValue value(SatLiteral l) override;
@@ -129,6 +131,7 @@ class MinisatSatSolver : public CDCLTSatSolver, protected EnvObj
    ReferenceStat<int64_t> d_statConflicts, d_statClausesLiterals;
    ReferenceStat<int64_t> d_statLearntsLiterals, d_statMaxLiterals;
    ReferenceStat<int64_t> d_statTotLiterals;
+   ReferenceStat<int64_t> d_statRetainedLearnts;
 
   public:
    Statistics(StatisticsRegistry& registry);
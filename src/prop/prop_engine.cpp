@@ -38,6 +38,7 @@
 #include "prop/sat_solver_factory.h"
 #include "prop/theory_proxy.h"
 #include "smt/env.h"
+#include "smt/profiler.h"
 #include "theory/output_channel.h"
 #include "theory/theory_engine.h"
 #include "util/resource_manager.h"
@@ -214,6 +215,11 @@ void PropEngine::assertLemma(theory::InferenceId id,
   assertLemmasInternal(id, tplemma, ppLemmas, removable, inprocess, local);
 }
 
+uint64_t PropEngine::getNumClauses() const
+{
+  return d_cnfStream->getNumClauses();
+}
+
 void PropEngine::assertTrustedLemmaInternal(theory::InferenceId id,
                                             TrustNode trn,
                                             bool removable)
@@ -466,6 +472,7 @@ Result PropEngine::checkSat() {
 
   // Check the problem
   SatValue result;
+  Profiler::Scope solveScope(profiler(), "solve");
   if (assumptions.empty())
   {
     result = d_satSolver->solve();
@@ -832,6 +839,11 @@ std::vector<Node> PropEngine::getLearnedZeroLevelLiteralsForRestart() const
   return d_theoryProxy->getLearnedZeroLevelLiteralsForRestart();
 }
 
+std::vector<Node> PropEngine::getLearnedClauses() const
+{
+  return d_theoryProxy->getLearnedClauses();
+}
+
 modes::LearnedLitType PropEngine::getLiteralType(const Node& lit) const
 {
   return d_theoryProxy->getLiteralType(lit);
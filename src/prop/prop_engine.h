@@ -138,6 +138,9 @@ class PropEngine : protected EnvObj
                    TrustNode tlemma,
                    theory::LemmaProperty p);
 
+  /** Returns the number of clauses asserted to the SAT solver so far. */
+  uint64_t getNumClauses() const;
+
   /**
    * This is called when a theory propagation was explained with texp.
    * In other words, texp corresponds to a formula that was added to the SAT
@@ -358,6 +361,12 @@ class PropEngine : protected EnvObj
   /** Get the zero-level assertions that should be used on deep restart */
   std::vector<Node> getLearnedZeroLevelLiteralsForRestart() const;
 
+  /**
+   * Get the short clauses learned by the SAT solver that are entailed by the
+   * current assertions, given in terms of input symbols.
+   */
+  std::vector<Node> getLearnedClauses() const;
+
   /** Get the literal type through the ZLL utilities */
   modes::LearnedLitType getLiteralType(const Node& lit) const;
 
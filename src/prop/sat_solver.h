@@ -35,6 +35,15 @@ namespace prop {
 class SatProofManager;
 class TheoryProxy;
 
+/** Cumulative search counters of a SAT solver. */
+struct SatSearchCounters
+{
+  uint64_t d_decisions = 0;
+  uint64_t d_propagations = 0;
+  uint64_t d_conflicts = 0;
+  uint64_t d_restarts = 0;
+};
+
 class SatSolver {
 
 public:
@@ -114,6 +123,16 @@ public:
   /** Check if the solver is in an inconsistent state */
   virtual bool ok() const = 0;
 
+  /**
+   * Get the cumulative search counters of this solver.
+   * @param counters The counters to fill.
+   * @return False if the solver does not provide search counters.
+   */
+  virtual bool getSearchCounters(SatSearchCounters& counters) const
+  {
+    return false;
+  }
+
   /**
    * Get list of unsatisfiable assumptions.
    *
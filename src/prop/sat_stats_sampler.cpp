@@ -0,0 +1,184 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Periodic sampling of SAT solver search counters.
+ */
+
+#include "prop/sat_stats_sampler.h"
+
+#include "base/check.h"
+#include "base/output.h"
+#include "options/options.h"
+#include "options/prop_options.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+namespace {
+
+/** Version of the binary trace format. */
+const uint32_t s_traceVersion = 1;
+/** Number of 64-bit fields per record of the binary trace. */
+const uint32_t s_traceFields = 6;
+/** Number of calls to tick() between two checks of the clock. */
+const uint32_t s_ticksPerCheck = 64;
+
+}  // namespace
+
+bool SatStatsSampler::isEnabled(const Options& opts)
+{
+  return opts.prop.satStatsInterval > 0 || !opts.prop.satStatsTrace.empty();
+}
+
+SatStatsSampler::SatStatsSampler(Env& env, SatSolver* solver)
+    : EnvObj(env),
+      d_solver(solver),
+      d_interval(std::chrono::milliseconds(options().prop.satStatsInterval)),
+      d_start(Clock::now()),
+      d_last(d_start),
+      d_theoryTime(0),
+      d_lastTheoryTime(0),
+      d_theoryDepth(0),
+      d_ticks(0),
+      d_stats(statisticsRegistry())
+{
+  const std::string& file = options().prop.satStatsTrace;
+  if (!file.empty())
+  {
+    d_trace.open(file, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!d_trace)
+    {
+      warning() << "Cannot open SAT statistics trace file " << file
+                << std::endl;
+      return;
+    }
+    uint32_t recordSize = s_traceFields * sizeof(uint64_t);
+    d_trace.write("cvc5satt", 8);
+    d_trace.write(reinterpret_cast<const char*>(&s_traceVersion),
+                  sizeof(s_traceVersion));
+    d_trace.write(reinterpret_cast<const char*>(&recordSize),
+                  sizeof(recordSize));
+  }
+}
+
+SatStatsSampler::~SatStatsSampler() {}
+
+void SatStatsSampler::presolve()
+{
+  // rates are computed with respect to the start of the solve call
+  d_last = Clock::now();
+  d_solver->getSearchCounters(d_lastCounters);
+  d_lastTheoryTime = d_theoryTime;
+  d_ticks = 0;
+}
+
+void SatStatsSampler::postsolve() { sample(); }
+
+void SatStatsSampler::tick()
+{
+  if (d_interval.count() == 0 || ++d_ticks < s_ticksPerCheck)
+  {
+    return;
+  }
+  d_ticks = 0;
+  if (Clock::now() - d_last >= d_interval)
+  {
+    sample();
+  }
+}
+
+void SatStatsSampler::notifyLearnedLbd(uint64_t lbd) { d_stats.d_lbd << lbd; }
+
+void SatStatsSampler::sample()
+{
+  Clock::time_point now = Clock::now();
+  SatSearchCounters counters;
+  if (!d_solver->getSearchCounters(counters))
+  {
+    // the solver does not provide counters, we only record the theory time
+    counters = d_lastCounters;
+  }
+  ++d_stats.d_samples;
+  double secs = std::chrono::duration<double>(now - d_last).count();
+  if (secs > 0)
+  {
+    d_stats.d_decisionsPerSec
+        << (counters.d_decisions - d_lastCounters.d_decisions) / secs;
+    d_stats.d_propagationsPerSec
+        << (counters.d_propagations - d_lastCounters.d_propagations) / secs;
+    d_stats.d_conflictsPerSec
+        << (counters.d_conflicts - d_lastCounters.d_conflicts) / secs;
+    d_stats.d_theoryRatio
+        << std::chrono::duration<double>(d_theoryTime - d_lastTheoryTime)
+                   .count()
+               / secs;
+  }
+  d_stats.d_theoryTimeMs =
+      std::chrono::duration_cast<std::chrono::milliseconds>(d_theoryTime)
+          .count();
+  Trace("sat-stats") << "sample: decisions " << counters.d_decisions
+                     << ", propagations " << counters.d_propagations
+                     << ", conflicts " << counters.d_conflicts
+                     << ", restarts " << counters.d_restarts << std::endl;
+  if (d_trace.is_open())
+  {
+    uint64_t record[s_traceFields] = {
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now
+                                                                  - d_start)
+                .count()),
+        counters.d_decisions,
+        counters.d_propagations,
+        counters.d_conflicts,
+        counters.d_restarts,
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(d_theoryTime)
+                .count())};
+    d_trace.write(reinterpret_cast<const char*>(record), sizeof(record));
+    d_trace.flush();
+  }
+  d_last = now;
+  d_lastCounters = counters;
+  d_lastTheoryTime = d_theoryTime;
+}
+
+SatStatsSampler::TheoryScope::TheoryScope(SatStatsSampler* sampler)
+    : d_sampler(sampler)
+{
+  if (d_sampler != nullptr && d_sampler->d_theoryDepth++ == 0)
+  {
+    d_start = Clock::now();
+  }
+}
+
+SatStatsSampler::TheoryScope::~TheoryScope()
+{
+  if (d_sampler != nullptr && --d_sampler->d_theoryDepth == 0)
+  {
+    d_sampler->d_theoryTime += Clock::now() - d_start;
+  }
+}
+
+SatStatsSampler::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_samples(sr.registerInt("SatStatsSampler::samples")),
+      d_decisionsPerSec(
+          sr.registerAverage("SatStatsSampler::decisions_per_sec")),
+      d_propagationsPerSec(
+          sr.registerAverage("SatStatsSampler::propagations_per_sec")),
+      d_conflictsPerSec(
+          sr.registerAverage("SatStatsSampler::conflicts_per_sec")),
+      d_theoryRatio(sr.registerAverage("SatStatsSampler::theory_time_ratio")),
+      d_theoryTimeMs(sr.registerInt("SatStatsSampler::theory_time_ms")),
+      d_lbd(sr.registerHistogram<uint64_t>("SatStatsSampler::lbd"))
+{
+}
+
+}  // namespace prop
+}  // namespace cvc5::internal
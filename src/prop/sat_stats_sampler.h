@@ -0,0 +1,132 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Periodic sampling of SAT solver search counters.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROP__SAT_STATS_SAMPLER_H
+#define CVC5__PROP__SAT_STATS_SAMPLER_H
+
+#include <chrono>
+#include <fstream>
+
+#include "prop/sat_solver.h"
+#include "smt/env_obj.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class Options;
+
+namespace prop {
+
+/**
+ * Samples the search counters of a SAT solver (see
+ * SatSolver::getSearchCounters) during search and records the rates of
+ * decisions, propagations and conflicts per second, as well as the fraction
+ * of time spent in theory callbacks, in the statistics registry. It further
+ * records a histogram of the LBD of learned clauses, if the SAT solver
+ * reports them.
+ *
+ * Samples are taken at most every --sat-stats-interval milliseconds during
+ * search and at the end of each solve call. If --sat-stats-trace is set, each
+ * sample is additionally appended to a binary trace file. The file starts
+ * with the 8 byte magic "cvc5satt", followed by the format version and the
+ * record size as 32-bit unsigned integers. Each record consists of the
+ * following 64-bit unsigned integers (native byte order): the time since the
+ * creation of the sampler in microseconds, the number of decisions,
+ * propagations, conflicts and restarts, and the total time spent in theory
+ * callbacks in microseconds.
+ */
+class SatStatsSampler : protected EnvObj
+{
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  /** Returns true if SAT statistics sampling is enabled by opts. */
+  static bool isEnabled(const Options& opts);
+
+  SatStatsSampler(Env& env, SatSolver* solver);
+  ~SatStatsSampler();
+
+  /** Notify that a solve call starts. */
+  void presolve();
+  /** Notify that a solve call ended, takes a sample. */
+  void postsolve();
+  /**
+   * Called frequently during search. Takes a sample if the sampling interval
+   * has passed since the last sample.
+   */
+  void tick();
+  /** Notify that a clause with the given LBD was learned. */
+  void notifyLearnedLbd(uint64_t lbd);
+
+  /** Measures the time spent in a theory callback in its scope. */
+  class TheoryScope
+  {
+   public:
+    TheoryScope(SatStatsSampler* sampler);
+    ~TheoryScope();
+
+   private:
+    SatStatsSampler* d_sampler;
+    Clock::time_point d_start;
+  };
+
+ private:
+  /** Take a sample. */
+  void sample();
+  /** The SAT solver whose counters are sampled. */
+  SatSolver* d_solver;
+  /** The sampling interval. */
+  Clock::duration d_interval;
+  /** Time of creation of this sampler. */
+  Clock::time_point d_start;
+  /** Time of the last sample. */
+  Clock::time_point d_last;
+  /** The counters at the time of the last sample. */
+  SatSearchCounters d_lastCounters;
+  /** Total time spent in theory callbacks. */
+  Clock::duration d_theoryTime;
+  /** Time spent in theory callbacks at the time of the last sample. */
+  Clock::duration d_lastTheoryTime;
+  /** Depth of nested theory callbacks. */
+  uint32_t d_theoryDepth;
+  /** Number of calls to tick() since the clock was last checked. */
+  uint32_t d_ticks;
+  /** The binary trace, if enabled. */
+  std::ofstream d_trace;
+  /** Statistics of the sampled counters */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of samples taken */
+    IntStat d_samples;
+    /** Decisions per second, averaged over samples */
+    AverageStat d_decisionsPerSec;
+    /** Propagations per second, averaged over samples */
+    AverageStat d_propagationsPerSec;
+    /** Conflicts per second, averaged over samples */
+    AverageStat d_conflictsPerSec;
+    /** Fraction of time spent in theory callbacks, averaged over samples */
+    AverageStat d_theoryRatio;
+    /** Total time spent in theory callbacks in milliseconds */
+    IntStat d_theoryTimeMs;
+    /** The LBD of learned clauses */
+    HistogramStat<uint64_t> d_lbd;
+  };
+  Statistics d_stats;
+};
+
+}  // namespace prop
+}  // namespace cvc5::internal
+
+#endif
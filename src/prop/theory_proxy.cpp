@@ -29,8 +29,10 @@
 #include "options/prop_options.h"
 #include "options/smt_options.h"
 #include "prop/cnf_stream.h"
+#include "prop/explanation_cache.h"
 #include "prop/proof_cnf_stream.h"
 #include "prop/prop_engine.h"
+#include "prop/sat_stats_sampler.h"
 #include "prop/skolem_def_manager.h"
 #include "prop/zero_level_learner.h"
 #include "smt/env.h"
@@ -51,6 +53,7 @@ TheoryProxy::TheoryProxy(Env& env,
       d_decisionEngine(nullptr),
       d_trackActiveSkDefs(false),
       d_dmTrackActiveSkDefs(false),
+      d_dmNotifyAsserted(false),
       d_inSolve(false),
       d_theoryEngine(theoryEngine),
       d_queue(context()),
@@ -59,6 +62,7 @@ TheoryProxy::TheoryProxy(Env& env,
       d_zll(nullptr),
       d_prr(nullptr),
       d_stopSearch(userContext(), false),
+      d_learnedClauses(userContext()),
       d_activatedSkDefs(false)
 {
   bool trackZeroLevel =
@@ -71,6 +75,13 @@ TheoryProxy::TheoryProxy(Env& env,
   {
     d_zll = std::make_unique<ZeroLevelLearner>(env, theoryEngine);
   }
+  // Cached explanations are not stored with their proofs, hence we only use
+  // the cache when theory proofs are disabled.
+  if (options().prop.explainCache && !env.isTheoryProofProducing())
+  {
+    d_expCache = std::make_unique<ExplanationCache>(
+        env, options().prop.explainCacheLimit);
+  }
 }
 
 TheoryProxy::~TheoryProxy() {
@@ -83,7 +94,8 @@ void TheoryProxy::finishInit(CDCLTSatSolver* ss, CnfStream* cs)
   // stream
   options::DecisionMode dmode = options().decision.decisionMode;
   if (dmode == options::DecisionMode::JUSTIFICATION
-      || dmode == options::DecisionMode::STOPONLY)
+      || dmode == options::DecisionMode::STOPONLY
+      || dmode == options::DecisionMode::JUSTIFICATION_ACTIVITY)
   {
     d_decisionEngine.reset(new decision::JustificationStrategy(d_env, ss, cs));
     if (options().decision.jhSkolemRlvMode
@@ -97,6 +109,7 @@ void TheoryProxy::finishInit(CDCLTSatSolver* ss, CnfStream* cs)
   {
     d_decisionEngine.reset(new decision::DecisionEngineEmpty(d_env));
   }
+  d_dmNotifyAsserted = d_decisionEngine->needsAssertedNotify();
   // make the theory preregistrar
   d_prr.reset(new TheoryPreregistrar(d_env, d_theoryEngine, ss, cs));
   // compute if we need to track skolem definitions
@@ -108,6 +121,10 @@ void TheoryProxy::finishInit(CDCLTSatSolver* ss, CnfStream* cs)
   {
     d_lemip.reset(new LemmaInprocess(d_env, cs, *d_zll.get()));
   }
+  if (SatStatsSampler::isEnabled(options()))
+  {
+    d_satStats.reset(new SatStatsSampler(d_env, ss));
+  }
   d_cnfStream = cs;
 }
 
@@ -117,6 +134,10 @@ void TheoryProxy::presolve()
   d_decisionEngine->presolve();
   d_theoryEngine->presolve();
   d_stopSearch = false;
+  if (d_satStats != nullptr)
+  {
+    d_satStats->presolve();
+  }
   Trace("theory-proxy") << "TheoryProxy::presolve: end" << std::endl;
   d_inSolve = true;
 }
@@ -124,6 +145,10 @@ void TheoryProxy::presolve()
 void TheoryProxy::postsolve(SatValue result)
 {
   d_theoryEngine->postsolve(result);
+  if (d_satStats != nullptr)
+  {
+    d_satStats->postsolve();
+  }
   d_inSolve = false;
 }
 
@@ -202,6 +227,10 @@ void TheoryProxy::notifyAssertion(Node a,
   }
   // Otherwise, it is a skolem definition that will be activated dynamically
   // in TheoryProxy::theoryCheck.
+  if (isLemma && skolem.isNull())
+  {
+    d_decisionEngine->notifyLemma(a);
+  }
 
   // notify the preregistrar
   d_prr->addAssertion(a, skolem, isLemma);
@@ -209,6 +238,11 @@ void TheoryProxy::notifyAssertion(Node a,
 
 void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
   Trace("theory-proxy") << "TheoryProxy: check " << effort << std::endl;
+  SatStatsSampler::TheoryScope tscope(d_satStats.get());
+  if (d_satStats != nullptr)
+  {
+    d_satStats->tick();
+  }
   d_activatedSkDefs = false;
   // check with the preregistrar
   d_prr->check();
@@ -218,6 +252,10 @@ void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
   {
     std::tie(assertion, alevel) = d_queue.front();
     d_queue.pop();
+    if (d_dmNotifyAsserted)
+    {
+      d_decisionEngine->notifyAsserted(assertion);
+    }
     if (d_zll != nullptr)
     {
       if (d_stopSearch.get())
@@ -277,26 +315,44 @@ void TheoryProxy::theoryCheck(theory::Theory::Effort effort) {
 }
 
 void TheoryProxy::theoryPropagate(std::vector<SatLiteral>& output) {
+  SatStatsSampler::TheoryScope tscope(d_satStats.get());
   // Get the propagated literals
   std::vector<TNode> outputNodes;
   d_theoryEngine->getPropagatedLiterals(outputNodes);
   for (unsigned i = 0, i_end = outputNodes.size(); i < i_end; ++ i) {
     Trace("prop-explain") << "theoryPropagate() => " << outputNodes[i] << std::endl;
+    if (d_expCache != nullptr)
+    {
+      d_expCache->notifyPropagated(outputNodes[i]);
+    }
     output.push_back(d_cnfStream->getLiteral(outputNodes[i]));
   }
 }
 
 void TheoryProxy::explainPropagation(SatLiteral l, SatClause& explanation) {
+  SatStatsSampler::TheoryScope tscope(d_satStats.get());
   TNode lNode = d_cnfStream->getNode(l);
   Trace("prop-explain") << "explainPropagation(" << lNode << ")" << std::endl;
 
-  TrustNode tte = d_theoryEngine->getExplanation(lNode);
-  Node theoryExplanation = tte.getNode();
-  Assert(!d_env.isTheoryProofProducing() || tte.getGenerator());
-  // notify the prop engine of the explanation, which is only relevant if
-  // we are proof producing for the purposes of storing the CNF of the
-  // explanation.
-  d_propEngine->notifyExplainedPropagation(tte);
+  Node theoryExplanation;
+  if (d_expCache != nullptr)
+  {
+    theoryExplanation = d_expCache->lookup(lNode);
+  }
+  if (theoryExplanation.isNull())
+  {
+    TrustNode tte = d_theoryEngine->getExplanation(lNode);
+    theoryExplanation = tte.getNode();
+    Assert(!d_env.isTheoryProofProducing() || tte.getGenerator());
+    // notify the prop engine of the explanation, which is only relevant if
+    // we are proof producing for the purposes of storing the CNF of the
+    // explanation.
+    d_propEngine->notifyExplainedPropagation(tte);
+    if (d_expCache != nullptr)
+    {
+      d_expCache->store(lNode, theoryExplanation);
+    }
+  }
   Trace("prop-explain") << "explainPropagation() => " << theoryExplanation
                         << std::endl;
   explanation.push_back(l);
@@ -327,12 +383,18 @@ void TheoryProxy::explainPropagation(SatLiteral l, SatClause& explanation) {
 void TheoryProxy::notifySatClause(const SatClause& clause)
 {
   const std::vector<Plugin*>& plugins = d_env.getPlugins();
-  if (plugins.empty())
+  // We only record clauses learned during solving, and only if they are short
+  bool recordLearned =
+      d_inSolve && options().smt.produceLearnedClauses
+      && clause.size() <= options().smt.learnedClausesMaxSize;
+  if (plugins.empty() && !recordLearned)
   {
-    // nothing to do if no plugins
+    // nothing to do if no plugins and we are not recording learned clauses
     return;
   }
-  if (!d_inSolve && options().base.pluginNotifySatClauseInSolve)
+  bool notifyPlugins =
+      d_inSolve || !options().base.pluginNotifySatClauseInSolve;
+  if (!notifyPlugins && !recordLearned)
   {
     // We are not in solving mode. We do not inform plugins of SAT clauses
     // if pluginNotifySatClauseInSolve is true (default).
@@ -359,19 +421,38 @@ void TheoryProxy::notifySatClause(const SatClause& clause)
     Trace("theory-proxy")
         << "TheoryProxy::notifySatClause: Clause from SAT solver: " << clns
         << std::endl;
-    // notify the plugins
-    for (Plugin* p : plugins)
+    if (recordLearned)
+    {
+      d_learnedClauses.insert(clns);
+    }
+    if (notifyPlugins)
     {
-      p->notifySatClause(clns);
+      // notify the plugins
+      for (Plugin* p : plugins)
+      {
+        p->notifySatClause(clns);
+      }
     }
   }
 }
 
+void TheoryProxy::notifyLearnedClauseLbd(uint64_t lbd)
+{
+  if (d_satStats != nullptr)
+  {
+    d_satStats->notifyLearnedLbd(lbd);
+  }
+}
+
 void TheoryProxy::enqueueTheoryLiteral(const SatLiteral& l) {
   Node literalNode = d_cnfStream->getNode(l);
   Trace("theory-proxy") << "enqueueing theory literal " << l << " "
                         << literalNode << std::endl;
   Assert(!literalNode.isNull());
+  if (d_expCache != nullptr)
+  {
+    d_expCache->notifyAsserted(literalNode);
+  }
   // Decision level = SAT context level - 1 due to global push().
   d_queue.push(std::make_pair(literalNode, context()->getLevel() - 1));
 }
@@ -544,6 +625,16 @@ modes::LearnedLitType TheoryProxy::getLiteralType(const Node& lit) const
   return modes::LearnedLitType::UNKNOWN;
 }
 
+std::vector<Node> TheoryProxy::getLearnedClauses() const
+{
+  std::vector<Node> ret;
+  for (const Node& c : d_learnedClauses)
+  {
+    ret.push_back(c);
+  }
+  return ret;
+}
+
 std::vector<Node> TheoryProxy::getLearnedZeroLevelLiteralsForRestart() const
 {
   if (d_zll != nullptr)
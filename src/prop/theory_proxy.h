@@ -49,6 +49,8 @@ namespace prop {
 
 class PropEngine;
 class CnfStream;
+class ExplanationCache;
+class SatStatsSampler;
 class SkolemDefManager;
 class ZeroLevelLearner;
 
@@ -113,6 +115,12 @@ class TheoryProxy : protected EnvObj, public Registrar
    * a SAT clause. It notifies user plugins of the added clauses.
    */
   void notifySatClause(const SatClause& clause);
+  /**
+   * Notify that the SAT solver learned a clause with the given LBD. This is
+   * only called by SAT solvers that compute the LBD of learned clauses, if
+   * SAT statistics sampling is enabled.
+   */
+  void notifyLearnedClauseLbd(uint64_t lbd);
 
   void theoryPropagate(SatClause& output);
 
@@ -204,6 +212,11 @@ class TheoryProxy : protected EnvObj, public Registrar
   std::vector<Node> getLearnedZeroLevelLiteralsForRestart() const;
   /** Get literal type using ZLL utility */
   modes::LearnedLitType getLiteralType(const Node& lit) const;
+  /**
+   * Get the (short) clauses learned by the SAT solver in the current user
+   * context, which are given in terms of input symbols.
+   */
+  std::vector<Node> getLearnedClauses() const;
 
   /** Inprocess lemma */
   TrustNode inprocessLemma(TrustNode& trn);
@@ -228,6 +241,8 @@ class TheoryProxy : protected EnvObj, public Registrar
    * local assertions.
    */
   bool d_dmTrackActiveSkDefs;
+  /** Whether the decision engine needs to be notified of asserted literals */
+  bool d_dmNotifyAsserted;
   /**
    * Are we in solve?
    * This is true if there was a call to presolve() after the last call to
@@ -256,9 +271,21 @@ class TheoryProxy : protected EnvObj, public Registrar
   /** Preregister policy */
   std::unique_ptr<TheoryPreregistrar> d_prr;
 
+  /** The cache of explanations for theory propagations, if enabled */
+  std::unique_ptr<ExplanationCache> d_expCache;
+
+  /** The sampler of SAT solver statistics, if enabled */
+  std::unique_ptr<SatStatsSampler> d_satStats;
+
   /** Whether we have been requested to stop the search */
   context::CDO<bool> d_stopSearch;
 
+  /**
+   * The learned clauses in the current user context, tracked if
+   * produce-learned-clauses is enabled.
+   */
+  NodeSet d_learnedClauses;
+
   /**
    * Whether we activated new skolem definitions on the last call to
    * theoryCheck. If this is true, then theoryNeedCheck must return true,
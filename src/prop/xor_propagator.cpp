@@ -0,0 +1,615 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gauss-Jordan elimination based propagator for XOR constraints.
+ */
+
+#include "prop/xor_propagator.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "prop/sat_solver.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace prop {
+
+XorPropagator::XorPropagator(StatisticsRegistry& sr, size_t maxComponentSize)
+    : d_maxComponentSize(maxComponentSize), d_needRepair(false), d_stats(sr)
+{
+}
+
+XorPropagator::~XorPropagator() {}
+
+bool XorPropagator::canAddXor(const SatClause& lits) const
+{
+  if (d_maxComponentSize == 0)
+  {
+    return true;
+  }
+  // the columns of the merged component, new columns are counted once per
+  // occurrence, which only overestimates the size
+  size_t size = 0;
+  std::vector<size_t> comps;
+  for (const SatLiteral& lit : lits)
+  {
+    auto it = d_colOf.find(lit.getSatVariable());
+    size_t k = it == d_colOf.end() ? s_none : d_compOf[it->second];
+    if (k == s_none)
+    {
+      ++size;
+    }
+    else if (std::find(comps.begin(), comps.end(), k) == comps.end())
+    {
+      comps.push_back(k);
+      size += d_comps[k].d_cols.size();
+    }
+  }
+  return size <= d_maxComponentSize;
+}
+
+bool XorPropagator::addXor(const SatClause& lits, bool rhs, uint32_t level)
+{
+  Trace("prop-xor") << "addXor: " << lits << " = " << rhs
+                    << " (level: " << level << ")" << std::endl;
+  Assert(canAddXor(lits));
+  ++d_stats.d_xors;
+  // normalize to positive variables, x ^ x cancels out
+  std::vector<SatVariable> vars;
+  for (const SatLiteral& lit : lits)
+  {
+    vars.push_back(lit.getSatVariable());
+    rhs ^= lit.isNegated();
+  }
+  std::sort(vars.begin(), vars.end());
+  Xor& x = d_xors.emplace_back();
+  x.d_rhs = rhs;
+  x.d_level = level;
+  for (size_t i = 0, nvars = vars.size(); i < nvars; ++i)
+  {
+    if (i + 1 < nvars && vars[i] == vars[i + 1])
+    {
+      ++i;
+      continue;
+    }
+    x.d_vars.push_back(vars[i]);
+  }
+  for (SatVariable var : x.d_vars)
+  {
+    getColumn(var);
+  }
+  return addConstraint(x);
+}
+
+bool XorPropagator::isXorVar(SatVariable var) const
+{
+  return d_colOf.find(var) != d_colOf.end();
+}
+
+bool XorPropagator::empty() const { return d_xors.empty(); }
+
+void XorPropagator::assign(SatLiteral lit)
+{
+  auto it = d_colOf.find(lit.getSatVariable());
+  if (it == d_colOf.end())
+  {
+    return;
+  }
+  d_value[it->second] = lit.isNegated() ? -1 : 1;
+  d_queue.push_back(it->second);
+}
+
+void XorPropagator::unassign(SatVariable var)
+{
+  auto it = d_colOf.find(var);
+  if (it == d_colOf.end())
+  {
+    return;
+  }
+  d_value[it->second] = 0;
+  d_reasons.erase(var);
+  d_needRepair = true;
+}
+
+void XorPropagator::notifyBacktrack()
+{
+  for (SatVariable var : d_pending)
+  {
+    if (d_value[d_colOf[var]] == 0)
+    {
+      d_reasons.erase(var);
+    }
+  }
+  d_pending.clear();
+}
+
+bool XorPropagator::propagate(std::vector<SatLiteral>& props,
+                              SatClause& conflict)
+{
+  // Variables were unassigned, rows with at most one unassigned column may
+  // have an unassigned pivot and watched column again.
+  if (d_needRepair)
+  {
+    d_needRepair = false;
+    std::vector<size_t> stale;
+    stale.swap(d_stale);
+    for (size_t r : stale)
+    {
+      d_isStale[r] = false;
+      repivot(r);
+      markDirty(r);
+    }
+  }
+  while (!d_queue.empty())
+  {
+    size_t c = d_queue.back();
+    d_queue.pop_back();
+    if (d_value[c] == 0)
+    {
+      // unassigned in the meantime
+      continue;
+    }
+    if (d_pivotRow[c] != s_none)
+    {
+      repivot(d_pivotRow[c]);
+    }
+    // The rows watching c choose a new watched column when they are checked.
+    for (size_t r : d_watches[c])
+    {
+      if (d_rows[r].d_watch == c)
+      {
+        d_rows[r].d_watch = s_none;
+        markDirty(r);
+      }
+    }
+    d_watches[c].clear();
+  }
+  for (size_t i = 0, ndirty = d_dirty.size(); i < ndirty; ++i)
+  {
+    size_t r = d_dirty[i];
+    d_isDirty[r] = false;
+    if (!checkRow(r, props, conflict))
+    {
+      // keep the remaining rows for the next call
+      d_dirty.erase(d_dirty.begin(), d_dirty.begin() + i + 1);
+      return false;
+    }
+  }
+  d_dirty.clear();
+  return true;
+}
+
+void XorPropagator::explain(SatLiteral lit, SatClause& reason) const
+{
+  auto it = d_reasons.find(lit.getSatVariable());
+  Assert(it != d_reasons.end());
+  Assert(it->second[0] == lit);
+  reason.insert(reason.end(), it->second.begin(), it->second.end());
+}
+
+bool XorPropagator::check(const std::function<bool(SatVariable)>& value,
+                          SatClause& conflict) const
+{
+  for (const Xor& x : d_xors)
+  {
+    bool parity = false;
+    for (SatVariable var : x.d_vars)
+    {
+      parity ^= value(var);
+    }
+    if (parity != x.d_rhs)
+    {
+      Trace("prop-xor") << "check: violated XOR constraint" << std::endl;
+      for (SatVariable var : x.d_vars)
+      {
+        conflict.emplace_back(var, value(var));
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+void XorPropagator::userPop(uint32_t level)
+{
+  size_t nxors = d_xors.size();
+  while (!d_xors.empty() && d_xors.back().d_level > level)
+  {
+    d_xors.pop_back();
+  }
+  if (nxors == d_xors.size())
+  {
+    return;
+  }
+  Trace("prop-xor") << "userPop: rebuild with " << d_xors.size()
+                    << " XOR constraints" << std::endl;
+  ++d_stats.d_rebuilds;
+  d_rows.clear();
+  d_comps.clear();
+  d_dirty.clear();
+  d_isDirty.clear();
+  d_stale.clear();
+  d_isStale.clear();
+  d_queue.clear();
+  d_needRepair = false;
+  std::fill(d_pivotRow.begin(), d_pivotRow.end(), s_none);
+  std::fill(d_compOf.begin(), d_compOf.end(), s_none);
+  for (std::vector<size_t>& watches : d_watches)
+  {
+    watches.clear();
+  }
+  // The remaining constraints were consistent when they were added, or an
+  // inconsistency was recorded as a clause in their user level. Their
+  // components are subsets of components that were within the size bound.
+  for (const Xor& x : d_xors)
+  {
+    addConstraint(x);
+  }
+}
+
+bool XorPropagator::addConstraint(const Xor& x)
+{
+  // The constraint connects the components of its columns, merge them into
+  // the one with the most rows.
+  size_t k = s_none;
+  for (SatVariable var : x.d_vars)
+  {
+    size_t kc = d_compOf[d_colOf[var]];
+    if (kc != s_none
+        && (k == s_none
+            || d_comps[kc].d_rows.size() > d_comps[k].d_rows.size()))
+    {
+      k = kc;
+    }
+  }
+  if (k == s_none)
+  {
+    k = d_comps.size();
+    d_comps.emplace_back();
+  }
+  std::vector<size_t> cols;
+  for (SatVariable var : x.d_vars)
+  {
+    size_t c = d_colOf[var];
+    size_t kc = d_compOf[c];
+    if (kc == s_none)
+    {
+      addColumn(k, c);
+    }
+    else if (kc != k)
+    {
+      merge(k, kc);
+    }
+    cols.push_back(c);
+  }
+  return addRow(k, cols, x.d_rhs);
+}
+
+size_t XorPropagator::getColumn(SatVariable var)
+{
+  auto it = d_colOf.find(var);
+  if (it != d_colOf.end())
+  {
+    return it->second;
+  }
+  size_t c = d_vars.size();
+  d_colOf[var] = c;
+  d_vars.push_back(var);
+  d_value.push_back(0);
+  d_pivotRow.push_back(s_none);
+  d_compOf.push_back(s_none);
+  d_localCol.push_back(0);
+  d_watches.emplace_back();
+  return c;
+}
+
+void XorPropagator::addColumn(size_t k, size_t c)
+{
+  Assert(d_compOf[c] == s_none);
+  Component& comp = d_comps[k];
+  d_compOf[c] = k;
+  d_localCol[c] = comp.d_cols.size();
+  comp.d_cols.push_back(c);
+  if (comp.d_cols.size() > 64 * comp.d_numWords)
+  {
+    ++comp.d_numWords;
+    for (size_t r : comp.d_rows)
+    {
+      d_rows[r].d_bits.resize(comp.d_numWords, 0);
+    }
+  }
+}
+
+void XorPropagator::merge(size_t to, size_t from)
+{
+  Trace("prop-xor") << "merge component " << from << " into " << to
+                    << std::endl;
+  ++d_stats.d_merges;
+  Component& cfrom = d_comps[from];
+  for (size_t c : cfrom.d_cols)
+  {
+    d_compOf[c] = s_none;
+    addColumn(to, c);
+  }
+  // Re-encode the rows in the local columns of the target component.
+  Component& cto = d_comps[to];
+  for (size_t r : cfrom.d_rows)
+  {
+    Row& row = d_rows[r];
+    std::vector<uint64_t> bits(cto.d_numWords, 0);
+    for (size_t i = 0; i < cfrom.d_numWords; ++i)
+    {
+      uint64_t w = row.d_bits[i];
+      for (size_t l = 64 * i; w != 0; ++l, w >>= 1)
+      {
+        if (w & 1)
+        {
+          size_t lc = d_localCol[cfrom.d_cols[l]];
+          bits[lc / 64] |= uint64_t(1) << (lc % 64);
+        }
+      }
+    }
+    row.d_bits.swap(bits);
+    row.d_comp = to;
+    cto.d_rows.push_back(r);
+  }
+  cfrom.d_cols.clear();
+  cfrom.d_rows.clear();
+  cfrom.d_numWords = 0;
+}
+
+bool XorPropagator::addRow(size_t k, const std::vector<size_t>& cols, bool rhs)
+{
+  Component& comp = d_comps[k];
+  Row row;
+  row.d_bits.resize(comp.d_numWords, 0);
+  row.d_rhs = rhs;
+  row.d_pivot = s_none;
+  row.d_watch = s_none;
+  row.d_comp = k;
+  for (size_t c : cols)
+  {
+    size_t l = d_localCol[c];
+    row.d_bits[l / 64] ^= uint64_t(1) << (l % 64);
+  }
+  // Eliminate the pivot columns of the existing rows. Since a row contains
+  // no other pivot column than its own, a single pass suffices.
+  for (size_t r : comp.d_rows)
+  {
+    const Row& prow = d_rows[r];
+    if (hasColumn(row, prow.d_pivot))
+    {
+      for (size_t i = 0; i < comp.d_numWords; ++i)
+      {
+        row.d_bits[i] ^= prow.d_bits[i];
+      }
+      row.d_rhs ^= prow.d_rhs;
+    }
+  }
+  // Prefer an unassigned column as pivot.
+  size_t pcol = s_none;
+  forEachColumn(row, [&](size_t c) {
+    if (pcol == s_none || d_value[c] == 0)
+    {
+      pcol = c;
+    }
+    return d_value[c] != 0;
+  });
+  if (pcol == s_none)
+  {
+    // The constraint is a linear combination of the existing rows, it is
+    // either redundant (0 = 0) or inconsistent (0 = 1).
+    Trace("prop-xor") << "addRow: " << (row.d_rhs ? "inconsistent" : "redundant")
+                      << std::endl;
+    return !row.d_rhs;
+  }
+  size_t r = d_rows.size();
+  d_rows.emplace_back(std::move(row));
+  d_isDirty.push_back(false);
+  d_isStale.push_back(false);
+  comp.d_rows.push_back(r);
+  pivot(r, pcol);
+  markDirty(r);
+  if (d_value[pcol] != 0)
+  {
+    markStale(r);
+  }
+  return true;
+}
+
+bool XorPropagator::hasColumn(const Row& row, size_t c) const
+{
+  if (c == s_none || d_compOf[c] != row.d_comp)
+  {
+    return false;
+  }
+  size_t l = d_localCol[c];
+  return (row.d_bits[l / 64] >> (l % 64)) & 1;
+}
+
+template <class F>
+void XorPropagator::forEachColumn(const Row& row, F f) const
+{
+  const std::vector<size_t>& cols = d_comps[row.d_comp].d_cols;
+  for (size_t i = 0, nwords = row.d_bits.size(); i < nwords; ++i)
+  {
+    uint64_t w = row.d_bits[i];
+    for (size_t l = 64 * i; w != 0; ++l, w >>= 1)
+    {
+      if ((w & 1) && !f(cols[l]))
+      {
+        return;
+      }
+    }
+  }
+}
+
+void XorPropagator::pivot(size_t r, size_t c)
+{
+  ++d_stats.d_pivots;
+  Row& prow = d_rows[r];
+  Assert(hasColumn(prow, c));
+  if (prow.d_pivot != s_none)
+  {
+    d_pivotRow[prow.d_pivot] = s_none;
+  }
+  prow.d_pivot = c;
+  d_pivotRow[c] = r;
+  const Component& comp = d_comps[prow.d_comp];
+  for (size_t r2 : comp.d_rows)
+  {
+    Row& row = d_rows[r2];
+    if (r2 != r && hasColumn(row, c))
+    {
+      for (size_t i = 0; i < comp.d_numWords; ++i)
+      {
+        row.d_bits[i] ^= prow.d_bits[i];
+      }
+      row.d_rhs ^= prow.d_rhs;
+      markDirty(r2);
+    }
+  }
+}
+
+void XorPropagator::repivot(size_t r)
+{
+  const Row& row = d_rows[r];
+  if (d_value[row.d_pivot] == 0)
+  {
+    return;
+  }
+  markDirty(r);
+  size_t pcol = s_none;
+  forEachColumn(row, [&](size_t c) {
+    if (d_value[c] == 0)
+    {
+      pcol = c;
+    }
+    return pcol == s_none;
+  });
+  if (pcol != s_none)
+  {
+    pivot(r, pcol);
+    return;
+  }
+  // no unassigned column left, repaired after the next backtrack
+  markStale(r);
+}
+
+void XorPropagator::markDirty(size_t r)
+{
+  if (!d_isDirty[r])
+  {
+    d_isDirty[r] = true;
+    d_dirty.push_back(r);
+  }
+}
+
+void XorPropagator::markStale(size_t r)
+{
+  if (!d_isStale[r])
+  {
+    d_isStale[r] = true;
+    d_stale.push_back(r);
+  }
+}
+
+bool XorPropagator::checkRow(size_t r,
+                             std::vector<SatLiteral>& props,
+                             SatClause& conflict)
+{
+  Row& row = d_rows[r];
+  size_t unassigned = 0;
+  size_t ucol = s_none;
+  size_t watch = s_none;
+  bool parity = false;
+  forEachColumn(row, [&](size_t c) {
+    if (d_value[c] == 0)
+    {
+      ++unassigned;
+      ucol = c;
+      if (c != row.d_pivot)
+      {
+        watch = c;
+      }
+    }
+    else
+    {
+      parity ^= d_value[c] > 0;
+    }
+    // the pivot and an unassigned column suffice
+    return unassigned < 2 || watch == s_none;
+  });
+  if (unassigned >= 2)
+  {
+    Assert(watch != s_none);
+    if (row.d_watch != watch)
+    {
+      row.d_watch = watch;
+      d_watches[watch].push_back(r);
+    }
+    return true;
+  }
+  // At most one unassigned column, the row is checked again after the next
+  // backtrack.
+  row.d_watch = s_none;
+  markStale(r);
+  if (unassigned == 0 && parity == row.d_rhs)
+  {
+    return true;
+  }
+  // The clause consisting of the literals of the row that are false in the
+  // current assignment.
+  SatClause clause;
+  if (unassigned == 1)
+  {
+    SatVariable var = d_vars[ucol];
+    if (d_reasons.find(var) != d_reasons.end())
+    {
+      // already propagated
+      return true;
+    }
+    clause.emplace_back(var, parity == row.d_rhs);
+  }
+  forEachColumn(row, [&](size_t c) {
+    if (d_value[c] != 0)
+    {
+      clause.emplace_back(d_vars[c], d_value[c] > 0);
+    }
+    return true;
+  });
+  if (unassigned == 0)
+  {
+    Trace("prop-xor") << "conflict: " << clause << std::endl;
+    ++d_stats.d_conflicts;
+    conflict = std::move(clause);
+    return false;
+  }
+  Trace("prop-xor") << "propagate: " << clause[0] << std::endl;
+  ++d_stats.d_propagations;
+  props.push_back(clause[0]);
+  d_pending.push_back(clause[0].getSatVariable());
+  d_reasons[clause[0].getSatVariable()] = std::move(clause);
+  return true;
+}
+
+XorPropagator::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_xors(sr.registerInt("XorPropagator::xors")),
+      d_rebuilds(sr.registerInt("XorPropagator::rebuilds")),
+      d_merges(sr.registerInt("XorPropagator::merges")),
+      d_pivots(sr.registerInt("XorPropagator::pivots")),
+      d_propagations(sr.registerInt("XorPropagator::propagations")),
+      d_conflicts(sr.registerInt("XorPropagator::conflicts"))
+{
+}
+
+}  // namespace prop
+}  // namespace cvc5::internal
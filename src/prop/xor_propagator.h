@@ -0,0 +1,265 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gauss-Jordan elimination based propagator for XOR constraints.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__PROP__XOR_PROPAGATOR_H
+#define CVC5__PROP__XOR_PROPAGATOR_H
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "prop/sat_solver_types.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+
+class StatisticsRegistry;
+
+namespace prop {
+
+/**
+ * Propagator for XOR constraints over SAT variables.
+ *
+ * The XOR constraints x_1 ^ ... ^ x_n = rhs added via addXor() are kept as a
+ * matrix over GF(2) in reduced row echelon form, i.e., every row has a pivot
+ * column that does not occur in any other row. This propagator keeps the
+ * pivot of each row unassigned (if possible) by re-pivoting the row whenever
+ * its pivot is assigned (Gauss-Jordan elimination). As a consequence, a row
+ * with exactly one unassigned column propagates that column, and a row
+ * without unassigned columns whose parity does not match its right-hand side
+ * is a conflict. Since every row is a linear combination of the added XOR
+ * constraints, it is implied by them, and so are the reason and conflict
+ * clauses derived from it.
+ *
+ * The matrix is split into the connected components of the variable
+ * occurrence graph of the constraints. Each component has its own columns and
+ * rows, so that pivoting only touches the rows of one component. Besides its
+ * pivot, every row watches one other unassigned column, and is only checked
+ * when its pivot or its watched column is assigned. The size of a component
+ * can be bounded, see canAddXor().
+ *
+ * Assignments are not backtracked by this class, the matrix is an equivalent
+ * system of the added constraints in any SAT context. The SAT solver notifies
+ * this class about (un)assignments via assign() and unassign().
+ *
+ * XOR constraints are associated with the user level they were added in.
+ * When popping a user level, the matrix is rebuilt from the constraints of
+ * the remaining levels.
+ */
+class XorPropagator
+{
+ public:
+  /**
+   * @param sr The registry of the statistics.
+   * @param maxComponentSize The maximal number of columns of a component, or
+   *                         0 if unbounded.
+   */
+  XorPropagator(StatisticsRegistry& sr, size_t maxComponentSize = 0);
+  ~XorPropagator();
+
+  /**
+   * Returns true if adding the XOR constraint over lits keeps the number of
+   * columns of its component within the maximal component size. Constraints
+   * for which this returns false must not be added via addXor().
+   */
+  bool canAddXor(const SatClause& lits) const;
+
+  /**
+   * Add XOR constraint lits[0] ^ ... ^ lits[n-1] = rhs.
+   * @param lits The literals of the constraint.
+   * @param rhs The right-hand side.
+   * @param level The user level in which the constraint is added.
+   * @return False if the constraint is inconsistent with the previously
+   *         added XOR constraints.
+   */
+  bool addXor(const SatClause& lits, bool rhs, uint32_t level);
+  /** Returns true if var occurs in an XOR constraint. */
+  bool isXorVar(SatVariable var) const;
+  /** Returns true if no XOR constraints have been added. */
+  bool empty() const;
+  /** Notify that lit was assigned to true. */
+  void assign(SatLiteral lit);
+  /** Notify that var was unassigned. */
+  void unassign(SatVariable var);
+  /**
+   * Notify that the SAT solver backtracked. Discards the reasons of pending
+   * propagations that were not assigned.
+   */
+  void notifyBacktrack();
+  /**
+   * Process the assignments since the last call.
+   * @param props The literals propagated by the XOR constraints.
+   * @param conflict The conflict clause, if any.
+   * @return False if a conflict was found.
+   */
+  bool propagate(std::vector<SatLiteral>& props, SatClause& conflict);
+  /**
+   * Get the reason clause for literal lit that was propagated by propagate().
+   * The first literal of the reason is lit.
+   */
+  void explain(SatLiteral lit, SatClause& reason) const;
+  /**
+   * Check whether a full assignment satisfies all XOR constraints.
+   * @param value Returns the value of a variable in the assignment.
+   * @param conflict The clause excluding the assignment, if it is violated.
+   * @return False if an XOR constraint is violated.
+   */
+  bool check(const std::function<bool(SatVariable)>& value,
+             SatClause& conflict) const;
+  /**
+   * Pop user levels until the given level. Removes the XOR constraints added
+   * in popped levels and rebuilds the matrix.
+   */
+  void userPop(uint32_t level);
+
+ private:
+  /** An XOR constraint as added via addXor(), with normalized variables. */
+  struct Xor
+  {
+    std::vector<SatVariable> d_vars;
+    bool d_rhs;
+    uint32_t d_level;
+  };
+  /** Marks the absence of a pivot row or column. */
+  static constexpr size_t s_none = static_cast<size_t>(-1);
+  /** A row of the matrix. */
+  struct Row
+  {
+    /** The bit vector of the local columns of its component. */
+    std::vector<uint64_t> d_bits;
+    /** The right-hand side. */
+    bool d_rhs;
+    /** The pivot column. */
+    size_t d_pivot;
+    /** The watched unassigned non-pivot column, or s_none if none. */
+    size_t d_watch;
+    /** The component of the row. */
+    size_t d_comp;
+  };
+  /** A connected component of the matrix. */
+  struct Component
+  {
+    /** The columns of the component, by local column. */
+    std::vector<size_t> d_cols;
+    /** The rows of the component. */
+    std::vector<size_t> d_rows;
+    /** The number of words of each row of the component. */
+    size_t d_numWords = 0;
+  };
+  /** Add the matrix row for XOR constraint x. */
+  bool addConstraint(const Xor& x);
+  /** Get the column of var, allocating a new one if necessary. */
+  size_t getColumn(SatVariable var);
+  /** Add column c that is in no component to component k. */
+  void addColumn(size_t k, size_t c);
+  /** Move the columns and rows of component from to component to. */
+  void merge(size_t to, size_t from);
+  /** Add a row for the XOR of the given columns of component k. */
+  bool addRow(size_t k, const std::vector<size_t>& cols, bool rhs);
+  /** Returns true if row contains column c. */
+  bool hasColumn(const Row& row, size_t c) const;
+  /**
+   * Call f for each column of row, in the order of the local columns, until
+   * it returns false.
+   */
+  template <class F>
+  void forEachColumn(const Row& row, F f) const;
+  /**
+   * Make column c the pivot of row r and eliminate it from all other rows of
+   * its component.
+   */
+  void pivot(size_t r, size_t c);
+  /**
+   * Try to replace the assigned pivot of row r by an unassigned column.
+   * Marks all modified rows as dirty.
+   */
+  void repivot(size_t r);
+  /** Mark row r to be checked by propagate(). */
+  void markDirty(size_t r);
+  /** Mark row r to be repaired after the next backtrack. */
+  void markStale(size_t r);
+  /**
+   * Check row r for propagations and conflicts, and update its watched
+   * column.
+   * @return False if a conflict was found.
+   */
+  bool checkRow(size_t r, std::vector<SatLiteral>& props, SatClause& conflict);
+  /** The XOR constraints, in the order they were added. */
+  std::vector<Xor> d_xors;
+  /** Maps variables to columns. */
+  std::unordered_map<SatVariable, size_t> d_colOf;
+  /** Maps columns to variables. */
+  std::vector<SatVariable> d_vars;
+  /** The value of each column: 0 if unassigned, 1 if true, -1 if false. */
+  std::vector<int8_t> d_value;
+  /** The row of which each column is the pivot, or s_none if none. */
+  std::vector<size_t> d_pivotRow;
+  /** The component of each column, or s_none if none. */
+  std::vector<size_t> d_compOf;
+  /** The local column of each column in its component. */
+  std::vector<size_t> d_localCol;
+  /**
+   * The rows that watch each column. Entries are removed lazily, a row r in
+   * d_watches[c] only watches c if d_rows[r].d_watch == c.
+   */
+  std::vector<std::vector<size_t>> d_watches;
+  /** The rows of the matrix. */
+  std::vector<Row> d_rows;
+  /** The components of the matrix, merged components are left empty. */
+  std::vector<Component> d_comps;
+  /** The maximal number of columns of a component, 0 if unbounded. */
+  size_t d_maxComponentSize;
+  /** The columns assigned since the last call to propagate(). */
+  std::vector<size_t> d_queue;
+  /** The rows to check in the next call to propagate(). */
+  std::vector<size_t> d_dirty;
+  /** Whether each row is in d_dirty. */
+  std::vector<bool> d_isDirty;
+  /**
+   * Rows with at most one unassigned column, whose pivot or watched column
+   * could not be kept unassigned.
+   */
+  std::vector<size_t> d_stale;
+  /** Whether each row is in d_stale. */
+  std::vector<bool> d_isStale;
+  /** Whether a variable was unassigned since the stale rows were repaired. */
+  bool d_needRepair;
+  /** The reasons of propagated literals, by variable. */
+  std::unordered_map<SatVariable, SatClause> d_reasons;
+  /** The variables propagated since the last backtrack. */
+  std::vector<SatVariable> d_pending;
+  /** Statistics about XOR reasoning */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of XOR constraints added */
+    IntStat d_xors;
+    /** Number of rebuilds of the matrix on user pops */
+    IntStat d_rebuilds;
+    /** Number of merges of components */
+    IntStat d_merges;
+    /** Number of pivot operations */
+    IntStat d_pivots;
+    /** Number of literals propagated */
+    IntStat d_propagations;
+    /** Number of conflicts found */
+    IntStat d_conflicts;
+  };
+  Statistics d_stats;
+};
+
+}  // namespace prop
+}  // namespace cvc5::internal
+
+#endif
@@ -28,6 +28,7 @@
 #include "options/strings_options.h"
 #include "printer/printer.h"
 #include "proof/conv_proof_generator.h"
+#include "smt/profiler.h"
 #include "smt/proof_manager.h"
 #include "smt/solver_engine_stats.h"
 #include "theory/evaluator.h"
@@ -94,6 +95,11 @@ void Env::finishInit(smt::PfManager* pm)
   {
     d_ochecker.reset(new theory::quantifiers::OracleChecker(*this));
   }
+  if (!d_options.base.profileFile.empty())
+  {
+    d_profiler.reset(new Profiler(
+        d_nm, d_options.base.profileFile, d_options.base.profileMetric));
+  }
 }
 
 void Env::shutdown()
@@ -157,6 +163,8 @@ ResourceManager* Env::getResourceManager() const
   return d_resourceManager.get();
 }
 
+Profiler* Env::getProfiler() const { return d_profiler.get(); }
+
 bool Env::isOutputOn(OutputTag tag) const
 {
   return d_options.base.outputTagHolder[static_cast<size_t>(tag)];
@@ -41,6 +41,7 @@ class Plugin;
 class ProofLogger;
 class ProofNodeManager;
 class Printer;
+class Profiler;
 class ResourceManager;
 namespace options {
 enum class OutputTag;
@@ -148,6 +149,9 @@ class Env
   /** Get the resource manager owned by this Env. */
   ResourceManager* getResourceManager() const;
 
+  /** Get the profiler owned by this Env, or nullptr if --profile is not set. */
+  Profiler* getProfiler() const;
+
   /** Get the logic information currently set. */
   const LogicInfo& getLogicInfo() const;
 
@@ -399,6 +403,8 @@ class Env
   Options d_options;
   /** Manager for limiting time and abstract resource usage. */
   std::unique_ptr<ResourceManager> d_resourceManager;
+  /** The profiler, if enabled. */
+  std::unique_ptr<Profiler> d_profiler;
   /** The theory that owns the uninterpreted sort. */
   theory::TheoryId d_uninterpretedSortOwner;
   /** The separation logic location and data types */
@@ -72,6 +72,8 @@ ResourceManager* EnvObj::resourceManager() const
   return d_env.getResourceManager();
 }
 
+Profiler* EnvObj::profiler() const { return d_env.getProfiler(); }
+
 StatisticsRegistry& EnvObj::statisticsRegistry() const
 {
   return d_env.getStatisticsRegistry();
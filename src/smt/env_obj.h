@@ -34,6 +34,7 @@ class Env;
 class LogicInfo;
 class NodeManager;
 class Options;
+class Profiler;
 class StatisticsRegistry;
 
 namespace options {
@@ -95,6 +96,9 @@ class EnvObj
   /** Get the resource manager owned by this Env. */
   ResourceManager* resourceManager() const;
 
+  /** Get the profiler owned by this Env, or nullptr if disabled. */
+  Profiler* profiler() const;
+
   /** Get the current logic information. */
   const LogicInfo& logicInfo() const;
 
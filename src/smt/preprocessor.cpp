@@ -24,6 +24,7 @@
 #include "smt/assertions.h"
 #include "smt/env.h"
 #include "smt/preprocess_proof_generator.h"
+#include "smt/profiler.h"
 #include "theory/rewriter.h"
 
 using namespace std;
@@ -83,7 +84,11 @@ bool Preprocessor::process(preprocessing::AssertionPipeline& ap)
   }
 
   // process the assertions, return true if no conflict is discovered
-  bool noConflict = d_processor.apply(ap);
+  bool noConflict;
+  {
+    Profiler::Scope preprocessScope(profiler(), "preprocess");
+    noConflict = d_processor.apply(ap);
+  }
 
   // now, post-process the assertions
 
@@ -0,0 +1,161 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Attribution of solver costs to nested solver components.
+ */
+
+#include "smt/profiler.h"
+
+#include <fstream>
+
+#include "base/check.h"
+#include "base/output.h"
+#include "expr/node_manager.h"
+
+namespace cvc5::internal {
+
+Profiler::Frame::Frame(const std::string& name, size_t parent)
+    : d_name(name),
+      d_parent(parent),
+      d_time(Clock::duration::zero()),
+      d_nodes(0),
+      d_lemmas(0)
+{
+}
+
+Profiler::Profiler(NodeManager* nm,
+                   const std::string& filename,
+                   options::ProfileMetric metric)
+    : d_nm(nm), d_filename(filename), d_metric(metric), d_current(0)
+{
+  d_frames.emplace_back("cvc5", 0);
+}
+
+Profiler::~Profiler() { writeFile(); }
+
+void Profiler::writeFile() const
+{
+  if (d_filename.empty())
+  {
+    return;
+  }
+  std::ofstream out(d_filename, std::ios::out | std::ios::trunc);
+  if (!out)
+  {
+    // cannot use warning() here, the environment may be destroyed already
+    Trace("profiler") << "Cannot open profile file " << d_filename
+                      << std::endl;
+    return;
+  }
+  write(out);
+}
+
+void Profiler::notifyLemma() { d_frames[d_current].d_lemmas++; }
+
+void Profiler::enter(const std::string& name)
+{
+  std::map<std::string, size_t>& children = d_frames[d_current].d_children;
+  std::map<std::string, size_t>::iterator it = children.find(name);
+  size_t next;
+  if (it == children.end())
+  {
+    next = d_frames.size();
+    children[name] = next;
+    d_frames.emplace_back(name, d_current);
+  }
+  else
+  {
+    next = it->second;
+  }
+  d_current = next;
+  d_entries.emplace_back(Clock::now(), d_nm->getNumNodesCreated());
+}
+
+void Profiler::exit()
+{
+  Assert(d_current != 0 && !d_entries.empty());
+  Frame& f = d_frames[d_current];
+  f.d_time += Clock::now() - d_entries.back().first;
+  f.d_nodes += d_nm->getNumNodesCreated() - d_entries.back().second;
+  d_entries.pop_back();
+  d_current = f.d_parent;
+}
+
+uint64_t Profiler::getSelfCost(size_t i) const
+{
+  const Frame& f = d_frames[i];
+  if (d_metric == options::ProfileMetric::LEMMAS)
+  {
+    return f.d_lemmas;
+  }
+  // the inclusive costs of nested scopes never exceed the cost of the scope
+  Clock::duration time = f.d_time;
+  uint64_t nodes = f.d_nodes;
+  for (const std::pair<const std::string, size_t>& c : f.d_children)
+  {
+    time -= d_frames[c.second].d_time;
+    nodes -= d_frames[c.second].d_nodes;
+  }
+  if (d_metric == options::ProfileMetric::NODES)
+  {
+    return nodes;
+  }
+  int64_t us =
+      std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+  return us > 0 ? static_cast<uint64_t>(us) : 0;
+}
+
+void Profiler::writeStack(std::ostream& out, size_t i) const
+{
+  if (i != 0)
+  {
+    writeStack(out, d_frames[i].d_parent);
+    out << ";";
+  }
+  out << d_frames[i].d_name;
+}
+
+void Profiler::write(std::ostream& out) const
+{
+  for (size_t i = 0, nframes = d_frames.size(); i < nframes; i++)
+  {
+    uint64_t cost = getSelfCost(i);
+    if (cost > 0)
+    {
+      writeStack(out, i);
+      out << " " << cost << std::endl;
+    }
+  }
+}
+
+Profiler::Scope::Scope(Profiler* p, const char* name) : d_profiler(p)
+{
+  if (d_profiler != nullptr)
+  {
+    d_profiler->enter(name);
+  }
+}
+
+Profiler::Scope::Scope(Profiler* p, const std::string& name) : d_profiler(p)
+{
+  if (d_profiler != nullptr)
+  {
+    d_profiler->enter(name);
+  }
+}
+
+Profiler::Scope::~Scope()
+{
+  if (d_profiler != nullptr)
+  {
+    d_profiler->exit();
+  }
+}
+
+}  // namespace cvc5::internal
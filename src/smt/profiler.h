@@ -0,0 +1,131 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Attribution of solver costs to nested solver components.
+ */
+
+#include "cvc5_private.h"
+
+#ifndef CVC5__SMT__PROFILER_H
+#define CVC5__SMT__PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "options/base_options.h"
+
+namespace cvc5::internal {
+
+class NodeManager;
+
+/**
+ * Attributes the costs of solving to the components of the solver.
+ *
+ * Components mark the code they want to be profiled with a Profiler::Scope.
+ * Scopes nest, and costs are recorded per stack of scopes, where the wall
+ * clock time and the number of allocated nodes of a scope are attributed to
+ * the innermost open scope. Lemmas sent by the theory engine are attributed
+ * to the innermost open scope via notifyLemma().
+ *
+ * On destruction, the recorded costs for the metric given by
+ * --profile-metric are written to the file given by --profile in the folded
+ * stack format of flame graph tools, i.e. one line of the form
+ *   <scope>;<scope>;...;<scope> <cost>
+ * for each stack of scopes with nonzero cost.
+ */
+class Profiler
+{
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  /**
+   * @param nm The node manager, for counting allocated nodes.
+   * @param filename The file the profile is written to by writeFile() and on
+   *        destruction. If empty, the profile is not written.
+   * @param metric The metric that is written.
+   */
+  Profiler(NodeManager* nm,
+           const std::string& filename,
+           options::ProfileMetric metric);
+  ~Profiler();
+
+  /** Notify that a lemma was sent. */
+  void notifyLemma();
+  /** Write the recorded costs to out, in the folded stack format. */
+  void write(std::ostream& out) const;
+  /**
+   * Write the recorded costs to the file given on construction, if any. The
+   * file is overwritten, hence this can be called whenever the profile should
+   * be up to date, e.g. before the process may exit without destroying the
+   * solver.
+   */
+  void writeFile() const;
+
+  /**
+   * A scope of the profiler. Does nothing if the given profiler is null,
+   * hence components can open scopes unconditionally.
+   */
+  class Scope
+  {
+   public:
+    Scope(Profiler* p, const char* name);
+    Scope(Profiler* p, const std::string& name);
+    ~Scope();
+
+   private:
+    Profiler* d_profiler;
+  };
+
+ private:
+  /** A stack of scopes, identified by its innermost scope. */
+  struct Frame
+  {
+    Frame(const std::string& name, size_t parent);
+    /** The name of the innermost scope */
+    std::string d_name;
+    /** The frame of the enclosing scopes */
+    size_t d_parent;
+    /** The frames for scopes opened within this one, by name */
+    std::map<std::string, size_t> d_children;
+    /** Total time spent in this scope, including nested scopes */
+    Clock::duration d_time;
+    /** Total number of nodes allocated in this scope, including nested scopes */
+    uint64_t d_nodes;
+    /** Number of lemmas sent directly in this scope */
+    uint64_t d_lemmas;
+  };
+  /** Enter the scope with the given name. */
+  void enter(const std::string& name);
+  /** Exit the innermost scope. */
+  void exit();
+  /** Get the cost of frame i excluding nested scopes. */
+  uint64_t getSelfCost(size_t i) const;
+  /** Write the stack of frame i to out. */
+  void writeStack(std::ostream& out, size_t i) const;
+  /** The node manager, for counting allocated nodes */
+  NodeManager* d_nm;
+  /** The file the profile is written to */
+  std::string d_filename;
+  /** The metric that is written */
+  options::ProfileMetric d_metric;
+  /** All frames, where frame 0 is the root */
+  std::vector<Frame> d_frames;
+  /** The time and node count at the entry of each open scope */
+  std::vector<std::pair<Clock::time_point, uint64_t>> d_entries;
+  /** The frame of the innermost open scope */
+  size_t d_current;
+};
+
+}  // namespace cvc5::internal
+
+#endif
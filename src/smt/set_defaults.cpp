@@ -415,6 +415,12 @@ void SetDefaults::setDefaultsPre(Options& opts)
                            deepRestartMode,
                            options::DeepRestartMode::NONE,
                            "internal subsolver");
+    // internal subsolvers must not overwrite the files written by the main
+    // solver
+    SET_AND_NOTIFY_VAL_SYM(
+        base, profileFile, std::string(), "internal subsolver");
+    SET_AND_NOTIFY_VAL_SYM(
+        prop, satStatsTrace, std::string(), "internal subsolver");
   }
 }
 
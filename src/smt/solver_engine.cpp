@@ -57,6 +57,7 @@
 #include "smt/model_blocker.h"
 #include "smt/model_core_builder.h"
 #include "smt/preprocessor.h"
+#include "smt/profiler.h"
 #include "smt/proof_manager.h"
 #include "smt/quant_elim_solver.h"
 #include "smt/set_defaults.h"
@@ -843,6 +844,14 @@ Result SolverEngine::checkSatInternal(const std::vector<Node>& assumptions)
     printStatisticsDiff();
   }
 
+  // Write the profile after each query, since the driver may exit without
+  // destroying this solver (see --early-exit).
+  Profiler* profiler = d_env->getProfiler();
+  if (profiler != nullptr)
+  {
+    profiler->writeFile();
+  }
+
   // set the filename on the result
   const std::string& filename = d_env->getOptions().driver.filename;
   return Result(r, filename);
@@ -1528,6 +1537,14 @@ std::vector<Node> SolverEngine::getLearnedLiterals(modes::LearnedLitType t)
   return pe->getLearnedZeroLevelLiterals(t);
 }
 
+std::vector<Node> SolverEngine::getLearnedClauses()
+{
+  Trace("smt") << "SMT getLearnedClauses()" << std::endl;
+  PropEngine* pe = d_smtSolver->getPropEngine();
+  Assert(pe != nullptr);
+  return pe->getLearnedClauses();
+}
+
 void SolverEngine::checkProof()
 {
   Assert(d_env->getOptions().smt.produceProofs);
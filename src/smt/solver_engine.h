@@ -257,6 +257,12 @@ class CVC5_EXPORT SolverEngine
    */
   std::vector<Node> getLearnedLiterals(modes::LearnedLitType t);
 
+  /**
+   * Get the list of short clauses learned by the SAT solver that are entailed
+   * by the current set of assertions.
+   */
+  std::vector<Node> getLearnedClauses();
+
   /**
    * Get an aspect of the current SMT execution environment.
    * @throw OptionException
@@ -0,0 +1,229 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A sparse floating point tableau with compressed rows.
+ */
+
+#include "theory/arith/linear/compressed_tableau.h"
+
+#include <cmath>
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+/** Entries of smaller magnitude are removed from the tableau. */
+constexpr double s_dropTol = 1e-12;
+
+}  // namespace
+
+CompressedTableau::CompressedTableau() {}
+
+void CompressedTableau::reset(size_t numCols)
+{
+  d_rows.clear();
+  d_columns.assign(numCols, std::vector<ColumnEntry>());
+  d_scatter.assign(numCols, 0);
+}
+
+size_t CompressedTableau::addRow(
+    const std::vector<std::pair<uint32_t, double>>& entries)
+{
+  size_t row = d_rows.size();
+  d_rows.emplace_back();
+  Row& r = d_rows.back();
+  r.d_cols.reserve(entries.size());
+  r.d_coeffs.reserve(entries.size());
+  r.d_colPos.reserve(entries.size());
+  for (const std::pair<uint32_t, double>& e : entries)
+  {
+    Assert(e.second != 0.0);
+    addEntry(row, e.first, e.second);
+  }
+  return row;
+}
+
+size_t CompressedTableau::getNumEntries() const
+{
+  size_t n = 0;
+  for (const Row& r : d_rows)
+  {
+    n += r.d_cols.size();
+  }
+  return n;
+}
+
+double CompressedTableau::getCoefficient(size_t row, size_t col) const
+{
+  const Row& r = d_rows[row];
+  for (size_t i = 0, len = r.d_cols.size(); i < len; ++i)
+  {
+    if (r.d_cols[i] == col)
+    {
+      return r.d_coeffs[i];
+    }
+  }
+  return 0.0;
+}
+
+double CompressedTableau::dot(size_t row, const std::vector<double>& x) const
+{
+  const Row& r = d_rows[row];
+  const uint32_t* cols = r.d_cols.data();
+  const double* coeffs = r.d_coeffs.data();
+  double res = 0.0;
+  for (size_t i = 0, len = r.d_cols.size(); i < len; ++i)
+  {
+    res += coeffs[i] * x[cols[i]];
+  }
+  return res;
+}
+
+void CompressedTableau::addRowTimesConstantTo(std::vector<double>& target,
+                                              size_t row,
+                                              double mult) const
+{
+  const Row& r = d_rows[row];
+  const uint32_t* cols = r.d_cols.data();
+  const double* coeffs = r.d_coeffs.data();
+  for (size_t i = 0, len = r.d_cols.size(); i < len; ++i)
+  {
+    target[cols[i]] += mult * coeffs[i];
+  }
+}
+
+void CompressedTableau::addEntry(size_t row, uint32_t col, double coeff)
+{
+  Row& r = d_rows[row];
+  std::vector<ColumnEntry>& c = d_columns[col];
+  c.push_back({static_cast<uint32_t>(row),
+               static_cast<uint32_t>(r.d_cols.size())});
+  r.d_cols.push_back(col);
+  r.d_coeffs.push_back(coeff);
+  r.d_colPos.push_back(c.size() - 1);
+}
+
+void CompressedTableau::removeEntry(size_t row, size_t pos)
+{
+  Row& r = d_rows[row];
+  // remove the occurrence from the column list by moving the last occurrence
+  // of the column into its place
+  std::vector<ColumnEntry>& c = d_columns[r.d_cols[pos]];
+  uint32_t cpos = r.d_colPos[pos];
+  Assert(c[cpos].d_row == row && c[cpos].d_pos == pos);
+  const ColumnEntry& lastOcc = c.back();
+  d_rows[lastOcc.d_row].d_colPos[lastOcc.d_pos] = cpos;
+  c[cpos] = lastOcc;
+  c.pop_back();
+  // remove the entry from the row by moving the last entry into its place
+  size_t last = r.d_cols.size() - 1;
+  if (pos != last)
+  {
+    r.d_cols[pos] = r.d_cols[last];
+    r.d_coeffs[pos] = r.d_coeffs[last];
+    r.d_colPos[pos] = r.d_colPos[last];
+    d_columns[r.d_cols[pos]][r.d_colPos[pos]].d_pos = pos;
+  }
+  r.d_cols.pop_back();
+  r.d_coeffs.pop_back();
+  r.d_colPos.pop_back();
+}
+
+void CompressedTableau::rowPlusRowTimesConstant(size_t to,
+                                                size_t from,
+                                                double mult)
+{
+  Assert(to != from);
+  Row& t = d_rows[to];
+  const Row& f = d_rows[from];
+  size_t oldLen = t.d_cols.size();
+  for (size_t i = 0; i < oldLen; ++i)
+  {
+    d_scatter[t.d_cols[i]] = i + 1;
+  }
+  for (size_t i = 0, len = f.d_cols.size(); i < len; ++i)
+  {
+    uint32_t col = f.d_cols[i];
+    uint32_t pos = d_scatter[col];
+    if (pos != 0)
+    {
+      t.d_coeffs[pos - 1] += mult * f.d_coeffs[i];
+    }
+    else
+    {
+      addEntry(to, col, mult * f.d_coeffs[i]);
+    }
+  }
+  for (size_t i = 0; i < oldLen; ++i)
+  {
+    d_scatter[t.d_cols[i]] = 0;
+  }
+  // remove the entries that cancelled out
+  for (size_t i = 0; i < t.d_cols.size();)
+  {
+    if (std::fabs(t.d_coeffs[i]) < s_dropTol)
+    {
+      removeEntry(to, i);
+    }
+    else
+    {
+      ++i;
+    }
+  }
+}
+
+void CompressedTableau::pivot(size_t row, size_t col, size_t leaving)
+{
+  // the occurrences of col on the other rows stay valid until the rows are
+  // updated, as each row is updated once
+  d_pivotRows = d_columns[col];
+  Row& r = d_rows[row];
+  size_t pos = 0;
+  for (const ColumnEntry& e : d_pivotRows)
+  {
+    if (e.d_row == row)
+    {
+      pos = e.d_pos;
+      break;
+    }
+  }
+  Assert(pos < r.d_cols.size() && r.d_cols[pos] == col);
+  double a = r.d_coeffs[pos];
+  Assert(a != 0.0);
+  // solve the row for col, i.e. x_col = (x_leaving - sum_c a_c x_c) / a
+  removeEntry(row, pos);
+  for (double& coeff : r.d_coeffs)
+  {
+    coeff = -coeff / a;
+  }
+  addEntry(row, leaving, 1.0 / a);
+
+  // substitute it into the other rows, which removes col from the tableau
+  for (const ColumnEntry& e : d_pivotRows)
+  {
+    if (e.d_row == row)
+    {
+      continue;
+    }
+    Assert(d_rows[e.d_row].d_cols[e.d_pos] == col);
+    double mult = d_rows[e.d_row].d_coeffs[e.d_pos];
+    removeEntry(e.d_row, e.d_pos);
+    rowPlusRowTimesConstant(e.d_row, row, mult);
+  }
+  Assert(d_columns[col].empty());
+  d_pivotRows.clear();
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
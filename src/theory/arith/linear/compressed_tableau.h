@@ -0,0 +1,127 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A sparse floating point tableau with compressed rows.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/**
+ * A sparse matrix of doubles in solved form, for pivoting in floating point.
+ *
+ * Unlike Matrix, whose entries are linked into rows and columns, each row
+ * stores its columns and coefficients in contiguous arrays, and each column
+ * stores the list of rows it occurs in together with the position of the
+ * entry on the row. Each entry on a row in turn knows its position in the
+ * column list, so entries are read and removed in constant time. Rows are
+ * updated by scattering the positions of the target row into a dense buffer,
+ * such that adding a multiple of a row is linear in the length of both rows.
+ * Entries whose magnitude drops below a tolerance are removed.
+ *
+ * Row i represents the equation x_{b_i} = sum_c getCoefficient(i, c) x_c,
+ * where b_i is the basic column of the row, which is not stored. The basic
+ * columns are tracked by the user of this class.
+ */
+class CompressedTableau
+{
+ public:
+  /** An occurrence of a column, i.e. the entry at d_pos on row d_row. */
+  struct ColumnEntry
+  {
+    uint32_t d_row;
+    uint32_t d_pos;
+  };
+
+  CompressedTableau();
+
+  /** Removes all rows and sets the number of columns. */
+  void reset(size_t numCols);
+  /**
+   * Adds a row with the given entries, which must have distinct columns and
+   * nonzero coefficients. Returns the index of the row.
+   */
+  size_t addRow(const std::vector<std::pair<uint32_t, double>>& entries);
+
+  size_t getNumRows() const { return d_rows.size(); }
+  size_t getNumColumns() const { return d_columns.size(); }
+  /** Returns the number of nonzero entries. */
+  size_t getNumEntries() const;
+  /** Returns the number of nonzero entries on the given row. */
+  size_t getRowLength(size_t row) const { return d_rows[row].d_cols.size(); }
+  /** Returns the occurrences of the given column. */
+  const std::vector<ColumnEntry>& getColumn(size_t col) const
+  {
+    return d_columns[col];
+  }
+  /** Returns the coefficient of an occurrence returned by getColumn. */
+  double getCoefficient(const ColumnEntry& e) const
+  {
+    return d_rows[e.d_row].d_coeffs[e.d_pos];
+  }
+  /** Returns the entry at row and col, or 0. */
+  double getCoefficient(size_t row, size_t col) const;
+  /** Returns the dot product of the given row with x. */
+  double dot(size_t row, const std::vector<double>& x) const;
+  /** target += mult * row, where target is dense. */
+  void addRowTimesConstantTo(std::vector<double>& target,
+                             size_t row,
+                             double mult) const;
+  /**
+   * Solves the given row for column col, which must have a nonzero entry on
+   * the row, and substitutes the result into all other rows. Afterwards, col
+   * is the basic column of the row, and leaving, which was the basic column
+   * of the row before, occurs in the tableau.
+   */
+  void pivot(size_t row, size_t col, size_t leaving);
+
+ private:
+  /** A row in compressed form. */
+  struct Row
+  {
+    /** The columns of the entries */
+    std::vector<uint32_t> d_cols;
+    /** The coefficients of the entries, in the order of d_cols */
+    std::vector<double> d_coeffs;
+    /** The positions of the entries in their column lists */
+    std::vector<uint32_t> d_colPos;
+  };
+  /** Appends an entry to the given row and to the list of its column. */
+  void addEntry(size_t row, uint32_t col, double coeff);
+  /** Removes the entry at position pos from the given row and its column. */
+  void removeEntry(size_t row, size_t pos);
+  /** to += mult * from, removing entries that cancel out. */
+  void rowPlusRowTimesConstant(size_t to, size_t from, double mult);
+
+  /** The rows */
+  std::vector<Row> d_rows;
+  /** The occurrences of each column */
+  std::vector<std::vector<ColumnEntry>> d_columns;
+  /**
+   * For each column, its position plus one in the row currently being
+   * updated, or zero. Only nonzero during rowPlusRowTimesConstant.
+   */
+  std::vector<uint32_t> d_scatter;
+  /** The occurrences of the pivot column, copied during a pivot */
+  std::vector<ColumnEntry> d_pivotRows;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
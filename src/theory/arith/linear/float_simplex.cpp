@@ -0,0 +1,373 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A floating point simplex for finding candidate bases.
+ */
+
+#include "theory/arith/linear/float_simplex.h"
+
+#include <cmath>
+#include <limits>
+
+#include "base/output.h"
+#include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/tableau.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+/** The value substituted for delta when approximating bounds. */
+constexpr double s_delta = 1e-9;
+/** The relative tolerance for satisfying bounds. */
+constexpr double s_feasibilityTol = 1e-9;
+/** The tolerance for reduced costs. */
+constexpr double s_costTol = 1e-9;
+/** The smallest magnitude of a pivot element. */
+constexpr double s_pivotTol = 1e-7;
+/** The number of pivots between recomputations of the basic values. */
+constexpr int64_t s_refreshPeriod = 64;
+/**
+ * The number of consecutive degenerate steps after which Bland's rule is
+ * used, to prevent cycling.
+ */
+constexpr int64_t s_degenerateLimit = 50;
+constexpr double s_infinity = std::numeric_limits<double>::infinity();
+
+/** The tolerance for a value being at the given (possibly infinite) bound. */
+double tolerance(double bound)
+{
+  return std::isinf(bound) ? 0.0
+                           : s_feasibilityTol * (1.0 + std::fabs(bound));
+}
+
+}  // namespace
+
+FloatSimplex::FloatSimplex(Env& env,
+                           const ArithVariables& vars,
+                           const Tableau& tableau)
+    : EnvObj(env),
+      d_vars(vars),
+      d_tableau(tableau),
+      d_numCols(0),
+      d_statistics(statisticsRegistry())
+{
+}
+
+FloatSimplex::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_calls(sr.registerInt("theory::arith::float::calls")),
+      d_feasible(sr.registerInt("theory::arith::float::feasible")),
+      d_infeasible(sr.registerInt("theory::arith::float::infeasible")),
+      d_pivots(sr.registerInt("theory::arith::float::pivots")),
+      d_boundFlips(sr.registerInt("theory::arith::float::boundFlips")),
+      d_time(sr.registerTimer("theory::arith::float::time"))
+{
+}
+
+void FloatSimplex::load()
+{
+  d_colToVar.clear();
+  d_varToCol.assign(d_vars.getNumberOfVariables(),
+                    std::numeric_limits<size_t>::max());
+  for (ArithVariables::var_iterator vi = d_vars.var_begin(),
+                                    vi_end = d_vars.var_end();
+       vi != vi_end;
+       ++vi)
+  {
+    d_varToCol[*vi] = d_colToVar.size();
+    d_colToVar.push_back(*vi);
+  }
+  d_numCols = d_colToVar.size();
+
+  d_matrix.reset(d_numCols);
+  d_basic.clear();
+  d_rowOf.assign(d_numCols, -1);
+  // the tableau is traced in a format that can be replayed by the unit tests
+  // of CompressedTableau
+  Trace("arith::float-tableau") << "tableau " << d_numCols << std::endl;
+  std::vector<std::pair<uint32_t, double>> entries;
+  for (Tableau::BasicIterator bi = d_tableau.beginBasic(),
+                              bi_end = d_tableau.endBasic();
+       bi != bi_end;
+       ++bi)
+  {
+    ArithVar b = *bi;
+    entries.clear();
+    Trace("arith::float-tableau") << "row " << d_varToCol[b];
+    for (Tableau::RowIterator ri = d_tableau.basicRowIterator(b); !ri.atEnd();
+         ++ri)
+    {
+      const Tableau::Entry& e = *ri;
+      if (e.getColVar() != b)
+      {
+        entries.emplace_back(d_varToCol[e.getColVar()],
+                             e.getCoefficient().getDouble());
+        Trace("arith::float-tableau") << " " << d_varToCol[e.getColVar()]
+                                      << ":" << e.getCoefficient();
+      }
+    }
+    Trace("arith::float-tableau") << std::endl;
+    d_rowOf[d_varToCol[b]] = d_matrix.addRow(entries);
+    d_basic.push_back(d_varToCol[b]);
+  }
+
+  d_lower.resize(d_numCols);
+  d_upper.resize(d_numCols);
+  d_value.resize(d_numCols);
+  d_position.assign(d_numCols, Position::ORIGINAL);
+  for (size_t c = 0; c < d_numCols; ++c)
+  {
+    ArithVar v = d_colToVar[c];
+    d_lower[c] = d_vars.hasLowerBound(v)
+                     ? d_vars.getLowerBound(v).approx(s_delta)
+                     : -s_infinity;
+    d_upper[c] = d_vars.hasUpperBound(v)
+                     ? d_vars.getUpperBound(v).approx(s_delta)
+                     : s_infinity;
+    d_value[c] = d_vars.getAssignment(v).approx(s_delta);
+  }
+  computeBasicValues();
+}
+
+void FloatSimplex::computeBasicValues()
+{
+  for (size_t row = 0, nrows = d_basic.size(); row < nrows; ++row)
+  {
+    d_value[d_basic[row]] = d_matrix.dot(row, d_value);
+  }
+}
+
+int FloatSimplex::violation(size_t c) const
+{
+  if (d_value[c] < d_lower[c] - tolerance(d_lower[c]))
+  {
+    return -1;
+  }
+  if (d_value[c] > d_upper[c] + tolerance(d_upper[c]))
+  {
+    return 1;
+  }
+  return 0;
+}
+
+bool FloatSimplex::selectEntering(bool bland, size_t& col, int& dir)
+{
+  // the reduced costs of the sum of infeasibilities of the basic variables
+  d_reducedCost.assign(d_numCols, 0.0);
+  for (size_t row = 0, nrows = d_basic.size(); row < nrows; ++row)
+  {
+    int cost = violation(d_basic[row]);
+    if (cost != 0)
+    {
+      d_matrix.addRowTimesConstantTo(d_reducedCost, row, cost);
+    }
+  }
+  double best = s_costTol;
+  bool found = false;
+  for (size_t c = 0; c < d_numCols; ++c)
+  {
+    double d = d_reducedCost[c];
+    if (d_rowOf[c] >= 0 || std::fabs(d) <= best)
+    {
+      continue;
+    }
+    // increasing (resp. decreasing) the column decreases the infeasibility
+    bool increase = d < 0;
+    bool canMove = increase
+                       ? d_value[c] < d_upper[c] - tolerance(d_upper[c])
+                       : d_value[c] > d_lower[c] + tolerance(d_lower[c]);
+    if (canMove)
+    {
+      col = c;
+      dir = increase ? 1 : -1;
+      found = true;
+      if (bland)
+      {
+        break;
+      }
+      best = std::fabs(d);
+    }
+  }
+  return found;
+}
+
+LinResult FloatSimplex::findModel(int64_t pivotLimit)
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_time);
+  ++d_statistics.d_calls;
+  load();
+  int64_t degenerate = 0;
+  for (int64_t steps = 0;; ++steps)
+  {
+    if (steps > 0 && steps % s_refreshPeriod == 0)
+    {
+      computeBasicValues();
+    }
+    bool feasible = true;
+    for (size_t b : d_basic)
+    {
+      if (!std::isfinite(d_value[b]))
+      {
+        Trace("arith::float") << "numerically unstable" << std::endl;
+        return LinUnknown;
+      }
+      feasible = feasible && violation(b) == 0;
+    }
+    if (feasible)
+    {
+      Trace("arith::float") << "feasible after " << steps << std::endl;
+      ++d_statistics.d_feasible;
+      return LinFeasible;
+    }
+    size_t col = 0;
+    int dir = 0;
+    if (!selectEntering(degenerate > s_degenerateLimit, col, dir))
+    {
+      // the sum of infeasibilities is at a minimum
+      Trace("arith::float") << "infeasible after " << steps << std::endl;
+      ++d_statistics.d_infeasible;
+      return LinInfeasible;
+    }
+    if (steps >= pivotLimit)
+    {
+      return LinExhausted;
+    }
+
+    // the ratio test, where the step is limited by the bounds of the entering
+    // column and by the first bound reached by a basic variable
+    double theta = dir > 0 ? d_upper[col] - d_value[col]
+                           : d_value[col] - d_lower[col];
+    int64_t leavingRow = -1;
+    bool leavingAtUpper = false;
+    double leavingAlpha = 0.0;
+    for (const CompressedTableau::ColumnEntry& e : d_matrix.getColumn(col))
+    {
+      double alpha = dir * d_matrix.getCoefficient(e);
+      if (std::fabs(alpha) <= s_pivotTol)
+      {
+        continue;
+      }
+      size_t b = d_basic[e.d_row];
+      int v = violation(b);
+      double limit;
+      bool atUpper;
+      if (alpha > 0)
+      {
+        if (v < 0)
+        {
+          limit = (d_lower[b] - d_value[b]) / alpha;
+          atUpper = false;
+        }
+        else if (v > 0 || d_upper[b] == s_infinity)
+        {
+          continue;
+        }
+        else
+        {
+          limit = (d_upper[b] - d_value[b]) / alpha;
+          atUpper = true;
+        }
+      }
+      else
+      {
+        if (v > 0)
+        {
+          limit = (d_value[b] - d_upper[b]) / -alpha;
+          atUpper = true;
+        }
+        else if (v < 0 || d_lower[b] == -s_infinity)
+        {
+          continue;
+        }
+        else
+        {
+          limit = (d_value[b] - d_lower[b]) / -alpha;
+          atUpper = false;
+        }
+      }
+      limit = std::max(limit, 0.0);
+      if (limit < theta
+          || (limit == theta && leavingRow >= 0
+              && std::fabs(alpha) > leavingAlpha))
+      {
+        theta = limit;
+        leavingRow = e.d_row;
+        leavingAtUpper = atUpper;
+        leavingAlpha = std::fabs(alpha);
+      }
+    }
+    if (theta == s_infinity)
+    {
+      // cannot happen in exact arithmetic, as the infeasible basic variables
+      // limit the step
+      Trace("arith::float") << "unbounded step" << std::endl;
+      return LinUnknown;
+    }
+    degenerate = theta <= s_feasibilityTol ? degenerate + 1 : 0;
+
+    // update the values
+    d_value[col] += dir * theta;
+    for (const CompressedTableau::ColumnEntry& e : d_matrix.getColumn(col))
+    {
+      d_value[d_basic[e.d_row]] += d_matrix.getCoefficient(e) * dir * theta;
+    }
+    if (leavingRow < 0)
+    {
+      // the entering column reached its bound
+      ++d_statistics.d_boundFlips;
+      d_value[col] = dir > 0 ? d_upper[col] : d_lower[col];
+      d_position[col] = dir > 0 ? Position::UPPER : Position::LOWER;
+    }
+    else
+    {
+      ++d_statistics.d_pivots;
+      size_t leaving = d_basic[leavingRow];
+      Trace("arith::float-tableau")
+          << "pivot " << leavingRow << " " << col << std::endl;
+      d_matrix.pivot(leavingRow, col, leaving);
+      d_basic[leavingRow] = col;
+      d_rowOf[col] = leavingRow;
+      d_rowOf[leaving] = -1;
+      d_value[leaving] = leavingAtUpper ? d_upper[leaving] : d_lower[leaving];
+      d_position[leaving] = leavingAtUpper ? Position::UPPER : Position::LOWER;
+    }
+  }
+}
+
+ApproximateSimplex::Solution FloatSimplex::extractSolution() const
+{
+  ApproximateSimplex::Solution sol;
+  for (size_t c = 0; c < d_numCols; ++c)
+  {
+    ArithVar v = d_colToVar[c];
+    if (d_rowOf[c] >= 0)
+    {
+      sol.newBasis.add(v);
+      continue;
+    }
+    switch (d_position[c])
+    {
+      case Position::LOWER:
+        sol.newValues.set(v, d_vars.getLowerBound(v));
+        break;
+      case Position::UPPER:
+        sol.newValues.set(v, d_vars.getUpperBound(v));
+        break;
+      default: sol.newValues.set(v, d_vars.getAssignment(v)); break;
+    }
+  }
+  return sol;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
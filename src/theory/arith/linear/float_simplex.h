@@ -0,0 +1,138 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A floating point simplex for finding candidate bases.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "smt/env_obj.h"
+#include "theory/arith/linear/approx_simplex.h"
+#include "theory/arith/linear/arithvar.h"
+#include "theory/arith/linear/compressed_tableau.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * A primal simplex over double precision copies of the tableau, stored as a
+ * CompressedTableau, and of the bounds of the variables. It minimizes the sum
+ * of infeasibilities of the basic variables, starting from the current basis
+ * and assignment, and moves non-basic variables only to their bounds.
+ *
+ * The result is never trusted: the basis it ends with is returned as an
+ * ApproximateSimplex::Solution, in which every non-basic variable is assigned
+ * its exact bound (or its current assignment if it was never moved). This
+ * solution is imported into the exact tableau by AttemptSolutionSDP, whose
+ * rational pivots verify and repair it.
+ */
+class FloatSimplex : protected EnvObj
+{
+ public:
+  FloatSimplex(Env& env, const ArithVariables& vars, const Tableau& tableau);
+
+  /**
+   * Runs the simplex on the current tableau, bounds and assignment, using at
+   * most pivotLimit pivots and bound flips. Returns LinFeasible (resp.
+   * LinInfeasible) if the final basis is feasible (resp. infeasible) up to
+   * the floating point tolerances, LinExhausted if the pivot limit was
+   * reached and LinUnknown if the computation became numerically unstable.
+   */
+  LinResult findModel(int64_t pivotLimit);
+
+  /** Returns the basis found by the last call to findModel. */
+  ApproximateSimplex::Solution extractSolution() const;
+
+ private:
+  /** The position of a non-basic variable. */
+  enum class Position
+  {
+    /** at its assignment in the exact tableau */
+    ORIGINAL,
+    /** at its lower bound */
+    LOWER,
+    /** at its upper bound */
+    UPPER
+  };
+  /** Copies the tableau, the bounds and the assignment. */
+  void load();
+  /** Recomputes the values of the basic variables from the non-basic ones. */
+  void computeBasicValues();
+  /**
+   * Returns -1 (resp. 1) if column c is below (resp. above) its bounds, and 0
+   * otherwise. This is the derivative of the infeasibility of c.
+   */
+  int violation(size_t c) const;
+  /**
+   * Selects the non-basic column whose reduced cost decreases the sum of
+   * infeasibilities the most (or, if bland is true, the first such column).
+   * Returns false if there is no such column, otherwise sets col and dir to
+   * the column and the direction it moves in.
+   */
+  bool selectEntering(bool bland, size_t& col, int& dir);
+
+  /** The variables, for the bounds and the assignment */
+  const ArithVariables& d_vars;
+  /** The exact tableau */
+  const Tableau& d_tableau;
+  /** The arithmetic variable of each column */
+  std::vector<ArithVar> d_colToVar;
+  /** The column of each arithmetic variable */
+  std::vector<size_t> d_varToCol;
+  /** The floating point tableau, one row for each basic variable */
+  CompressedTableau d_matrix;
+  /** The number of columns of d_matrix */
+  size_t d_numCols;
+  /** The column of the basic variable of each row */
+  std::vector<size_t> d_basic;
+  /** The row of each column if it is basic, or -1 */
+  std::vector<int64_t> d_rowOf;
+  /** The lower bound of each column, or -infinity */
+  std::vector<double> d_lower;
+  /** The upper bound of each column, or +infinity */
+  std::vector<double> d_upper;
+  /** The value of each column */
+  std::vector<double> d_value;
+  /** The position of each non-basic column */
+  std::vector<Position> d_position;
+  /** The reduced costs of the sum of infeasibilities, for each column */
+  std::vector<double> d_reducedCost;
+
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of calls to findModel */
+    IntStat d_calls;
+    /** Number of calls that found a feasible basis */
+    IntStat d_feasible;
+    /** Number of calls that found an infeasible basis */
+    IntStat d_infeasible;
+    /** Total number of pivots */
+    IntStat d_pivots;
+    /** Total number of bound flips */
+    IntStat d_boundFlips;
+    /** Time spent in findModel */
+    TimerStat d_time;
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
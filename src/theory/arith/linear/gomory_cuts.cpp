@@ -0,0 +1,205 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gomory mixed-integer cuts from the exact tableau.
+ */
+
+#include "theory/arith/linear/gomory_cuts.h"
+
+#include <algorithm>
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "theory/arith/delta_rational.h"
+#include "theory/arith/linear/partial_model.h"
+#include "theory/arith/linear/tableau.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+GomoryCuts::GomoryCuts(Env& env,
+                       const ArithVariables& vars,
+                       const Tableau& tableau)
+    : EnvObj(env),
+      d_vars(vars),
+      d_tableau(tableau),
+      d_pool(context()),
+      d_rounds(context(), 0),
+      d_statistics(statisticsRegistry())
+{
+}
+
+GomoryCuts::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_rounds(sr.registerInt("theory::arith::gmi::rounds")),
+      d_cuts(sr.registerInt("theory::arith::gmi::cuts")),
+      d_notAtBounds(sr.registerInt("theory::arith::gmi::notAtBounds")),
+      d_duplicates(sr.registerInt("theory::arith::gmi::duplicates"))
+{
+}
+
+bool GomoryCuts::hasRoundsLeft() const
+{
+  return d_rounds.get() < options().arith.arithGmiCutRounds;
+}
+
+std::vector<ArithVar> GomoryCuts::startRound(size_t max)
+{
+  d_rounds = d_rounds.get() + 1;
+  ++d_statistics.d_rounds;
+
+  // the distance of the assignment to the nearest integer
+  std::vector<std::pair<Rational, ArithVar>> candidates;
+  for (Tableau::BasicIterator bi = d_tableau.beginBasic(),
+                              bi_end = d_tableau.endBasic();
+       bi != bi_end;
+       ++bi)
+  {
+    ArithVar b = *bi;
+    const DeltaRational& a = d_vars.getAssignment(b);
+    if (!d_vars.isInteger(b) || a.isIntegral())
+    {
+      continue;
+    }
+    const Rational& q = a.getNoninfinitesimalPart();
+    Rational f = q - Rational(q.floor());
+    Rational g = Rational(1) - f;
+    candidates.emplace_back(f < g ? f : g, b);
+  }
+  std::sort(candidates.begin(),
+            candidates.end(),
+            [](const std::pair<Rational, ArithVar>& x,
+               const std::pair<Rational, ArithVar>& y) {
+              return x.first > y.first
+                     || (x.first == y.first && x.second < y.second);
+            });
+  std::vector<ArithVar> rows;
+  for (size_t i = 0, n = std::min(max, candidates.size()); i < n; ++i)
+  {
+    rows.push_back(candidates[i].second);
+  }
+  return rows;
+}
+
+bool GomoryCuts::generate(ArithVar basic, Cut& cut)
+{
+  Assert(d_tableau.isBasic(basic));
+  Assert(d_vars.isInteger(basic));
+
+  std::vector<ArithVar> vars;
+  std::vector<bool> atLower;
+  std::vector<Rational> bounds;
+  std::vector<Rational> coeffs;
+  std::vector<bool> integral;
+  Rational rhs(0);
+  for (Tableau::RowIterator ri = d_tableau.basicRowIterator(basic);
+       !ri.atEnd();
+       ++ri)
+  {
+    const Tableau::Entry& e = *ri;
+    ArithVar v = e.getColVar();
+    if (v == basic)
+    {
+      continue;
+    }
+    bool lower =
+        d_vars.hasLowerBound(v) && d_vars.cmpAssignmentLowerBound(v) == 0;
+    bool upper = !lower && d_vars.hasUpperBound(v)
+                 && d_vars.cmpAssignmentUpperBound(v) == 0;
+    if (!lower && !upper)
+    {
+      ++d_statistics.d_notAtBounds;
+      return false;
+    }
+    // The bound of a strict inequality is weakened to its real part, which
+    // is implied by it.
+    const DeltaRational& bound =
+        lower ? d_vars.getLowerBound(v) : d_vars.getUpperBound(v);
+    const Rational& k = bound.getNoninfinitesimalPart();
+    const Rational& a = e.getCoefficient();
+    rhs += a * k;
+    vars.push_back(v);
+    atLower.push_back(lower);
+    bounds.push_back(k);
+    // x_b - a * y = ... at a lower bound, x_b + a * y = ... at an upper one
+    coeffs.push_back(lower ? -a : a);
+    integral.push_back(d_vars.isInteger(v) && bound.infinitesimalIsZero()
+                       && k.isIntegral());
+  }
+  if (rhs.isIntegral())
+  {
+    return false;
+  }
+
+  // sum_j g_j y_j >= 1 where y_j = x_j - k_j, or k_j - x_j at an upper bound
+  std::vector<Rational> gmi = computeGmi(rhs, coeffs, integral);
+  cut.lhs.purge();
+  cut.rhs = Rational(1);
+  cut.explanation.clear();
+  for (size_t i = 0, n = vars.size(); i < n; ++i)
+  {
+    if (gmi[i].isZero())
+    {
+      continue;
+    }
+    ArithVar v = vars[i];
+    Rational c = atLower[i] ? gmi[i] : -gmi[i];
+    cut.lhs.set(v, c);
+    cut.rhs += c * bounds[i];
+    cut.explanation.push_back(atLower[i] ? d_vars.getLowerBoundConstraint(v)
+                                         : d_vars.getUpperBoundConstraint(v));
+  }
+  Trace("arith::gmi") << "cut from the row of " << basic << " with "
+                      << cut.explanation.size() << " bounds" << std::endl;
+  ++d_statistics.d_cuts;
+  return true;
+}
+
+bool GomoryCuts::addToPool(TNode lit)
+{
+  if (d_pool.contains(lit))
+  {
+    ++d_statistics.d_duplicates;
+    return false;
+  }
+  d_pool.insert(lit);
+  return true;
+}
+
+std::vector<Rational> GomoryCuts::computeGmi(
+    const Rational& rhs,
+    const std::vector<Rational>& coeffs,
+    const std::vector<bool>& integral)
+{
+  Assert(coeffs.size() == integral.size());
+  Rational f0 = rhs - Rational(rhs.floor());
+  Rational g0 = Rational(1) - f0;
+  Assert(f0.sgn() > 0);
+  std::vector<Rational> cut;
+  cut.reserve(coeffs.size());
+  for (size_t j = 0, n = coeffs.size(); j < n; ++j)
+  {
+    const Rational& a = coeffs[j];
+    if (integral[j])
+    {
+      Rational fj = a - Rational(a.floor());
+      cut.push_back(fj <= f0 ? fj / f0 : (Rational(1) - fj) / g0);
+    }
+    else
+    {
+      cut.push_back(a.sgn() >= 0 ? a / f0 : -a / g0);
+    }
+  }
+  return cut;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Gomory mixed-integer cuts from the exact tableau.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "context/cdhashset.h"
+#include "context/cdo.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "theory/arith/linear/arithvar.h"
+#include "theory/arith/linear/constraint_forward.h"
+#include "util/dense_map.h"
+#include "util/rational.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class ArithVariables;
+class Tableau;
+
+/**
+ * Derives Gomory mixed-integer (GMI) cuts from the rows of the exact tableau.
+ *
+ * Let x_b be an integer basic variable whose row is x_b = sum_j a_j x_j.
+ * If every non-basic x_j is at one of its bounds k_j, substituting
+ * x_j = k_j + s_j y_j, where s_j is 1 at a lower bound and -1 at an upper
+ * bound, gives x_b - sum_j a_j s_j y_j = sum_j a_j k_j with y_j >= 0. If
+ * the right hand side is not integral, the GMI cut of this row is violated
+ * by the current assignment (y = 0) and is satisfied by every assignment
+ * respecting the bounds and the integrality of the variables.
+ *
+ * The cuts are stored in a pool that depends on the SAT context, which is
+ * used to avoid deriving the same cut twice on a branch of the search. The
+ * number of rounds of cuts on a branch is limited by --gmi-cut-rounds.
+ */
+class GomoryCuts : protected EnvObj
+{
+ public:
+  GomoryCuts(Env& env, const ArithVariables& vars, const Tableau& tableau);
+
+  /** The cut sum_v lhs[v] * v >= rhs and the bounds it is implied by. */
+  struct Cut
+  {
+    DenseMap<Rational> lhs;
+    Rational rhs;
+    ConstraintCPVec explanation;
+  };
+
+  /** Returns true if another round of cuts may be done in this context. */
+  bool hasRoundsLeft() const;
+  /**
+   * Starts a round of cuts. Returns the integer basic variables with a
+   * non-integral assignment, most fractional first, and at most max of them.
+   */
+  std::vector<ArithVar> startRound(size_t max);
+  /**
+   * Derives the cut from the row of basic. Returns false if no cut exists
+   * for this row, i.e. if a non-basic variable of the row is not at one of
+   * its bounds or if the right hand side of the row is integral.
+   */
+  bool generate(ArithVar basic, Cut& cut);
+  /**
+   * Adds the (rewritten) cut literal to the pool. Returns false if it was
+   * already in the pool in this context.
+   */
+  bool addToPool(TNode lit);
+
+  /**
+   * Computes the GMI cut sum_j cut[j] * y_j >= 1 of the row
+   * x_b + sum_j coeffs[j] * y_j = rhs, where x_b is an integer, y_j >= 0
+   * and y_j is an integer if integral[j] is true. The fractional part of rhs
+   * must be nonzero.
+   */
+  static std::vector<Rational> computeGmi(const Rational& rhs,
+                                          const std::vector<Rational>& coeffs,
+                                          const std::vector<bool>& integral);
+
+ private:
+  /** The variables, for the bounds and the assignment */
+  const ArithVariables& d_vars;
+  /** The exact tableau */
+  const Tableau& d_tableau;
+  /** The cut literals derived on the current branch */
+  context::CDHashSet<Node> d_pool;
+  /** The number of rounds of cuts on the current branch */
+  context::CDO<uint64_t> d_rounds;
+
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of rounds of cuts */
+    IntStat d_rounds;
+    /** Number of rows a cut was derived from */
+    IntStat d_cuts;
+    /** Number of rows with a non-basic variable strictly between bounds */
+    IntStat d_notAtBounds;
+    /** Number of cuts that were already in the pool */
+    IntStat d_duplicates;
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,458 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Solving systems of integer equalities by Hermite normal form.
+ */
+
+#include "theory/arith/linear/hermite_solver.h"
+
+#include <algorithm>
+
+#include "base/output.h"
+#include "expr/node_builder.h"
+#include "expr/skolem_manager.h"
+#include "options/arith_options.h"
+#include "theory/arith/linear/normal_form.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+/** The maximum bit length of the coefficients of the parametric solution. */
+constexpr uint32_t s_maxCoefficientLength = 512;
+
+}  // namespace
+
+IncrementalHnf::IncrementalHnf(uint32_t maxLength)
+    : d_maxLength(maxLength), d_numRows(0)
+{
+}
+
+void IncrementalHnf::clear()
+{
+  d_columns.clear();
+  d_numRows = 0;
+  d_conflict.clear();
+  d_row.clear();
+  d_trail.clear();
+  d_rowTrail.clear();
+}
+
+size_t IncrementalHnf::getNumParameters() const
+{
+  size_t n = 0;
+  for (const Column& col : d_columns)
+  {
+    n += col.d_pivot ? 0 : 1;
+  }
+  return n;
+}
+
+std::vector<Integer> IncrementalHnf::getSolution() const
+{
+  std::vector<Integer> x(d_columns.size());
+  for (const Column& col : d_columns)
+  {
+    if (!col.d_pivot)
+    {
+      continue;
+    }
+    for (const std::pair<const size_t, Integer>& e : col.d_entries)
+    {
+      x[e.first] += e.second * col.d_value;
+    }
+  }
+  return x;
+}
+
+std::vector<std::map<size_t, Integer>> IncrementalHnf::getParameters() const
+{
+  std::vector<std::map<size_t, Integer>> params;
+  for (const Column& col : d_columns)
+  {
+    if (!col.d_pivot)
+    {
+      params.push_back(col.d_definition);
+    }
+  }
+  return params;
+}
+
+namespace {
+
+/**
+ * Adds mult * from to to, where both are sparse vectors. Returns false if an
+ * entry of the result is longer than maxLength.
+ */
+bool addMultiple(std::map<size_t, Integer>& to,
+                 const std::map<size_t, Integer>& from,
+                 const Integer& mult,
+                 uint32_t maxLength)
+{
+  bool fits = true;
+  for (const std::pair<const size_t, Integer>& e : from)
+  {
+    Integer& entry = to[e.first];
+    entry += mult * e.second;
+    if (entry.isZero())
+    {
+      to.erase(e.first);
+    }
+    else if (entry.length() > maxLength)
+    {
+      fits = false;
+    }
+  }
+  return fits;
+}
+
+}  // namespace
+
+bool IncrementalHnf::addToColumn(size_t to, size_t from, const Integer& mult)
+{
+  Assert(to != from);
+  Column& t = d_columns[to];
+  Column& f = d_columns[from];
+  bool fits = addMultiple(t.d_entries, f.d_entries, mult, d_maxLength);
+  return addMultiple(f.d_definition, t.d_definition, -mult, d_maxLength)
+         && fits;
+}
+
+void IncrementalHnf::negateColumn(size_t c)
+{
+  Column& col = d_columns[c];
+  for (std::pair<const size_t, Integer>& e : col.d_entries)
+  {
+    e.second = -e.second;
+  }
+  for (std::pair<const size_t, Integer>& e : col.d_definition)
+  {
+    e.second = -e.second;
+  }
+}
+
+void IncrementalHnf::popRow()
+{
+  Assert(d_numRows > 0);
+  --d_numRows;
+  d_conflict.clear();
+  size_t start = d_rowTrail.back();
+  d_rowTrail.pop_back();
+  while (d_trail.size() > start)
+  {
+    const Op& op = d_trail.back();
+    Column& col = d_columns[op.d_col];
+    switch (op.d_kind)
+    {
+      case OpKind::ADD_COLUMN:
+        Assert(op.d_col + 1 == d_columns.size());
+        d_columns.pop_back();
+        break;
+      case OpKind::ADD_TO_COLUMN:
+        addToColumn(op.d_col, op.d_from, -op.d_mult);
+        break;
+      case OpKind::NEGATE_COLUMN: negateColumn(op.d_col); break;
+      case OpKind::MAKE_PIVOT:
+        col.d_pivot = false;
+        col.d_value = Integer();
+        col.d_rows.clear();
+        break;
+    }
+    d_trail.pop_back();
+  }
+}
+
+IncrementalHnf::Result IncrementalHnf::addRow(
+    const std::vector<std::pair<size_t, Integer>>& coeffs, const Integer& rhs)
+{
+  Assert(d_conflict.empty());
+  size_t row = d_numRows++;
+  d_rowTrail.push_back(d_trail.size());
+  for (const std::pair<size_t, Integer>& c : coeffs)
+  {
+    while (d_columns.size() <= c.first)
+    {
+      size_t var = d_columns.size();
+      d_columns.emplace_back();
+      d_columns.back().d_entries[var] = Integer(1);
+      d_columns.back().d_definition[var] = Integer(1);
+      d_trail.push_back({OpKind::ADD_COLUMN, var, 0, Integer()});
+    }
+  }
+  d_row.resize(d_columns.size());
+  for (const std::pair<size_t, Integer>& c : coeffs)
+  {
+    d_row[c.first] = c.second;
+  }
+
+  // the coefficients of the row in terms of y, i.e. (a U)_c
+  Integer residual = rhs;
+  std::vector<size_t> rows{row};
+  std::vector<std::pair<size_t, Integer>> free;
+  for (size_t c = 0, n = d_columns.size(); c < n; ++c)
+  {
+    const Column& col = d_columns[c];
+    Integer s;
+    for (const std::pair<const size_t, Integer>& e : col.d_entries)
+    {
+      const Integer& a = d_row[e.first];
+      if (!a.isZero())
+      {
+        s += a * e.second;
+      }
+    }
+    if (s.isZero())
+    {
+      continue;
+    }
+    if (col.d_pivot)
+    {
+      residual -= s * col.d_value;
+      rows.insert(rows.end(), col.d_rows.begin(), col.d_rows.end());
+    }
+    else
+    {
+      free.emplace_back(c, s);
+    }
+  }
+  for (const std::pair<size_t, Integer>& c : coeffs)
+  {
+    d_row[c.first] = Integer();
+  }
+
+  // combine the free columns until a single one has a nonzero coefficient
+  bool fits = true;
+  while (free.size() > 1)
+  {
+    size_t min = 0;
+    for (size_t i = 1, n = free.size(); i < n; ++i)
+    {
+      if (free[i].second.abs() < free[min].second.abs())
+      {
+        min = i;
+      }
+    }
+    const Integer am = free[min].second;
+    size_t cm = free[min].first;
+    for (size_t i = 0, n = free.size(); i < n; ++i)
+    {
+      if (i == min)
+      {
+        continue;
+      }
+      Integer q = free[i].second.floorDivideQuotient(am);
+      fits = addToColumn(free[i].first, cm, -q) && fits;
+      d_trail.push_back({OpKind::ADD_TO_COLUMN, free[i].first, cm, -q});
+      free[i].second -= q * am;
+    }
+    free.erase(std::remove_if(free.begin(),
+                              free.end(),
+                              [](const std::pair<size_t, Integer>& f) {
+                                return f.second.isZero();
+                              }),
+               free.end());
+  }
+
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+  if (free.empty())
+  {
+    if (!residual.isZero())
+    {
+      d_conflict = rows;
+      return Result::INFEASIBLE;
+    }
+    return fits ? Result::FEASIBLE : Result::TOO_LARGE;
+  }
+  Integer g = free[0].second;
+  Column& pivot = d_columns[free[0].first];
+  if (g.sgn() < 0)
+  {
+    g = -g;
+    negateColumn(free[0].first);
+    d_trail.push_back({OpKind::NEGATE_COLUMN, free[0].first, 0, Integer()});
+  }
+  if (!g.divides(residual))
+  {
+    d_conflict = rows;
+    return Result::INFEASIBLE;
+  }
+  pivot.d_pivot = true;
+  pivot.d_value = residual.exactQuotient(g);
+  pivot.d_rows = std::move(rows);
+  d_trail.push_back({OpKind::MAKE_PIVOT, free[0].first, 0, Integer()});
+  fits = fits && pivot.d_value.length() <= d_maxLength;
+  return fits ? Result::FEASIBLE : Result::TOO_LARGE;
+}
+
+HermiteSolver::HermiteSolver(Env& env)
+    : EnvObj(env),
+      d_inputConstraints(context()),
+      d_processed(context(), 0),
+      d_hnf(s_maxCoefficientLength),
+      d_result(IncrementalHnf::Result::FEASIBLE),
+      d_gaveUp(false),
+      d_decompositionLemmaQueue(context()),
+      d_queued(context()),
+      d_statistics(statisticsRegistry())
+{
+}
+
+HermiteSolver::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_calls(sr.registerInt("theory::arith::hnf::calls")),
+      d_conflicts(sr.registerInt("theory::arith::hnf::conflicts")),
+      d_rowsPopped(sr.registerInt("theory::arith::hnf::rowsPopped")),
+      d_decompositions(sr.registerInt("theory::arith::hnf::decompositions")),
+      d_gaveUp(sr.registerInt("theory::arith::hnf::gaveUp")),
+      d_time(sr.registerTimer("theory::arith::hnf::time"))
+{
+}
+
+void HermiteSolver::pushInputConstraint(const Comparison& eq, Node reason)
+{
+  Assert(eq.debugIsIntegral());
+  Assert(eq.getNode().getKind() == Kind::EQUAL);
+
+  SumPair sp = eq.toSumPair();
+  if (sp.isNonlinear())
+  {
+    return;
+  }
+  // sp represents the equality p + c = 0
+  InputConstraint ic;
+  Polynomial p = sp.getPolynomial();
+  for (Polynomial::iterator i = p.begin(), end = p.end(); i != end; ++i)
+  {
+    Monomial m = *i;
+    Assert(!m.isConstant());
+    Node v = m.getVarList().getHead().getNode();
+    auto it = d_varIndex.find(v);
+    if (it == d_varIndex.end())
+    {
+      it = d_varIndex.emplace(v, d_vars.size()).first;
+      d_vars.push_back(v);
+    }
+    ic.d_coeffs.emplace_back(it->second,
+                             m.getConstant().getValue().getNumerator());
+  }
+  ic.d_rhs = -sp.getConstant().getValue().getNumerator();
+  ic.d_reason = reason;
+  Trace("arith::hnf") << "pushInputConstraint " << eq.getNode() << " "
+                      << reason << std::endl;
+  d_inputConstraints.push_back(ic);
+}
+
+Node HermiteSolver::processEquationsForConflict()
+{
+  TimerStat::CodeTimer codeTimer(d_statistics.d_time);
+  ++d_statistics.d_calls;
+
+  if (d_hnf.getNumRows() > d_processed.get())
+  {
+    // undo the rows of the equalities that were backtracked, all remaining
+    // rows were feasible
+    while (d_hnf.getNumRows() > d_processed.get())
+    {
+      ++d_statistics.d_rowsPopped;
+      d_hnf.popRow();
+    }
+    d_result = IncrementalHnf::Result::FEASIBLE;
+  }
+  bool added = false;
+  while (d_result == IncrementalHnf::Result::FEASIBLE
+         && d_hnf.getNumRows() < d_inputConstraints.size())
+  {
+    const InputConstraint& ic = d_inputConstraints[d_hnf.getNumRows()];
+    d_result = d_hnf.addRow(ic.d_coeffs, ic.d_rhs);
+    added = true;
+  }
+  d_processed = d_hnf.getNumRows();
+  if (added && d_result == IncrementalHnf::Result::FEASIBLE
+      && options().arith.exportDioDecompositions)
+  {
+    queueDecompositionLemmas();
+  }
+
+  d_gaveUp = d_result == IncrementalHnf::Result::TOO_LARGE;
+  if (d_gaveUp)
+  {
+    ++d_statistics.d_gaveUp;
+  }
+  if (d_result != IncrementalHnf::Result::INFEASIBLE)
+  {
+    return Node::null();
+  }
+  ++d_statistics.d_conflicts;
+  NodeBuilder nb(nodeManager(), Kind::AND);
+  for (size_t row : d_hnf.getConflict())
+  {
+    Node reason = d_inputConstraints[row].d_reason;
+    if (reason.getKind() == Kind::AND)
+    {
+      nb.append(reason.begin(), reason.end());
+    }
+    else
+    {
+      nb << reason;
+    }
+  }
+  Node conflict = nb.getNumChildren() == 1 ? nb[0] : Node(nb);
+  Trace("arith::hnf") << "conflict " << conflict << std::endl;
+  return conflict;
+}
+
+void HermiteSolver::queueDecompositionLemmas()
+{
+  NodeManager* nm = nodeManager();
+  for (const std::map<size_t, Integer>& param : d_hnf.getParameters())
+  {
+    // a parameter that is a variable itself does not need a definition
+    if (param.size() == 1 && param.begin()->second.abs().isOne())
+    {
+      continue;
+    }
+    std::vector<Node> sum;
+    for (const std::pair<const size_t, Integer>& e : param)
+    {
+      Assert(e.first < d_vars.size());
+      sum.push_back(nm->mkNode(
+          Kind::MULT, nm->mkConstInt(Rational(e.second)), d_vars[e.first]));
+    }
+    Node def = rewrite(sum.size() == 1 ? sum[0] : nm->mkNode(Kind::ADD, sum));
+    if (d_exported.find(def) != d_exported.end()
+        || d_queued.find(def) != d_queued.end())
+    {
+      continue;
+    }
+    d_queued.insert(def);
+    d_decompositionLemmaQueue.push(def);
+  }
+}
+
+Node HermiteSolver::nextDecompositionLemma()
+{
+  Assert(hasMoreDecompositionLemmas());
+  Node def = d_decompositionLemmaQueue.front();
+  d_decompositionLemmaQueue.pop();
+  d_exported.insert(def);
+  ++d_statistics.d_decompositions;
+  // the parameter is an integer, since it is an integer combination of the
+  // variables
+  Node param = SkolemManager::mkPurifySkolem(def);
+  Node lem = param.eqNode(def);
+  Trace("arith::hnf") << "decomposition " << lem << std::endl;
+  return lem;
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,263 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Solving systems of integer equalities by Hermite normal form.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "context/cdhashset.h"
+#include "context/cdlist.h"
+#include "context/cdo.h"
+#include "context/cdqueue.h"
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "util/integer.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+class Comparison;
+
+/**
+ * Decides whether a system of linear equalities A x = b has an integer
+ * solution, where the rows of A are added one at a time.
+ *
+ * The solution set is maintained as x = U y, where U is a unimodular matrix
+ * that is extended and updated by column operations. Every column of U is
+ * either a pivot column, whose y is fixed to a value by one of the rows, or
+ * a free column, whose y is an arbitrary integer. A new row a x = b becomes
+ * (a U) y = b; the free columns are combined by the extended Euclidean
+ * algorithm until a single one has a nonzero coefficient g, which becomes a
+ * pivot column if g divides the right hand side left by the pivot columns.
+ * In other words, A U is kept in (column) Hermite normal form.
+ *
+ * The parametric solution is x = x_0 + sum_{c free} y_c U_c, where x_0 is
+ * the combination of the pivot columns. Since U is unimodular, each free
+ * parameter is the integer combination y_c = V_c x of the variables, where V
+ * is the inverse of U, see getParameters(). U and V are stored sparsely, and
+ * addRow gives up once a coefficient exceeds the given bit length, which
+ * bounds the memory used.
+ *
+ * The column operations of each row are recorded on a trail, so that popRow
+ * can undo them in reverse order.
+ */
+class IncrementalHnf
+{
+ public:
+  enum class Result
+  {
+    /** The rows have an integer solution */
+    FEASIBLE,
+    /** The rows have no integer solution, see getConflict() */
+    INFEASIBLE,
+    /** The coefficients grew beyond the maximum length */
+    TOO_LARGE
+  };
+
+  /** Coefficients longer than maxLength bits are not allowed. */
+  IncrementalHnf(uint32_t maxLength);
+
+  /** Removes all rows and variables. */
+  void clear();
+  /**
+   * Adds the row sum_i coeffs[i].second * x_{coeffs[i].first} = rhs, where
+   * the variables of coeffs are distinct. Must not be called after a result
+   * other than FEASIBLE.
+   */
+  Result addRow(const std::vector<std::pair<size_t, Integer>>& coeffs,
+                const Integer& rhs);
+  /**
+   * Removes the last row, which restores the normal form from before it was
+   * added.
+   */
+  void popRow();
+
+  /** Returns the number of rows added since the last clear(). */
+  size_t getNumRows() const { return d_numRows; }
+  /** Returns the number of free parameters of the solution. */
+  size_t getNumParameters() const;
+  /**
+   * Returns the indices of a set of rows without an integer solution after
+   * addRow returned INFEASIBLE.
+   */
+  const std::vector<size_t>& getConflict() const { return d_conflict; }
+  /** Returns the solution with all free parameters set to zero. */
+  std::vector<Integer> getSolution() const;
+  /**
+   * Returns the free parameters of the solution, each as the coefficients of
+   * the variables in its definition y_c = V_c x.
+   */
+  std::vector<std::map<size_t, Integer>> getParameters() const;
+
+ private:
+  /** A column of U. */
+  struct Column
+  {
+    /** The nonzero entries, by variable */
+    std::map<size_t, Integer> d_entries;
+    /** Whether this is a pivot column */
+    bool d_pivot = false;
+    /** The value of y for a pivot column */
+    Integer d_value;
+    /** The rows that fix the value of a pivot column, sorted */
+    std::vector<size_t> d_rows;
+    /** The nonzero entries of the row of V for this column, by variable */
+    std::map<size_t, Integer> d_definition;
+  };
+  /** The kinds of operations on the columns */
+  enum class OpKind
+  {
+    /** Add the unit column of a new variable */
+    ADD_COLUMN,
+    /** Add a multiple of a column to another one */
+    ADD_TO_COLUMN,
+    /** Negate a column */
+    NEGATE_COLUMN,
+    /** Make a column a pivot column */
+    MAKE_PIVOT
+  };
+  /** An operation on the columns, which popRow undoes. */
+  struct Op
+  {
+    OpKind d_kind;
+    /** The column that is modified */
+    size_t d_col;
+    /** For ADD_TO_COLUMN, the column that is added and its multiple */
+    size_t d_from;
+    Integer d_mult;
+  };
+  /**
+   * Column to += mult * column from, and accordingly row from of V -= mult *
+   * row to of V. Returns false if a result is too long.
+   */
+  bool addToColumn(size_t to, size_t from, const Integer& mult);
+  /** Negate column c, and accordingly row c of V. */
+  void negateColumn(size_t c);
+
+  /** The maximum length of a coefficient */
+  uint32_t d_maxLength;
+  /** The columns of U, initially column i is the unit vector of x_i */
+  std::vector<Column> d_columns;
+  /** The number of rows */
+  size_t d_numRows;
+  /** The conflict, if the last row was infeasible */
+  std::vector<size_t> d_conflict;
+  /** The coefficients of the row being added, by variable */
+  std::vector<Integer> d_row;
+  /** The operations on the columns, in the order they were done */
+  std::vector<Op> d_trail;
+  /** The size of d_trail before each row was added */
+  std::vector<size_t> d_rowTrail;
+};
+
+/**
+ * Finds conflicts in the integer equalities of the dio solver using
+ * IncrementalHnf, see --dio-hnf. The equalities are sat context dependent,
+ * and so is the normal form: it is extended as the equalities are, and the
+ * rows of backtracked equalities are popped.
+ *
+ * With --dio-decomps, the definitions y_c = V_c x of the free parameters of
+ * the solution are exported as lemmas, like the decompositions of the dio
+ * solver, so that the simplex solver can branch on them.
+ */
+class HermiteSolver : protected EnvObj
+{
+ public:
+  HermiteSolver(Env& env);
+
+  /**
+   * Adds an integer equality, with the same requirements as
+   * DioSolver::pushInputConstraint. reason is blamed in a conflict.
+   */
+  void pushInputConstraint(const Comparison& eq, Node reason);
+  /**
+   * Returns a conjunction of the reasons of an infeasible subset of the
+   * equalities if there is one, and null otherwise.
+   */
+  Node processEquationsForConflict();
+  /**
+   * Returns true if the last call to processEquationsForConflict gave up
+   * because of the size of the coefficients.
+   */
+  bool gaveUp() const { return d_gaveUp; }
+
+  /** Returns true if there are definitions of parameters to export. */
+  bool hasMoreDecompositionLemmas() const
+  {
+    return !d_decompositionLemmaQueue.empty();
+  }
+  /** Returns the next lemma y = V_c x that defines a parameter. */
+  Node nextDecompositionLemma();
+
+ private:
+  /** Queue the definitions of the free parameters of d_hnf. */
+  void queueDecompositionLemmas();
+
+  /** An input equality. */
+  struct InputConstraint
+  {
+    std::vector<std::pair<size_t, Integer>> d_coeffs;
+    Integer d_rhs;
+    Node d_reason;
+  };
+  /** The input equalities */
+  context::CDList<InputConstraint> d_inputConstraints;
+  /** The number of input equalities in d_hnf in this context */
+  context::CDO<size_t> d_processed;
+  /** The index of each variable of the input equalities */
+  std::unordered_map<Node, size_t> d_varIndex;
+  /** The variable of each index */
+  std::vector<Node> d_vars;
+  /** The normal form of the first d_processed input equalities */
+  IncrementalHnf d_hnf;
+  /** The result of the last call to d_hnf.addRow */
+  IncrementalHnf::Result d_result;
+  /** See gaveUp() */
+  bool d_gaveUp;
+  /** The definitions of parameters to export */
+  context::CDQueue<Node> d_decompositionLemmaQueue;
+  /** The definitions queued in this context */
+  context::CDHashSet<Node> d_queued;
+  /** The definitions already exported */
+  std::unordered_set<Node> d_exported;
+
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of calls to processEquationsForConflict */
+    IntStat d_calls;
+    /** Number of conflicts found */
+    IntStat d_conflicts;
+    /** Number of rows popped from the normal form after backtracking */
+    IntStat d_rowsPopped;
+    /** Number of definitions of parameters exported */
+    IntStat d_decompositions;
+    /** Number of calls that gave up */
+    IntStat d_gaveUp;
+    /** Time spent in processEquationsForConflict */
+    TimerStat d_time;
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -65,6 +65,7 @@ LinearEqualityModule::LinearEqualityModule(StatisticsRegistry& sr,
       d_negOne(-1),
       d_btracking(boundsTracking),
       d_areTracking(false),
+      d_numPivots(0),
       d_trackCallback(this),
       d_statistics(sr)
 {}
@@ -281,6 +282,7 @@ void LinearEqualityModule::pivotAndUpdate(ArithVar x_i, ArithVar x_j, const Delt
 
   // Pivots
   ++(d_statistics.d_statPivots);
+  ++d_numPivots;
 
   d_tableau.pivot(x_i, x_j, d_trackCallback);
 
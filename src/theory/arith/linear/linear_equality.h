@@ -254,6 +254,9 @@ public:
   /** Specialization of update if the module is not tracking yet (for Simplex). */
   void updateTracked(ArithVar x_i, const DeltaRational& v);
 
+  /** Returns the number of pivots performed so far. */
+  uint64_t getNumPivots() const { return d_numPivots; }
+
 
   /**
    * Updates the value of a basic variable x_i to v,
@@ -419,6 +422,8 @@ private:
    */
   BoundInfoMap& d_btracking;
   bool d_areTracking;
+  /** See getNumPivots() */
+  uint64_t d_numPivots;
 
 public:
   /**
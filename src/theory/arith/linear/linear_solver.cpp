@@ -90,9 +90,11 @@ ArithCongruenceManager* LinearSolver::getCongruenceManager()
   return d_internal.getCongruenceManager();
 }
 
-bool LinearSolver::outputTrustedLemma(TrustNode lemma, InferenceId id)
+bool LinearSolver::outputTrustedLemma(TrustNode lemma,
+                                      InferenceId id,
+                                      LemmaProperty p)
 {
-  return d_im.trustedLemma(lemma, id);
+  return d_im.trustedLemma(lemma, id, p);
 }
 
 void LinearSolver::outputTrustedConflict(TrustNode conf, InferenceId id)
@@ -109,7 +109,9 @@ class LinearSolver : protected EnvObj
   ArithCongruenceManager* getCongruenceManager();
 
   //======================
-  bool outputTrustedLemma(TrustNode lemma, InferenceId id);
+  bool outputTrustedLemma(TrustNode lemma,
+                          InferenceId id,
+                          LemmaProperty p = LemmaProperty::NONE);
   void outputTrustedConflict(TrustNode conf, InferenceId id);
   void outputPropagate(TNode lit);
   void spendResource(Resource r);
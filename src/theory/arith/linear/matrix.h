@@ -659,11 +659,11 @@ public:
       ++i;
 
       if(d_mergeBuffer.isKey(colVar)){
-        EntryID bufferEntry = d_mergeBuffer[colVar].first;
-        Assert(!d_mergeBuffer[colVar].second);
-        d_mergeBuffer.get(colVar).second = true;
+        PosUsedPair& buffered = d_mergeBuffer.get(colVar);
+        Assert(!buffered.second);
+        buffered.second = true;
 
-        const Entry& other = d_entries.get(bufferEntry);
+        const Entry& other = d_entries.get(buffered.first);
         T& coeff = entry.getCoefficient();
         coeff += mult * other.getCoefficient();
 
@@ -680,10 +680,10 @@ public:
       const Entry& entry = *i;
       ArithVar colVar = entry.getColVar();
 
-      if(d_mergeBuffer[colVar].second){
-        d_mergeBuffer.get(colVar).second = false;
+      PosUsedPair& buffered = d_mergeBuffer.get(colVar);
+      if(buffered.second){
+        buffered.second = false;
       }else{
-        Assert(!(d_mergeBuffer[colVar]).second);
         T newCoeff =  mult * entry.getCoefficient();
         addEntry(to, colVar, newCoeff);
       }
@@ -718,11 +718,11 @@ public:
       ++i;
 
       if(d_mergeBuffer.isKey(colVar)){
-        EntryID bufferEntry = d_mergeBuffer[colVar].first;
-        Assert(!d_mergeBuffer[colVar].second);
-        d_mergeBuffer.get(colVar).second = true;
+        PosUsedPair& buffered = d_mergeBuffer.get(colVar);
+        Assert(!buffered.second);
+        buffered.second = true;
 
-        const Entry& other = d_entries.get(bufferEntry);
+        const Entry& other = d_entries.get(buffered.first);
         T& coeff = entry.getCoefficient();
         int coeffOldSgn = coeff.sgn();
         coeff += mult * other.getCoefficient();
@@ -745,10 +745,10 @@ public:
       const Entry& entry = *i;
       ArithVar colVar = entry.getColVar();
 
-      if(d_mergeBuffer[colVar].second){
-        d_mergeBuffer.get(colVar).second = false;
+      PosUsedPair& buffered = d_mergeBuffer.get(colVar);
+      if(buffered.second){
+        buffered.second = false;
       }else{
-        Assert(!(d_mergeBuffer[colVar]).second);
         T newCoeff =  mult * entry.getCoefficient();
         addEntry(to, colVar, newCoeff);
 
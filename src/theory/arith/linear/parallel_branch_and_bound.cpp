@@ -0,0 +1,497 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Branch and bound over worker threads for pure integer problems.
+ */
+
+#include "theory/arith/linear/parallel_branch_and_bound.h"
+
+#include <chrono>
+#include <limits>
+#include <map>
+#ifdef CVC5_PARALLEL_BAB
+#include <thread>
+#endif
+
+#include "base/check.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+/** How often the calling thread checks the limits while it waits */
+constexpr std::chrono::milliseconds s_pollPeriod(10);
+
+}  // namespace
+
+/**
+ * Solves the relaxations of the nodes with a private copy of the tableau.
+ */
+class ParallelBranchAndBound::Worker
+{
+ public:
+  enum class Outcome
+  {
+    /** The relaxation is infeasible, see getConflict() */
+    INFEASIBLE,
+    /** The relaxation has an integral solution, see getValues() */
+    INTEGRAL,
+    /** The solution of the relaxation is not integral, see getBranchVar() */
+    FRACTIONAL
+  };
+
+  Worker(const ParallelBranchAndBound& bab);
+
+  /** Solves the relaxation of node. */
+  Outcome solve(const SearchNode& node);
+
+  /**
+   * Returns the input bounds that make the relaxation infeasible, as pairs
+   * of a variable and whether it is the upper bound.
+   */
+  const std::vector<std::pair<size_t, bool>>& getConflict() const
+  {
+    return d_conflict;
+  }
+  /** Returns the solution of the relaxation. */
+  const std::vector<Rational>& getValues() const { return d_value; }
+  /** Returns a variable with a non-integral value. */
+  size_t getBranchVar() const { return d_branchVar; }
+
+ private:
+  static constexpr size_t s_nonbasic = std::numeric_limits<size_t>::max();
+
+  /** Sets the value of the non-basic variable v and updates the basics. */
+  void updateNonbasic(size_t v, const Rational& value);
+  /** Exchanges the basic variable of row with entering. */
+  void pivot(size_t row, size_t entering);
+  /**
+   * Finds a solution of the rows within the bounds. Returns false and sets
+   * d_conflict if there is none.
+   */
+  bool findFeasible();
+  /** Adds the bound of v to d_conflict unless it is tightened by a branch. */
+  void addToConflict(size_t v, bool upper);
+
+  /** The number of variables */
+  size_t d_numVars;
+  /** The rows basic = sum_j coefficient_j x_j, by row */
+  std::vector<std::map<size_t, Rational>> d_rows;
+  /** The basic variable of each row */
+  std::vector<size_t> d_basic;
+  /** The row of each variable, or s_nonbasic */
+  std::vector<size_t> d_rowOf;
+  /** The value of each variable */
+  std::vector<Rational> d_value;
+  /** The input bounds */
+  const std::vector<std::optional<Integer>>& d_inputLower;
+  const std::vector<std::optional<Integer>>& d_inputUpper;
+  /** The bounds of the current node */
+  std::vector<std::optional<Integer>> d_lower;
+  std::vector<std::optional<Integer>> d_upper;
+  /** Whether the bounds of the current node are tightened by a branch */
+  std::vector<bool> d_lowerBranched;
+  std::vector<bool> d_upperBranched;
+  /** See getConflict() */
+  std::vector<std::pair<size_t, bool>> d_conflict;
+  /** See getBranchVar() */
+  size_t d_branchVar;
+};
+
+ParallelBranchAndBound::Worker::Worker(const ParallelBranchAndBound& bab)
+    : d_numVars(bab.d_numVars),
+      d_rowOf(bab.d_numVars, s_nonbasic),
+      d_value(bab.d_numVars),
+      d_inputLower(bab.d_lower),
+      d_inputUpper(bab.d_upper),
+      d_branchVar(s_nonbasic)
+{
+  for (const auto& [basic, coeffs] : bab.d_rows)
+  {
+    d_rowOf[basic] = d_rows.size();
+    d_basic.push_back(basic);
+    d_rows.emplace_back(coeffs.begin(), coeffs.end());
+  }
+}
+
+void ParallelBranchAndBound::Worker::updateNonbasic(size_t v,
+                                                    const Rational& value)
+{
+  Assert(d_rowOf[v] == s_nonbasic);
+  Rational delta = value - d_value[v];
+  if (delta.isZero())
+  {
+    return;
+  }
+  d_value[v] = value;
+  for (size_t r = 0, n = d_rows.size(); r < n; ++r)
+  {
+    auto it = d_rows[r].find(v);
+    if (it != d_rows[r].end())
+    {
+      d_value[d_basic[r]] += it->second * delta;
+    }
+  }
+}
+
+void ParallelBranchAndBound::Worker::pivot(size_t row, size_t entering)
+{
+  std::map<size_t, Rational>& pivotRow = d_rows[row];
+  size_t leaving = d_basic[row];
+  auto it = pivotRow.find(entering);
+  Assert(it != pivotRow.end());
+  // leaving = a * entering + rest, so entering = leaving / a - rest / a
+  Rational inverse = it->second.inverse();
+  pivotRow.erase(it);
+  for (std::pair<const size_t, Rational>& e : pivotRow)
+  {
+    e.second = -e.second * inverse;
+  }
+  pivotRow[leaving] = inverse;
+  d_basic[row] = entering;
+  d_rowOf[entering] = row;
+  d_rowOf[leaving] = s_nonbasic;
+
+  for (size_t r = 0, n = d_rows.size(); r < n; ++r)
+  {
+    if (r == row)
+    {
+      continue;
+    }
+    std::map<size_t, Rational>& other = d_rows[r];
+    auto oit = other.find(entering);
+    if (oit == other.end())
+    {
+      continue;
+    }
+    Rational c = oit->second;
+    other.erase(oit);
+    for (const std::pair<const size_t, Rational>& e : pivotRow)
+    {
+      Rational& entry = other[e.first];
+      entry += c * e.second;
+      if (entry.isZero())
+      {
+        other.erase(e.first);
+      }
+    }
+  }
+}
+
+void ParallelBranchAndBound::Worker::addToConflict(size_t v, bool upper)
+{
+  if (!(upper ? d_upperBranched[v] : d_lowerBranched[v]))
+  {
+    d_conflict.emplace_back(v, upper);
+  }
+}
+
+bool ParallelBranchAndBound::Worker::findFeasible()
+{
+  // Bland's rule: the violated basic variable and the entering variable are
+  // the smallest candidates, which guarantees termination.
+  for (;;)
+  {
+    size_t basic = s_nonbasic;
+    bool below = false;
+    for (size_t v = 0; v < d_numVars && basic == s_nonbasic; ++v)
+    {
+      if (d_rowOf[v] == s_nonbasic)
+      {
+        continue;
+      }
+      if (d_lower[v] && d_value[v] < Rational(*d_lower[v]))
+      {
+        basic = v;
+        below = true;
+      }
+      else if (d_upper[v] && d_value[v] > Rational(*d_upper[v]))
+      {
+        basic = v;
+      }
+    }
+    if (basic == s_nonbasic)
+    {
+      return true;
+    }
+
+    size_t row = d_rowOf[basic];
+    size_t entering = s_nonbasic;
+    for (const std::pair<const size_t, Rational>& e : d_rows[row])
+    {
+      size_t v = e.first;
+      // whether v needs to increase to move basic towards its bound
+      bool up = (e.second.sgn() > 0) == below;
+      if (up ? !d_upper[v] || d_value[v] < Rational(*d_upper[v])
+             : !d_lower[v] || d_value[v] > Rational(*d_lower[v]))
+      {
+        entering = v;
+        break;
+      }
+    }
+    if (entering == s_nonbasic)
+    {
+      d_conflict.clear();
+      addToConflict(basic, !below);
+      for (const std::pair<const size_t, Rational>& e : d_rows[row])
+      {
+        addToConflict(e.first, (e.second.sgn() > 0) == below);
+      }
+      return false;
+    }
+
+    Rational target(below ? *d_lower[basic] : *d_upper[basic]);
+    const Rational& a = d_rows[row].find(entering)->second;
+    updateNonbasic(entering,
+                   d_value[entering] + (target - d_value[basic]) / a);
+    pivot(row, entering);
+  }
+}
+
+ParallelBranchAndBound::Worker::Outcome
+ParallelBranchAndBound::Worker::solve(const SearchNode& node)
+{
+  d_lower = d_inputLower;
+  d_upper = d_inputUpper;
+  d_lowerBranched.assign(d_numVars, false);
+  d_upperBranched.assign(d_numVars, false);
+  for (const Branch& b : node)
+  {
+    std::optional<Integer>& bound =
+        b.d_upper ? d_upper[b.d_var] : d_lower[b.d_var];
+    if (!bound || (b.d_upper ? b.d_value < *bound : b.d_value > *bound))
+    {
+      bound = b.d_value;
+      (b.d_upper ? d_upperBranched : d_lowerBranched)[b.d_var] = true;
+    }
+  }
+
+  for (size_t v = 0; v < d_numVars; ++v)
+  {
+    if (d_lower[v] && d_upper[v] && *d_lower[v] > *d_upper[v])
+    {
+      d_conflict.clear();
+      addToConflict(v, false);
+      addToConflict(v, true);
+      return Outcome::INFEASIBLE;
+    }
+  }
+  for (size_t v = 0; v < d_numVars; ++v)
+  {
+    if (d_rowOf[v] != s_nonbasic)
+    {
+      continue;
+    }
+    if (d_lower[v] && d_value[v] < Rational(*d_lower[v]))
+    {
+      updateNonbasic(v, Rational(*d_lower[v]));
+    }
+    else if (d_upper[v] && d_value[v] > Rational(*d_upper[v]))
+    {
+      updateNonbasic(v, Rational(*d_upper[v]));
+    }
+  }
+  if (!findFeasible())
+  {
+    return Outcome::INFEASIBLE;
+  }
+  for (size_t v = 0; v < d_numVars; ++v)
+  {
+    if (!d_value[v].isIntegral())
+    {
+      d_branchVar = v;
+      return Outcome::FRACTIONAL;
+    }
+  }
+  return Outcome::INTEGRAL;
+}
+
+ParallelBranchAndBound::ParallelBranchAndBound(size_t numVars)
+    : d_numVars(numVars),
+      d_lower(numVars),
+      d_upper(numVars),
+      d_active(0),
+      d_done(false),
+      d_result(Result::UNKNOWN),
+      d_maxNodes(0),
+      d_numNodes(0)
+{
+}
+
+void ParallelBranchAndBound::setLowerBound(size_t v, const Integer& b)
+{
+  d_lower[v] = b;
+}
+
+void ParallelBranchAndBound::setUpperBound(size_t v, const Integer& b)
+{
+  d_upper[v] = b;
+}
+
+void ParallelBranchAndBound::addRow(
+    size_t basic, const std::vector<std::pair<size_t, Rational>>& coeffs)
+{
+  d_rows.emplace_back(basic, coeffs);
+}
+
+std::vector<size_t> ParallelBranchAndBound::getConflictLowerBounds() const
+{
+  std::vector<size_t> vars;
+  for (size_t v = 0; v < d_numVars; ++v)
+  {
+    if (d_conflictLower[v])
+    {
+      vars.push_back(v);
+    }
+  }
+  return vars;
+}
+
+std::vector<size_t> ParallelBranchAndBound::getConflictUpperBounds() const
+{
+  std::vector<size_t> vars;
+  for (size_t v = 0; v < d_numVars; ++v)
+  {
+    if (d_conflictUpper[v])
+    {
+      vars.push_back(v);
+    }
+  }
+  return vars;
+}
+
+ParallelBranchAndBound::Result ParallelBranchAndBound::solve(
+    size_t numThreads,
+    uint64_t maxNodes,
+    std::function<bool(uint64_t)> interrupted)
+{
+  d_queue.assign(1, SearchNode());
+  d_active = 0;
+  d_done = false;
+  d_result = Result::UNSAT;
+  d_maxNodes = maxNodes;
+  d_interrupted = std::move(interrupted);
+  d_numNodes = 0;
+  d_model.clear();
+  d_conflictLower.assign(d_numVars, false);
+  d_conflictUpper.assign(d_numVars, false);
+
+#ifdef CVC5_PARALLEL_BAB
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < numThreads; ++i)
+  {
+    threads.emplace_back([this]() { work(false); });
+  }
+  work(true);
+  for (std::thread& t : threads)
+  {
+    t.join();
+  }
+#else
+  work(true);
+#endif
+  d_queue.clear();
+  d_interrupted = nullptr;
+  return d_result;
+}
+
+bool ParallelBranchAndBound::checkInterrupted()
+{
+  if (!d_done && d_interrupted && d_interrupted(d_numNodes))
+  {
+    d_done = true;
+    d_result = Result::UNKNOWN;
+    d_changed.notify_all();
+  }
+  return d_done;
+}
+
+void ParallelBranchAndBound::work(bool isCaller)
+{
+  Worker worker(*this);
+  std::unique_lock<std::mutex> lock(d_mutex);
+  for (;;)
+  {
+    auto ready = [this]() {
+      return d_done || !d_queue.empty() || d_active == 0;
+    };
+    if (isCaller)
+    {
+      // the limits are checked between nodes and while the others work
+      while (!checkInterrupted()
+             && !d_changed.wait_for(lock, s_pollPeriod, ready))
+      {
+      }
+    }
+    else
+    {
+      d_changed.wait(lock, ready);
+    }
+    if (d_done || d_queue.empty())
+    {
+      // either the search stopped or every node is closed
+      break;
+    }
+    if (d_numNodes >= d_maxNodes)
+    {
+      d_done = true;
+      d_result = Result::UNKNOWN;
+      d_changed.notify_all();
+      break;
+    }
+    SearchNode node = std::move(d_queue.back());
+    d_queue.pop_back();
+    ++d_numNodes;
+    ++d_active;
+    lock.unlock();
+
+    Worker::Outcome outcome = worker.solve(node);
+
+    lock.lock();
+    --d_active;
+    switch (outcome)
+    {
+      case Worker::Outcome::INFEASIBLE:
+        for (const std::pair<size_t, bool>& b : worker.getConflict())
+        {
+          (b.second ? d_conflictUpper : d_conflictLower)[b.first] = true;
+        }
+        break;
+      case Worker::Outcome::INTEGRAL:
+        if (!d_done)
+        {
+          d_done = true;
+          d_result = Result::SAT;
+          for (const Rational& value : worker.getValues())
+          {
+            d_model.push_back(value.getNumerator());
+          }
+        }
+        break;
+      case Worker::Outcome::FRACTIONAL:
+      {
+        size_t v = worker.getBranchVar();
+        Integer f = worker.getValues()[v].floor();
+        SearchNode down = node;
+        down.push_back(Branch{v, true, f});
+        node.push_back(Branch{v, false, f + 1});
+        d_queue.push_back(std::move(node));
+        d_queue.push_back(std::move(down));
+        break;
+      }
+    }
+    d_changed.notify_all();
+  }
+}
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,166 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Branch and bound over worker threads for pure integer problems.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "util/integer.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/**
+ * Decides whether a conjunction of bounds on integer variables, which are
+ * related by the rows of a tableau x_b = sum_j a_j x_j, has an integer
+ * solution by branch and bound.
+ *
+ * The nodes of the search tree are kept in a queue shared by the worker
+ * threads. Every worker owns a copy of the tableau and solves the relaxation
+ * of a node by the exact simplex method with Bland's rule, starting from the
+ * basis of the last node it solved. The first integral solution found is
+ * the shared incumbent and stops all workers.
+ *
+ * If every node is closed, the bounds are infeasible. A leaf is closed by a
+ * row whose bounds cannot be met, or by a variable with crossing bounds;
+ * the bounds of the input that are used (i.e. that were not tightened by a
+ * branch on the path to the leaf) are collected over all leaves and form an
+ * infeasible subset of the input bounds.
+ *
+ * This class does not use nodes, the context or the statistics, so that it
+ * can be used from several threads.
+ */
+class ParallelBranchAndBound
+{
+ public:
+  enum class Result
+  {
+    /** An integer solution was found, see getModel() */
+    SAT,
+    /** There is no integer solution, see getConflictLowerBounds() */
+    UNSAT,
+    /** The node limit was reached */
+    UNKNOWN
+  };
+
+  /** Creates a problem over the variables 0, ..., numVars - 1. */
+  ParallelBranchAndBound(size_t numVars);
+
+  /** Sets the lower bound of v. */
+  void setLowerBound(size_t v, const Integer& b);
+  /** Sets the upper bound of v. */
+  void setUpperBound(size_t v, const Integer& b);
+  /**
+   * Adds the row basic = sum_i coeffs[i].second * coeffs[i].first. Every
+   * variable is the basic variable of at most one row, and the basic
+   * variables do not occur on the right hand side of any row.
+   */
+  void addRow(size_t basic,
+              const std::vector<std::pair<size_t, Rational>>& coeffs);
+
+  /**
+   * Searches for an integer solution using numThreads workers (at least
+   * one), giving up after maxNodes nodes. The workers other than the calling
+   * thread are only started if cvc5 is built with ENABLE_PARALLEL_BAB.
+   *
+   * If given, interrupted is called by the calling thread between nodes,
+   * and periodically while it waits for the other workers, with the number
+   * of nodes taken so far. If it returns true, the workers stop after their
+   * current node and the result is UNKNOWN.
+   */
+  Result solve(size_t numThreads,
+               uint64_t maxNodes,
+               std::function<bool(uint64_t)> interrupted = nullptr);
+
+  /** Returns the solution after solve() returned SAT. */
+  const std::vector<Integer>& getModel() const { return d_model; }
+  /**
+   * Returns the variables whose lower bound is in the infeasible subset
+   * after solve() returned UNSAT.
+   */
+  std::vector<size_t> getConflictLowerBounds() const;
+  /** As above, for the upper bounds. */
+  std::vector<size_t> getConflictUpperBounds() const;
+  /** Returns the number of nodes solved by the last call to solve(). */
+  uint64_t getNumNodes() const { return d_numNodes; }
+
+ private:
+  class Worker;
+
+  /** A bound tightened by a branch. */
+  struct Branch
+  {
+    size_t d_var;
+    bool d_upper;
+    Integer d_value;
+  };
+  /** A node of the search tree, as the branches on the path to it. */
+  using SearchNode = std::vector<Branch>;
+
+  /**
+   * Runs a worker until the search is over. The worker of the thread that
+   * called solve() checks d_interrupted.
+   */
+  void work(bool isCaller);
+  /**
+   * Stops the search if d_interrupted returns true. Returns true if the
+   * search is over. Must be called with d_mutex held.
+   */
+  bool checkInterrupted();
+
+  /** The number of variables */
+  size_t d_numVars;
+  /** The bounds of the input */
+  std::vector<std::optional<Integer>> d_lower;
+  std::vector<std::optional<Integer>> d_upper;
+  /** The rows of the input, as their basic variables and coefficients */
+  std::vector<std::pair<size_t, std::vector<std::pair<size_t, Rational>>>>
+      d_rows;
+
+  /** Protects the fields below while solve() runs. */
+  std::mutex d_mutex;
+  /** Signals a change of d_queue, d_active or d_done */
+  std::condition_variable d_changed;
+  /** The open nodes */
+  std::vector<SearchNode> d_queue;
+  /** The number of workers solving a node */
+  size_t d_active;
+  /** Whether the search is over before the queue is exhausted */
+  bool d_done;
+  /** The result, if d_done */
+  Result d_result;
+  /** The node limit */
+  uint64_t d_maxNodes;
+  /** The callback given to solve() */
+  std::function<bool(uint64_t)> d_interrupted;
+  /** The number of nodes taken from the queue */
+  uint64_t d_numNodes;
+  /** The incumbent */
+  std::vector<Integer> d_model;
+  /** The input bounds used to close the leaves so far */
+  std::vector<bool> d_conflictLower;
+  std::vector<bool> d_conflictUpper;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -18,6 +18,7 @@
 
 #include "theory/arith/linear/theory_arith_private.h"
 
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <queue>
@@ -58,6 +59,7 @@
 #include "theory/arith/linear/linear_equality.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
+#include "theory/arith/linear/parallel_branch_and_bound.h"
 #include "theory/arith/linear/partial_model.h"
 #include "theory/arith/linear/simplex.h"
 #include "theory/arith/nl/nonlinear_extension.h"
@@ -72,6 +74,7 @@
 #include "util/integer.h"
 #include "util/random.h"
 #include "util/rational.h"
+#include "util/resource_manager.h"
 #include "util/result.h"
 #include "util/statistics_stats.h"
 
@@ -129,6 +132,7 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
               d_rowTracking,
               BasicVarModelUpdateCallBack(*this)),
       d_diosolver(env),
+      d_hermiteSolver(env),
       d_restartsCounter(0),
       d_tableauSizeHasBeenModified(false),
       d_tableauResetDensity(1.6),
@@ -151,6 +155,15 @@ TheoryArithPrivate::TheoryArithPrivate(Env& env,
           env, d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
       d_attemptSolSimplex(
           env, d_linEq, d_errorSet, RaiseConflict(*this), TempVarMalloc(*this)),
+      d_floatSimplex(env, d_partialModel, d_tableau),
+      d_gomoryCuts(env, d_partialModel, d_tableau),
+      d_parallelBabGaveUp(context(), false),
+      d_warmStarts(env),
+      d_userStamp(userContext(), 0),
+      d_lastUserStamp(0),
+      d_lastUserLevel(0),
+      d_warmStartPending(false),
+      d_queryStartPivots(0),
       d_pass1SDP(NULL),
       d_otherSDP(NULL),
       d_lastContextIntegerAttempted(context(), -1),
@@ -260,6 +273,12 @@ TheoryArithPrivate::Statistics::Statistics(StatisticsRegistry& reg,
       d_newPropTime(reg.registerTimer(name + "newPropTimer")),
       d_externalBranchAndBounds(
           reg.registerInt(name + "externalBranchAndBounds")),
+      d_parallelBabCalls(reg.registerInt(name + "parallelBab::calls")),
+      d_parallelBabNodes(reg.registerInt(name + "parallelBab::nodes")),
+      d_parallelBabModels(reg.registerInt(name + "parallelBab::models")),
+      d_parallelBabConflicts(reg.registerInt(name + "parallelBab::conflicts")),
+      d_parallelBabGaveUp(reg.registerInt(name + "parallelBab::gaveUp")),
+      d_parallelBabTime(reg.registerTimer(name + "parallelBab::time")),
       d_initialTableauSize(reg.registerInt(name + "initialTableauSize")),
       d_currSetToSmaller(reg.registerInt(name + "currSetToSmaller")),
       d_smallerSetToCurr(reg.registerInt(name + "smallerSetToCurr")),
@@ -267,6 +286,8 @@ TheoryArithPrivate::Statistics::Statistics(StatisticsRegistry& reg,
       d_boundComputationTime(reg.registerTimer(name + "bound::time")),
       d_boundComputations(reg.registerInt(name + "bound::boundComputations")),
       d_boundPropagations(reg.registerInt(name + "bound::boundPropagations")),
+      d_rowPropagationAttempts(
+          reg.registerInt(name + "bound::rowPropagationAttempts")),
       d_unknownChecks(reg.registerInt(name + "status::unknowns")),
       d_maxUnknownsInARow(reg.registerInt(name + "status::maxUnknownsInARow")),
       d_avgUnknownsInARow(
@@ -413,6 +434,8 @@ void TheoryArithPrivate::revertOutOfConflict(){
 
 void TheoryArithPrivate::clearUpdates(){
   d_updatedBounds.purge();
+  d_updatedLowerBounds.purge();
+  d_updatedUpperBounds.purge();
 }
 
 void TheoryArithPrivate::zeroDifferenceDetected(ArithVar x){
@@ -570,6 +593,7 @@ bool TheoryArithPrivate::AssertLower(ConstraintP constraint){
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedLowerBounds.softAdd(x_i);
 
   if(TraceIsOn("model")) {
     Trace("model") << "before" << endl;
@@ -710,6 +734,7 @@ bool TheoryArithPrivate::AssertUpper(ConstraintP constraint){
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedUpperBounds.softAdd(x_i);
 
   if(TraceIsOn("model")) {
     Trace("model") << "before" << endl;
@@ -802,6 +827,8 @@ bool TheoryArithPrivate::AssertEquality(ConstraintP constraint){
   }
 
   d_updatedBounds.softAdd(x_i);
+  d_updatedLowerBounds.softAdd(x_i);
+  d_updatedUpperBounds.softAdd(x_i);
 
   if(TraceIsOn("model")) {
     Trace("model") << "before" << endl;
@@ -1245,6 +1272,10 @@ void TheoryArithPrivate::releaseArithVar(ArithVar v){
 
   d_constraintDatabase.removeVariable(v);
   d_partialModel.releaseArithVar(v);
+  if (v < d_varGenerations.size())
+  {
+    ++d_varGenerations[v];
+  }
 }
 
 ArithVar TheoryArithPrivate::requestArithVar(TNode x, bool aux, bool internal){
@@ -1276,6 +1307,10 @@ ArithVar TheoryArithPrivate::requestArithVar(TNode x, bool aux, bool internal){
     d_tableauSizeHasBeenModified = true;
   }
   d_constraintDatabase.addVariable(varX);
+  if (varX >= d_varGenerations.size())
+  {
+    d_varGenerations.resize(varX + 1, 0);
+  }
 
   Trace("arith::arithvar") << "@" << context()->getLevel() << " " << x
                            << " |-> " << varX << "(relaiming " << reclaim << ")"
@@ -1443,6 +1478,195 @@ TrustNode TheoryArithPrivate::dioCutting()
   }
 }
 
+bool TheoryArithPrivate::gomoryCutting()
+{
+  // The cuts are not justified by proofs.
+  if (isProofEnabled() || !d_gomoryCuts.hasRoundsLeft())
+  {
+    return false;
+  }
+  static constexpr size_t maxCutsPerRound = 8;
+  NodeManager* nm = nodeManager();
+  bool any = false;
+  GomoryCuts::Cut cut;
+  for (ArithVar basic : d_gomoryCuts.startRound(maxCutsPerRound))
+  {
+    if (!d_gomoryCuts.generate(basic, cut)
+        || !complexityBelow(cut.lhs, options().arith.lemmaRejectCutSize))
+    {
+      continue;
+    }
+    Node sum = toSumNode(nm, d_partialModel, cut.lhs);
+    if (sum.isNull())
+    {
+      continue;
+    }
+    Node implied =
+        rewrite(nm->mkNode(Kind::GEQ, sum, nm->mkConstReal(cut.rhs)));
+    if (!d_gomoryCuts.addToPool(implied))
+    {
+      continue;
+    }
+    Node exp = Constraint::externalExplainByAssertions(nm, cut.explanation);
+    Node lemma = exp.impNode(implied);
+    Trace("arith::lemma") << "gmi cut " << lemma << endl;
+    // The SAT solver may drop the cut once it stops being useful.
+    any |= outputTrustedLemma(TrustNode::mkTrustLemma(lemma, nullptr),
+                              InferenceId::ARITH_GMI_CUT,
+                              LemmaProperty::REMOVABLE);
+  }
+  return any;
+}
+
+bool TheoryArithPrivate::parallelBranchAndBound()
+{
+  // The conflicts are not justified by proofs, and disequalities and
+  // nonlinear constraints are not bounds.
+  if (isProofEnabled() || d_parallelBabGaveUp.get() || !d_diseqQueue.empty()
+      || foundNonlinear())
+  {
+    return false;
+  }
+  ArithVar numVars = d_partialModel.getNumberOfVariables();
+  std::vector<ArithVar> vars;
+  std::vector<size_t> index(numVars);
+  for (var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi)
+  {
+    ArithVar v = *vi;
+    if (!isInteger(v))
+    {
+      return false;
+    }
+    index[v] = vars.size();
+    vars.push_back(v);
+  }
+
+  ParallelBranchAndBound bab(vars.size());
+  for (size_t i = 0, n = vars.size(); i < n; ++i)
+  {
+    ArithVar v = vars[i];
+    // k < x and k + delta <= x are floor(k) + 1 <= x on the integers
+    if (d_partialModel.hasLowerBound(v))
+    {
+      const DeltaRational& b = d_partialModel.getLowerBound(v);
+      const Rational& k = b.getNoninfinitesimalPart();
+      bab.setLowerBound(
+          i, b.infinitesimalSgn() > 0 ? k.floor() + 1 : k.ceiling());
+    }
+    if (d_partialModel.hasUpperBound(v))
+    {
+      const DeltaRational& b = d_partialModel.getUpperBound(v);
+      const Rational& k = b.getNoninfinitesimalPart();
+      bab.setUpperBound(
+          i, b.infinitesimalSgn() < 0 ? k.ceiling() - 1 : k.floor());
+    }
+  }
+  std::vector<std::pair<size_t, Rational>> coeffs;
+  for (Tableau::BasicIterator bi = d_tableau.beginBasic(),
+                              bi_end = d_tableau.endBasic();
+       bi != bi_end;
+       ++bi)
+  {
+    ArithVar basic = *bi;
+    Rational basicCoeff;
+    coeffs.clear();
+    for (Tableau::RowIterator ri = d_tableau.basicRowIterator(basic);
+         !ri.atEnd();
+         ++ri)
+    {
+      const Tableau::Entry& e = *ri;
+      if (e.getColVar() == basic)
+      {
+        basicCoeff = e.getCoefficient();
+      }
+      else
+      {
+        coeffs.emplace_back(index[e.getColVar()], e.getCoefficient());
+      }
+    }
+    // basicCoeff * basic + sum_j coeffs[j] = 0
+    Rational scale = -basicCoeff.inverse();
+    for (std::pair<size_t, Rational>& c : coeffs)
+    {
+      c.second *= scale;
+    }
+    bab.addRow(index[basic], coeffs);
+  }
+
+  // each node is charged as a pivot, and the search stops when the resource
+  // or time limits are reached
+  uint64_t chargedNodes = 0;
+  auto interrupted = [this, &chargedNodes](uint64_t numNodes) {
+    for (; chargedNodes < numNodes; ++chargedNodes)
+    {
+      d_containing.spendResource(Resource::ArithPivotStep);
+    }
+    return resourceManager()->out();
+  };
+  ParallelBranchAndBound::Result res;
+  {
+    TimerStat::CodeTimer codeTimer(d_statistics.d_parallelBabTime);
+    res = bab.solve(options().arith.arithParallelBabThreads,
+                    options().arith.arithParallelBabNodes,
+                    interrupted);
+  }
+  ++d_statistics.d_parallelBabCalls;
+  d_statistics.d_parallelBabNodes += bab.getNumNodes();
+  Trace("arith::bab") << "parallel bab " << vars.size() << " variables, "
+                      << bab.getNumNodes() << " nodes" << endl;
+
+  switch (res)
+  {
+    case ParallelBranchAndBound::Result::SAT:
+    {
+      // the rows hold for the model, so updating the non-basic variables
+      // moves the basic variables to their values as well
+      const std::vector<Integer>& model = bab.getModel();
+      for (size_t i = 0, n = vars.size(); i < n; ++i)
+      {
+        ArithVar v = vars[i];
+        DeltaRational value{Rational(model[i])};
+        if (!d_tableau.isBasic(v) && d_partialModel.getAssignment(v) != value)
+        {
+          d_linEq.update(v, value);
+        }
+      }
+      d_partialModel.commitAssignmentChanges();
+      Assert(hasIntegerModel());
+      ++d_statistics.d_parallelBabModels;
+      return false;
+    }
+    case ParallelBranchAndBound::Result::UNSAT:
+    {
+      ConstraintCPVec bounds;
+      for (size_t i : bab.getConflictLowerBounds())
+      {
+        bounds.push_back(d_partialModel.getLowerBoundConstraint(vars[i]));
+      }
+      for (size_t i : bab.getConflictUpperBounds())
+      {
+        bounds.push_back(d_partialModel.getUpperBoundConstraint(vars[i]));
+      }
+      Assert(!bounds.empty());
+      // an equality is both the lower and the upper bound
+      std::sort(bounds.begin(), bounds.end());
+      bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+      Node conflict =
+          Constraint::externalExplainByAssertions(nodeManager(), bounds);
+      Trace("arith::conflict") << "parallel bab conflict " << conflict << endl;
+      ++d_statistics.d_parallelBabConflicts;
+      raiseBlackBoxConflict(conflict);
+      outputConflicts();
+      return true;
+    }
+    default:
+      // do not try again on this branch of the search
+      d_parallelBabGaveUp = true;
+      ++d_statistics.d_parallelBabGaveUp;
+      return false;
+  }
+}
+
 Node TheoryArithPrivate::callDioSolver(){
   while(!d_constantIntegerVariables.empty()){
     ArithVar v = d_constantIntegerVariables.front();
@@ -1479,9 +1703,22 @@ Node TheoryArithPrivate::callDioSolver(){
     }else{
       Trace("dio::push") << "dio::push " << v << " " << eq.getNode() << " with reason " << orig << endl;
       d_diosolver.pushInputConstraint(eq, orig);
+      if (options().arith.arithDioHnf)
+      {
+        d_hermiteSolver.pushInputConstraint(eq, orig);
+      }
     }
   }
 
+  if (options().arith.arithDioHnf)
+  {
+    // the dio solver is only needed if the normal form got too large
+    Node conflict = d_hermiteSolver.processEquationsForConflict();
+    if (!conflict.isNull() || !d_hermiteSolver.gaveUp())
+    {
+      return conflict;
+    }
+  }
   return d_diosolver.processEquationsForConflict();
 }
 
@@ -1793,10 +2030,12 @@ TheoryId TheoryArithPrivate::theoryOf(TNode x) const
   return Theory::theoryOf(x);
 }
 
-bool TheoryArithPrivate::outputTrustedLemma(TrustNode lemma, InferenceId id)
+bool TheoryArithPrivate::outputTrustedLemma(TrustNode lemma,
+                                            InferenceId id,
+                                            LemmaProperty p)
 {
   Trace("arith::channel") << "Arith trusted lemma: " << lemma << std::endl;
-  return d_containing.outputTrustedLemma(lemma, id);
+  return d_containing.outputTrustedLemma(lemma, id, p);
 }
 
 bool TheoryArithPrivate::outputLemma(TNode lem, InferenceId id) {
@@ -2948,6 +3187,170 @@ bool TheoryArithPrivate::solveRelaxationOrPanic(Theory::Effort effortLevel)
   return false;
 }
 
+bool TheoryArithPrivate::solveRealRelaxationFloat()
+{
+  if (d_errorSet.errorEmpty() && !d_errorSet.moreSignals())
+  {
+    return false;
+  }
+  LinResult res =
+      d_floatSimplex.findModel(options().arith.arithFloatSimplexPivots);
+  Trace("TheoryArithPrivate::solveRealRelaxation")
+      << "solveRealRelaxation() float " << res << endl;
+  if (res != LinFeasible && res != LinInfeasible)
+  {
+    return false;
+  }
+  // verify and repair the basis in exact arithmetic
+  importSolution(d_floatSimplex.extractSolution());
+  return d_qflraStatus != Result::UNKNOWN;
+}
+
+bool TheoryArithPrivate::solveRealRelaxationWarmStart()
+{
+  if (!d_warmStartPending)
+  {
+    return false;
+  }
+  d_warmStartPending = false;
+  if (d_errorSet.errorEmpty() && !d_errorSet.moreSignals())
+  {
+    return false;
+  }
+  const WarmStartStore::Entry* entry = d_warmStarts.lookup(warmStartKey());
+  if (entry == nullptr)
+  {
+    return false;
+  }
+  const ApproximateSimplex::Solution& stored = entry->d_solution;
+  // A variable of the entry is stale if it was released since the entry was
+  // saved, even if its id was reused. Released variables are basic when
+  // their row is removed. Dropping stale basic variables hence leaves a set
+  // of independent columns, which AttemptSolutionSDP can make basic. If a
+  // variable that was non-basic in the entry was released, the row removed
+  // with it had a basic variable outside of the stored basis, and the
+  // stored basis may no longer be independent. Then only the values are
+  // used.
+  auto isStale = [&](ArithVar v) {
+    uint32_t current = v < d_varGenerations.size() ? d_varGenerations[v] : 0;
+    return v >= entry->d_generations.size()
+           || entry->d_generations[v] != current;
+  };
+  bool useBasis = true;
+  for (DenseMap<DeltaRational>::const_iterator i = stored.newValues.begin(),
+                                               i_end = stored.newValues.end();
+       i != i_end;
+       ++i)
+  {
+    if (isStale(*i))
+    {
+      useBasis = false;
+      d_warmStarts.notifyStale();
+      break;
+    }
+  }
+  ApproximateSimplex::Solution solution;
+  for (var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi)
+  {
+    ArithVar v = *vi;
+    bool stale = isStale(v);
+    if (useBasis ? !stale && stored.newBasis.isMember(v)
+                 : d_tableau.isBasic(v))
+    {
+      solution.newBasis.add(v);
+      continue;
+    }
+    DeltaRational value = !stale && stored.newValues.isKey(v)
+                              ? stored.newValues[v]
+                              : d_partialModel.getAssignment(v);
+    if (d_partialModel.hasLowerBound(v)
+        && value < d_partialModel.getLowerBound(v))
+    {
+      value = d_partialModel.getLowerBound(v);
+    }
+    else if (d_partialModel.hasUpperBound(v)
+             && value > d_partialModel.getUpperBound(v))
+    {
+      value = d_partialModel.getUpperBound(v);
+    }
+    solution.newValues.set(v, value);
+  }
+  d_warmStartExpectedPivots = entry->d_pivots;
+  importSolution(solution);
+  Trace("TheoryArithPrivate::solveRealRelaxation")
+      << "solveRealRelaxation() warm start " << d_qflraStatus << endl;
+  return d_qflraStatus != Result::UNKNOWN;
+}
+
+void TheoryArithPrivate::updateWarmStartQuery()
+{
+  uint32_t level = userContext()->getLevel();
+  bool popped = d_userStamp.get() != d_lastUserStamp;
+  if (!popped && level == d_lastUserLevel)
+  {
+    return;
+  }
+  d_lastUserStamp = d_lastUserStamp + 1;
+  d_userStamp = d_lastUserStamp;
+  d_lastUserLevel = level;
+  d_warmStartPending = popped;
+  d_queryStartPivots = d_linEq.getNumPivots();
+  d_warmStartExpectedPivots.reset();
+}
+
+std::vector<Node> TheoryArithPrivate::warmStartKey() const
+{
+  std::vector<Node> key;
+  for (var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi)
+  {
+    ArithVar v = *vi;
+    if (d_partialModel.hasLowerBound(v))
+    {
+      ConstraintP lb = d_partialModel.getLowerBoundConstraint(v);
+      if (lb->hasLiteral())
+      {
+        key.push_back(lb->getLiteral());
+      }
+    }
+    if (d_partialModel.hasUpperBound(v))
+    {
+      ConstraintP ub = d_partialModel.getUpperBoundConstraint(v);
+      if (ub->hasLiteral())
+      {
+        key.push_back(ub->getLiteral());
+      }
+    }
+  }
+  std::sort(key.begin(), key.end());
+  key.erase(std::unique(key.begin(), key.end()), key.end());
+  return key;
+}
+
+void TheoryArithPrivate::saveWarmStart()
+{
+  ApproximateSimplex::Solution solution;
+  for (var_iterator vi = var_begin(), vend = var_end(); vi != vend; ++vi)
+  {
+    ArithVar v = *vi;
+    if (d_tableau.isBasic(v))
+    {
+      solution.newBasis.add(v);
+    }
+    else
+    {
+      solution.newValues.set(v, d_partialModel.getAssignment(v));
+    }
+  }
+  uint64_t pivots = d_linEq.getNumPivots() - d_queryStartPivots;
+  if (d_warmStartExpectedPivots)
+  {
+    d_warmStarts.notifyPivots(*d_warmStartExpectedPivots, pivots);
+    d_warmStartExpectedPivots.reset();
+  }
+  d_warmStarts.save(
+      warmStartKey(), std::move(solution), d_varGenerations, pivots);
+}
+
 bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
   TimerStat::CodeTimer codeTimer0(d_statistics.d_solveRealRelaxTimer);
   Assert(d_qflraStatus != Result::SAT);
@@ -2972,7 +3375,16 @@ bool TheoryArithPrivate::solveRealRelaxation(Theory::Effort effortLevel){
       << safeToCallApprox() << endl;
 
   bool noPivotLimitPass1 = noPivotLimit && !useApprox;
-  d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  bool solved =
+      options().arith.arithWarmStart && solveRealRelaxationWarmStart();
+  if (!solved && options().arith.arithFloatSimplex)
+  {
+    solved = solveRealRelaxationFloat();
+  }
+  if (!solved)
+  {
+    d_qflraStatus = simplex.findModel(noPivotLimitPass1);
+  }
 
   Trace("TheoryArithPrivate::solveRealRelaxation")
     << "solveRealRelaxation()" << " pass1 " << d_qflraStatus << endl;
@@ -3095,6 +3507,10 @@ bool TheoryArithPrivate::preCheck(Theory::Effort level, bool newFacts)
   }
 
   d_newFacts = newFacts;
+  if (options().arith.arithWarmStart)
+  {
+    updateWarmStartQuery();
+  }
   // If d_previousStatus == SAT, then reverts on conflicts are safe
   // Otherwise, they are not and must be committed.
   d_previousStatus = d_qflraStatus;
@@ -3206,6 +3622,10 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
                        << d_qflraStatus << endl;
     d_partialModel.commitAssignmentChanges();
     d_unknownsInARow = 0;
+    if (options().arith.arithWarmStart && Theory::fullEffort(effortLevel))
+    {
+      saveWarmStart();
+    }
     if(TraceIsOn("arith::consistency")){
       Assert(entireStateIsConsistent("sat comit"));
     }
@@ -3389,6 +3809,13 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
        << " conf/split " << emmittedConflictOrSplit
        << " fulleffort " << Theory::fullEffort(effortLevel) << endl;
 
+  // A model found by --parallel-bab skips the integer reasoning below.
+  if (!emmittedConflictOrSplit && Theory::fullEffort(effortLevel)
+      && options().arith.arithParallelBab && !hasIntegerModel())
+  {
+    emmittedConflictOrSplit = parallelBranchAndBound();
+  }
+
   if(!emmittedConflictOrSplit && Theory::fullEffort(effortLevel) && !hasIntegerModel()){
     Node possibleConflict = Node::null();
     if (!emmittedConflictOrSplit && options().arith.arithDioSolver)
@@ -3421,6 +3848,13 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
       }
     }
 
+    if (!emmittedConflictOrSplit && options().arith.arithGmiCuts
+        && gomoryCutting())
+    {
+      d_cutCount = d_cutCount + 1;
+      emmittedConflictOrSplit = true;
+    }
+
     if (!emmittedConflictOrSplit && d_hasDoneWorkSinceCut
         && options().arith.arithDioSolver)
     {
@@ -3464,6 +3898,13 @@ bool TheoryArithPrivate::postCheck(Theory::Effort effortLevel)
                                 << decompositionLemma << endl;
           outputLemma(decompositionLemma, InferenceId::ARITH_DIO_DECOMPOSITION);
         }
+      }else if(d_hermiteSolver.hasMoreDecompositionLemmas()){
+        while(d_hermiteSolver.hasMoreDecompositionLemmas()){
+          Node decompositionLemma = d_hermiteSolver.nextDecompositionLemma();
+          Trace("arith::lemma") << "hnf decomposition lemma "
+                                << decompositionLemma << endl;
+          outputLemma(decompositionLemma, InferenceId::ARITH_DIO_DECOMPOSITION);
+        }
       }else{
         Trace("arith::restart") << "arith restart!" << endl;
         outputRestart();
@@ -3683,13 +4124,12 @@ TrustNode TheoryArithPrivate::explain(TNode n)
 }
 
 void TheoryArithPrivate::propagate(Theory::Effort e) {
+  bool rowProp = options().arith.arithPropagationMode
+                     == options::ArithPropagationMode::BOUND_INFERENCE_PROP
+                 || options().arith.arithPropagationMode
+                        == options::ArithPropagationMode::BOTH_PROP;
   // This uses model values for safety. Disable for now.
-  if (d_qflraStatus == Result::SAT
-      && (options().arith.arithPropagationMode
-              == options::ArithPropagationMode::BOUND_INFERENCE_PROP
-          || options().arith.arithPropagationMode
-                 == options::ArithPropagationMode::BOTH_PROP)
-      && hasAnyUpdates())
+  if (d_qflraStatus == Result::SAT && rowProp && hasAnyUpdates())
   {
     if (options().arith.newProp)
     {
@@ -3700,10 +4140,15 @@ void TheoryArithPrivate::propagate(Theory::Effort e) {
       propagateCandidates();
     }
   }
-  else
+  else if (!rowProp || !options().arith.newProp
+           || d_qflraStatus == Result::UNSAT)
   {
     clearUpdates();
   }
+  // Otherwise the updated bounds stay pending until the next call on a
+  // feasible assignment. The rows are only looked up then, and the bounds
+  // are read from the current context, so updates undone by backtracking
+  // only cost a wasted check.
 
   while(d_constraintDatabase.hasMorePropagations()){
     ConstraintCP c = d_constraintDatabase.nextPropagation();
@@ -4294,7 +4739,7 @@ void TheoryArithPrivate::propagateCandidates(){
       }
     }
   }
-  d_updatedBounds.purge();
+  clearUpdates();
 
   while(!d_candidateBasics.empty()){
     ArithVar candidate = d_candidateBasics.back();
@@ -4328,15 +4773,23 @@ void TheoryArithPrivate::propagateCandidatesNew(){
   dumpUpdatedBoundsToRows();
   Assert(d_updatedBounds.empty());
 
-  if(!d_candidateRows.empty()){
+  if (!d_candidateRowsUp.empty() || !d_candidateRowsDown.empty())
+  {
     UpdateTrackingCallback utcb(&d_linEq);
     d_partialModel.processBoundsQueue(utcb);
   }
 
-  while(!d_candidateRows.empty()){
-    RowIndex candidate = d_candidateRows.back();
-    d_candidateRows.pop_back();
-    propagateCandidateRow(candidate);
+  while (!d_candidateRowsUp.empty())
+  {
+    RowIndex candidate = d_candidateRowsUp.back();
+    d_candidateRowsUp.pop_back();
+    propagateCandidateRow(candidate, true);
+  }
+  while (!d_candidateRowsDown.empty())
+  {
+    RowIndex candidate = d_candidateRowsDown.back();
+    d_candidateRowsDown.pop_back();
+    propagateCandidateRow(candidate, false);
   }
   Trace("arith::prop") << "propagateCandidatesNew end" << endl << endl << endl;
 }
@@ -4625,55 +5078,64 @@ bool TheoryArithPrivate::rowImplicationCanBeApplied(RowIndex ridx, bool rowUp, C
   return false;
 }
 
-bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx){
+bool TheoryArithPrivate::propagateCandidateRow(RowIndex ridx, bool rowUp){
   BoundCounts hasCount = d_linEq.hasBoundCount(ridx);
   uint32_t rowLength = d_tableau.getRowLength(ridx);
-
-  bool success = false;
+  uint32_t count =
+      rowUp ? hasCount.upperBoundCount() : hasCount.lowerBoundCount();
 
   Trace("arith::prop") << "propagateCandidateRow attempt " << rowLength << " "
-                       << hasCount << endl;
+                       << rowUp << " " << hasCount << endl;
 
-  if (rowLength >= options().arith.arithPropagateMaxLength
-      && Random::getRandom().pickWithProb(
-          1.0 - double(options().arith.arithPropagateMaxLength) / rowLength))
+  // The row bound is infinite for two or more variables of the row.
+  if (count + 1 < rowLength)
   {
     return false;
   }
+  ++d_statistics.d_rowPropagationAttempts;
 
-  if(hasCount.lowerBoundCount() == rowLength){
-    success |= attemptFull(ridx, false);
-  }else if(hasCount.lowerBoundCount() + 1 == rowLength){
-    success |= attemptSingleton(ridx, false);
+  if (options().arith.arithPropLengthCutoff
+      && rowLength >= options().arith.arithPropagateMaxLength
+      && Random::getRandom().pickWithProb(
+          1.0 - double(options().arith.arithPropagateMaxLength) / rowLength))
+  {
+    return false;
   }
 
-  if(hasCount.upperBoundCount() == rowLength){
-    success |= attemptFull(ridx, true);
-  }else if(hasCount.upperBoundCount() + 1 == rowLength){
-    success |= attemptSingleton(ridx, true);
+  bool success = count == rowLength ? attemptFull(ridx, rowUp)
+                                    : attemptSingleton(ridx, rowUp);
+  if (success)
+  {
+    ++d_statistics.d_boundPropagations;
   }
   return success;
 }
 
 void TheoryArithPrivate::dumpUpdatedBoundsToRows(){
-  Assert(d_candidateRows.empty());
+  Assert(d_candidateRowsUp.empty() && d_candidateRowsDown.empty());
   DenseSet::const_iterator i = d_updatedBounds.begin();
   DenseSet::const_iterator end = d_updatedBounds.end();
   for(; i != end; ++i){
     ArithVar var = *i;
-    if(d_tableau.isBasic(var)){
-      RowIndex ridx = d_tableau.basicToRowIndex(var);
-      d_candidateRows.softAdd(ridx);
-    }else{
-      Tableau::ColIterator basicIter = d_tableau.colIterator(var);
-      for(; !basicIter.atEnd(); ++basicIter){
-        const Tableau::Entry& entry = *basicIter;
-        RowIndex ridx = entry.getRowIndex();
-        d_candidateRows.softAdd(ridx);
+    bool lb = d_updatedLowerBounds.isMember(var);
+    bool ub = d_updatedUpperBounds.isMember(var);
+    // A basic variable only occurs in its own row, with coefficient -1.
+    Tableau::ColIterator basicIter = d_tableau.colIterator(var);
+    for(; !basicIter.atEnd(); ++basicIter){
+      const Tableau::Entry& entry = *basicIter;
+      RowIndex ridx = entry.getRowIndex();
+      bool positive = entry.getCoefficient().sgn() > 0;
+      if (positive ? ub : lb)
+      {
+        d_candidateRowsUp.softAdd(ridx);
+      }
+      if (positive ? lb : ub)
+      {
+        d_candidateRowsDown.softAdd(ridx);
       }
     }
   }
-  d_updatedBounds.purge();
+  clearUpdates();
 }
 
 const BoundsInfo& TheoryArithPrivate::boundsInfo(ArithVar basic) const{
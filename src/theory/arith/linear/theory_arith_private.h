@@ -19,6 +19,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <vector>
 
 #include "context/cdhashset.h"
@@ -41,12 +42,16 @@
 #include "theory/arith/linear/dual_simplex.h"
 #include "theory/arith/linear/error_set.h"
 #include "theory/arith/linear/fc_simplex.h"
+#include "theory/arith/linear/float_simplex.h"
+#include "theory/arith/linear/gomory_cuts.h"
+#include "theory/arith/linear/hermite_solver.h"
 #include "theory/arith/linear/infer_bounds.h"
 #include "theory/arith/linear/linear_equality.h"
 #include "theory/arith/linear/matrix.h"
 #include "theory/arith/linear/normal_form.h"
 #include "theory/arith/linear/partial_model.h"
 #include "theory/arith/linear/soi_simplex.h"
+#include "theory/arith/linear/warm_start_store.h"
 #include "theory/theory.h"
 #include "theory/valuation.h"
 #include "util/dense_map.h"
@@ -251,6 +256,19 @@ private:
    */
   TrustNode dioCutting();
 
+  /**
+   * Outputs the Gomory mixed-integer cuts of the rows of the integer basic
+   * variables with non-integral assignments, see --gmi-cuts. Returns true
+   * if a lemma was output.
+   */
+  bool gomoryCutting();
+  /**
+   * Decides the current bounds by ParallelBranchAndBound if every variable
+   * is an integer, see --parallel-bab. Returns true if a conflict was
+   * raised. Installs the integer model if one was found.
+   */
+  bool parallelBranchAndBound();
+
   Comparison mkIntegerEqualityFromAssignment(ArithVar v);
 
   /**
@@ -306,6 +324,11 @@ private:
    * model (each in a read-only fashion).
    */
   DioSolver d_diosolver;
+  /**
+   * Looks for conflicts in the same equalities as d_diosolver, see
+   * --dio-hnf.
+   */
+  HermiteSolver d_hermiteSolver;
 
   /** Counts the number of notifyRestart() calls to the theory. */
   uint32_t d_restartsCounter;
@@ -391,8 +414,58 @@ private:
   FCSimplexDecisionProcedure d_fcSimplex;
   SumOfInfeasibilitiesSPD d_soiSimplex;
   AttemptSolutionSDP d_attemptSolSimplex;
+  /** Finds candidate bases in floating point, see --arith-float-simplex. */
+  FloatSimplex d_floatSimplex;
+  /** Derives cuts from the tableau, see --gmi-cuts. */
+  GomoryCuts d_gomoryCuts;
+  /** Whether --parallel-bab reached its node limit in this context */
+  context::CDO<bool> d_parallelBabGaveUp;
 
   bool solveRealRelaxation(Theory::Effort effortLevel);
+  /**
+   * Runs the floating point simplex and imports the basis it finds, which
+   * sets d_qflraStatus. Returns true if the exact simplex determined the
+   * status of the relaxation from this basis.
+   */
+  bool solveRealRelaxationFloat();
+  /**
+   * Seeds the simplex from d_warmStarts at the first call after a pop, see
+   * --arith-warm-start, which sets d_qflraStatus. Returns true if the exact
+   * simplex determined the status of the relaxation from the stored basis.
+   */
+  bool solveRealRelaxationWarmStart();
+  /**
+   * Starts a new query for --arith-warm-start if the user context changed
+   * since the last check.
+   */
+  void updateWarmStartQuery();
+  /** Returns the sorted literals of the current bounds. */
+  std::vector<Node> warmStartKey() const;
+  /** Saves the current basis and assignment in d_warmStarts. */
+  void saveWarmStart();
+
+  /** The bases and assignments of earlier checks */
+  WarmStartStore d_warmStarts;
+  /**
+   * A stamp that reverts to an older value when the user context is
+   * popped, which tells a pop from a push of the same level.
+   */
+  context::CDO<uint64_t> d_userStamp;
+  /** The stamp and the user context level of the last check */
+  uint64_t d_lastUserStamp;
+  uint32_t d_lastUserLevel;
+  /** Whether the next simplex is the first one after a pop */
+  bool d_warmStartPending;
+  /** The number of pivots when the current query started */
+  uint64_t d_queryStartPivots;
+  /** The pivots of the stored solution that seeded the current query */
+  std::optional<uint64_t> d_warmStartExpectedPivots;
+  /**
+   * For each variable, the number of times it was released, which tells
+   * the variables stored in d_warmStarts from later variables with the same
+   * id.
+   */
+  std::vector<uint32_t> d_varGenerations;
 
   /* Returns true if this is heuristically a good time to try
    * to solve the integers.
@@ -612,10 +685,18 @@ private:
 
   /** Tracks the bounds that were updated in the current round. */
   DenseSet d_updatedBounds;
+  /** The subsets of d_updatedBounds whose lower (resp. upper) bound changed. */
+  DenseSet d_updatedLowerBounds;
+  DenseSet d_updatedUpperBounds;
 
   /** Tracks the basic variables where propagation might be possible. */
   DenseSet d_candidateBasics;
-  DenseSet d_candidateRows;
+  /**
+   * The rows whose upper (resp. lower) row bound changed, i.e. the rows where
+   * propagation with rowUp true (resp. false) might be possible.
+   */
+  DenseSet d_candidateRowsUp;
+  DenseSet d_candidateRowsDown;
 
   bool hasAnyUpdates() { return !d_updatedBounds.empty(); }
   void clearUpdates();
@@ -623,8 +704,19 @@ private:
   void revertOutOfConflict();
 
   void propagateCandidatesNew();
+  /**
+   * Moves the rows watching the updated bounds into d_candidateRowsUp and
+   * d_candidateRowsDown. A row watches the bounds its row bounds are
+   * computed from: rowUp uses the upper bounds of the variables with a
+   * positive coefficient and the lower bounds of those with a negative one.
+   */
   void dumpUpdatedBoundsToRows();
-  bool propagateCandidateRow(RowIndex rid);
+  /**
+   * Attempts to propagate the bounds implied by the row bound of ridx in the
+   * direction rowUp. This is O(1) unless at most one variable of the row
+   * lacks a bound in this direction.
+   */
+  bool propagateCandidateRow(RowIndex rid, bool rowUp);
   bool propagateMightSucceed(ArithVar v, bool ub) const;
   /** Attempt to perform a row propagation where there is at most 1 possible variable.*/
   bool attemptSingleton(RowIndex ridx, bool rowUp);
@@ -696,7 +788,9 @@ private:
 
   bool isLeaf(TNode x) const;
   TheoryId theoryOf(TNode x) const;
-  bool outputTrustedLemma(TrustNode lem, InferenceId id);
+  bool outputTrustedLemma(TrustNode lem,
+                          InferenceId id,
+                          LemmaProperty p = LemmaProperty::NONE);
   bool outputLemma(TNode lem, InferenceId id);
   void outputTrustedConflict(TrustNode conf, InferenceId id);
   void outputConflict(TNode lit, InferenceId id);
@@ -788,6 +882,10 @@ private:
     TimerStat d_newPropTime;
 
     IntStat d_externalBranchAndBounds;
+    /** Calls to, nodes of and results of --parallel-bab */
+    IntStat d_parallelBabCalls, d_parallelBabNodes, d_parallelBabModels,
+        d_parallelBabConflicts, d_parallelBabGaveUp;
+    TimerStat d_parallelBabTime;
 
     IntStat d_initialTableauSize;
     IntStat d_currSetToSmaller;
@@ -796,6 +894,8 @@ private:
 
     TimerStat d_boundComputationTime;
     IntStat d_boundComputations, d_boundPropagations;
+    /** Rows examined by propagateCandidateRow past the bound count check */
+    IntStat d_rowPropagationAttempts;
 
     IntStat d_unknownChecks;
     IntStat d_maxUnknownsInARow;
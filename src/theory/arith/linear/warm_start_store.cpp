@@ -0,0 +1,148 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A store of bases and assignments to warm start the simplex after pops.
+ */
+
+#include "theory/arith/linear/warm_start_store.h"
+
+#include "base/output.h"
+#include "options/arith_options.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+namespace {
+
+/** Returns the size of the symmetric difference of the sorted a and b. */
+size_t distance(const std::vector<Node>& a, const std::vector<Node>& b)
+{
+  size_t d = 0;
+  auto i = a.begin(), i_end = a.end();
+  auto j = b.begin(), j_end = b.end();
+  while (i != i_end && j != j_end)
+  {
+    if (*i < *j)
+    {
+      ++d;
+      ++i;
+    }
+    else if (*j < *i)
+    {
+      ++d;
+      ++j;
+    }
+    else
+    {
+      ++i;
+      ++j;
+    }
+  }
+  return d + (i_end - i) + (j_end - j);
+}
+
+}  // namespace
+
+WarmStartStore::WarmStartStore(Env& env)
+    : EnvObj(env), d_time(0), d_statistics(statisticsRegistry())
+{
+}
+
+WarmStartStore::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_saves(sr.registerInt("theory::arith::warmStart::saves")),
+      d_hits(sr.registerInt("theory::arith::warmStart::hits")),
+      d_misses(sr.registerInt("theory::arith::warmStart::misses")),
+      d_pivotsSaved(sr.registerInt("theory::arith::warmStart::pivotsSaved")),
+      d_stale(sr.registerInt("theory::arith::warmStart::stale"))
+{
+}
+
+void WarmStartStore::save(std::vector<Node>&& key,
+                          ApproximateSimplex::Solution&& solution,
+                          const std::vector<uint32_t>& generations,
+                          uint64_t pivots)
+{
+  ++d_statistics.d_saves;
+  size_t capacity = options().arith.arithWarmStartEntries;
+  if (capacity == 0)
+  {
+    return;
+  }
+  Entry* target = nullptr;
+  for (Entry& e : d_entries)
+  {
+    if (e.d_key == key)
+    {
+      target = &e;
+      break;
+    }
+  }
+  if (target == nullptr && d_entries.size() < capacity)
+  {
+    d_entries.emplace_back();
+    target = &d_entries.back();
+  }
+  else if (target == nullptr)
+  {
+    target = &d_entries.front();
+    for (Entry& e : d_entries)
+    {
+      if (e.d_lastUse < target->d_lastUse)
+      {
+        target = &e;
+      }
+    }
+  }
+  target->d_key = std::move(key);
+  target->d_solution = std::move(solution);
+  target->d_generations = generations;
+  target->d_pivots = pivots;
+  target->d_lastUse = ++d_time;
+}
+
+const WarmStartStore::Entry* WarmStartStore::lookup(
+    const std::vector<Node>& key)
+{
+  size_t best = options().arith.arithWarmStartDistance + 1;
+  Entry* found = nullptr;
+  for (Entry& e : d_entries)
+  {
+    size_t d = distance(e.d_key, key);
+    if (d < best || (d == best && found != nullptr
+                     && e.d_lastUse > found->d_lastUse))
+    {
+      best = d;
+      found = &e;
+    }
+  }
+  if (found == nullptr)
+  {
+    ++d_statistics.d_misses;
+    return nullptr;
+  }
+  Trace("arith::warmStart") << "warm start from an entry at distance " << best
+                            << " of " << key.size() << std::endl;
+  ++d_statistics.d_hits;
+  found->d_lastUse = ++d_time;
+  return found;
+}
+
+void WarmStartStore::notifyPivots(uint64_t expected, uint64_t used)
+{
+  d_statistics.d_pivotsSaved +=
+      static_cast<int64_t>(expected) - static_cast<int64_t>(used);
+}
+
+void WarmStartStore::notifyStale() { ++d_statistics.d_stale; }
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * A store of bases and assignments to warm start the simplex after pops.
+ */
+
+#include "cvc5_private.h"
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "expr/node.h"
+#include "smt/env_obj.h"
+#include "theory/arith/linear/approx_simplex.h"
+#include "util/statistics_stats.h"
+
+namespace cvc5::internal {
+namespace theory {
+namespace arith::linear {
+
+/**
+ * Remembers the basis and the assignment of the non-basic variables of
+ * satisfiable checks, keyed by the literals of the bounds that held, see
+ * --arith-warm-start.
+ *
+ * The basis and the assignment of the simplex survive pops, but they belong
+ * to the last check before the pop, which may be far from the next query.
+ * When the queries of the user differ in a few constraints, the entry with
+ * the closest bounds is a better starting point. The store is not context
+ * dependent and holds at most --arith-warm-start-entries entries, evicting
+ * the least recently used one.
+ */
+class WarmStartStore : protected EnvObj
+{
+ public:
+  /** A stored solution */
+  struct Entry
+  {
+    /** The sorted bound literals */
+    std::vector<Node> d_key;
+    /** The basis and the non-basic assignment */
+    ApproximateSimplex::Solution d_solution;
+    /**
+     * The generation of each variable when the entry was saved. The
+     * generation of a variable grows when it is released, which tells a
+     * variable of the entry from a later variable with the same id.
+     */
+    std::vector<uint32_t> d_generations;
+    /** The number of pivots it took to find d_solution */
+    uint64_t d_pivots;
+    /** The time of the last save or lookup of this entry */
+    uint64_t d_lastUse;
+  };
+
+  WarmStartStore(Env& env);
+
+  /**
+   * Stores solution for the sorted bound literals key, replacing the entry
+   * with the same key if there is one. generations are the generations of
+   * the variables, and pivots is the number of pivots it took to find the
+   * solution.
+   */
+  void save(std::vector<Node>&& key,
+            ApproximateSimplex::Solution&& solution,
+            const std::vector<uint32_t>& generations,
+            uint64_t pivots);
+  /**
+   * Returns the entry whose key differs from the sorted key in the fewest
+   * literals, if they are at most --arith-warm-start-distance, and nullptr
+   * otherwise.
+   */
+  const Entry* lookup(const std::vector<Node>& key);
+  /**
+   * Notifies the store that a query seeded by lookup took used pivots
+   * where the stored solution took expected pivots.
+   */
+  void notifyPivots(uint64_t expected, uint64_t used);
+  /** Notifies the store that the basis of a found entry was stale. */
+  void notifyStale();
+
+ private:
+  /** The entries */
+  std::vector<Entry> d_entries;
+  /** The number of saves and lookups, for the least recently used entry */
+  uint64_t d_time;
+
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of calls to save */
+    IntStat d_saves;
+    /** Number of lookups that found an entry */
+    IntStat d_hits;
+    /** Number of lookups that did not find an entry */
+    IntStat d_misses;
+    /** Estimated number of pivots saved by the entries found */
+    IntStat d_pivotsSaved;
+    /** Number of entries found whose basis was stale */
+    IntStat d_stale;
+  };
+  Statistics d_statistics;
+};
+
+}  // namespace arith
+}  // namespace theory
+}  // namespace cvc5::internal
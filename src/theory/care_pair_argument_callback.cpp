@@ -37,6 +37,7 @@ bool CarePairArgumentCallback::considerPath(TNode a, TNode b)
 
 void CarePairArgumentCallback::processData(TNode fa, TNode fb)
 {
+  ++d_theory.d_carePairsExamined;
   d_theory.processCarePairArgs(fa, fb);
 }
 
@@ -27,7 +27,7 @@ namespace theory {
 
 CombinationCareGraph::CombinationCareGraph(
     Env& env, TheoryEngine& te, const std::vector<Theory*>& paraTheories)
-    : CombinationEngine(env, te, paraTheories)
+    : CombinationEngine(env, te, paraTheories), d_stats(statisticsRegistry())
 {
 }
 
@@ -49,6 +49,11 @@ void CombinationCareGraph::combineTheories()
   Trace("combineTheories")
       << "TheoryEngine::combineTheories(): care graph size = "
       << careGraph.size() << std::endl;
+  d_stats.d_carePairsPerRound << careGraph.size();
+  if (!careGraph.empty())
+  {
+    ++d_stats.d_splitRounds;
+  }
 
   // Now add splitters for the ones we are interested in
   prop::PropEngine* propEngine = d_te.getPropEngine();
@@ -99,5 +104,12 @@ bool CombinationCareGraph::buildModel()
   return d_mmanager->buildModel();
 }
 
+CombinationCareGraph::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_carePairsPerRound(
+        sr.registerAverage("theory::combination::carePairsPerRound")),
+      d_splitRounds(sr.registerInt("theory::combination::splitRounds"))
+{
+}
+
 }  // namespace theory
 }  // namespace cvc5::internal
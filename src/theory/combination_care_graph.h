@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "theory/combination_engine.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
@@ -45,6 +46,18 @@ class CombinationCareGraph : public CombinationEngine
    * Combine theories using a care graph.
    */
   void combineTheories() override;
+
+ private:
+  /** Statistics about theory combination */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of care pairs per round of theory combination */
+    AverageStat d_carePairsPerRound;
+    /** Number of rounds of theory combination with a non-empty care graph */
+    IntStat d_splitRounds;
+  };
+  Statistics d_stats;
 };
 
 }  // namespace theory
@@ -28,7 +28,11 @@ namespace cvc5::internal {
 namespace theory {
 
 ConflictProcessor::ConflictProcessor(Env& env, bool useExtRewriter)
-    : EnvObj(env), d_useExtRewriter(useExtRewriter), d_stats(statisticsRegistry())
+    : EnvObj(env),
+      ContextNotifyObj(env.getUserContext()),
+      d_useExtRewriter(useExtRewriter),
+      d_cacheSize(options().theory.conflictProcessCacheSize),
+      d_stats(statisticsRegistry())
 {
   NodeManager* nm = env.getNodeManager();
   d_true = nm->mkConst(true);
@@ -40,6 +44,22 @@ TrustNode ConflictProcessor::processLemma(const TrustNode& lem)
   ++d_stats.d_initLemmas;
   Node lemma = lem.getProven();
   lemma = rewrite(lemma);
+  std::vector<Node> lemmaLits;
+  if (d_cacheSize > 0)
+  {
+    // If a cached minimized lemma subsumes this lemma, use it instead.
+    getClauseLits(lemma, lemmaLits);
+    const CacheEntry* ce = lookupCache(lemmaLits);
+    if (ce != nullptr)
+    {
+      Trace("confp") << "...cached " << ce->d_lemma << " subsumes " << lemma
+                     << std::endl;
+      ++d_stats.d_cacheHits;
+      d_stats.d_litsRemoved << static_cast<double>(lemmaLits.size())
+                                   - static_cast<double>(ce->d_lits.size());
+      return TrustNode::mkTrustLemma(ce->d_lemma);
+    }
+  }
   // do not use compression, because we will erase substitutions below
   SubstitutionMap s(nullptr, false);
   std::map<Node, Node> varToExp;
@@ -237,6 +257,14 @@ TrustNode ConflictProcessor::processLemma(const TrustNode& lem)
     }
     Node genLem = nm->mkOr(clause);
     Trace("confp") << "...processed lemma is " << genLem << std::endl;
+    if (d_cacheSize > 0)
+    {
+      std::vector<Node> genLits;
+      getClauseLits(genLem, genLits);
+      d_stats.d_litsRemoved << static_cast<double>(lemmaLits.size())
+                                   - static_cast<double>(genLits.size());
+      addToCache(genLem, genLits);
+    }
     return TrustNode::mkTrustLemma(genLem);
   }
 
@@ -317,6 +345,116 @@ void ConflictProcessor::decomposeLemma(const Node& lem,
   } while (!visit.empty());
 }
 
+void ConflictProcessor::getClauseLits(const Node& lem,
+                                      std::vector<Node>& lits) const
+{
+  std::unordered_set<Node> visited;
+  std::vector<Node> visit;
+  Node cur;
+  visit.push_back(lem);
+  do
+  {
+    cur = visit.back();
+    visit.pop_back();
+    if (!visited.insert(cur).second)
+    {
+      continue;
+    }
+    Kind k = cur.getKind();
+    if (k == Kind::OR)
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+    else if (k == Kind::IMPLIES)
+    {
+      visit.push_back(cur[0].negate());
+      visit.push_back(cur[1]);
+    }
+    else if (k == Kind::NOT && cur[0].getKind() == Kind::AND)
+    {
+      for (const Node& c : cur[0])
+      {
+        visit.push_back(c.negate());
+      }
+    }
+    else
+    {
+      lits.push_back(cur);
+    }
+  } while (!visit.empty());
+}
+
+const ConflictProcessor::CacheEntry* ConflictProcessor::lookupCache(
+    const std::vector<Node>& lits) const
+{
+  // count the literals of each entry that occur in lits
+  std::unordered_map<size_t, size_t> count;
+  const CacheEntry* best = nullptr;
+  for (const Node& l : lits)
+  {
+    auto it = d_cacheOcc.find(l);
+    if (it == d_cacheOcc.end())
+    {
+      continue;
+    }
+    for (size_t i : it->second)
+    {
+      const CacheEntry& ce = d_cache[i];
+      // If the entry has as many literals as lits, it is the same clause,
+      // which we do not replace.
+      if (++count[i] == ce.d_lits.size() && ce.d_lits.size() < lits.size()
+          && (best == nullptr || ce.d_lits.size() < best->d_lits.size()))
+      {
+        best = &ce;
+      }
+    }
+  }
+  return best;
+}
+
+void ConflictProcessor::addToCache(const Node& lem,
+                                   const std::vector<Node>& lits)
+{
+  if (d_cache.size() >= d_cacheSize)
+  {
+    // bound the memory of the cache by starting from scratch
+    ++d_stats.d_cacheResets;
+    clearCache();
+  }
+  size_t index = d_cache.size();
+  d_cache.push_back({lem, lits, userContext()->getLevel()});
+  for (const Node& l : lits)
+  {
+    d_cacheOcc[l].push_back(index);
+  }
+}
+
+void ConflictProcessor::clearCache()
+{
+  d_cache.clear();
+  d_cacheOcc.clear();
+}
+
+void ConflictProcessor::contextNotifyPop()
+{
+  uint32_t level = userContext()->getLevel();
+  while (!d_cache.empty() && d_cache.back().d_level > level)
+  {
+    // the index of the last entry is the last one of its occurrence lists
+    for (const Node& l : d_cache.back().d_lits)
+    {
+      auto it = d_cacheOcc.find(l);
+      Assert(it != d_cacheOcc.end() && it->second.back() == d_cache.size() - 1);
+      it->second.pop_back();
+      if (it->second.empty())
+      {
+        d_cacheOcc.erase(it);
+      }
+    }
+    d_cache.pop_back();
+  }
+}
+
 Node ConflictProcessor::evaluateSubstitutionLit(const SubstitutionMap& s,
                                                 const Node& tgtLit) const
 {
@@ -391,7 +529,10 @@ Node ConflictProcessor::evaluateSubstitution(const SubstitutionMap& s,
 ConflictProcessor::Statistics::Statistics(StatisticsRegistry& sr)
     : d_initLemmas(sr.registerInt("ConflictProcessor::init_lemmas")),
       d_lemmas(sr.registerInt("ConflictProcessor::lemmas")),
-      d_minLemmas(sr.registerInt("ConflictProcessor::min_lemmas"))
+      d_minLemmas(sr.registerInt("ConflictProcessor::min_lemmas")),
+      d_cacheHits(sr.registerInt("ConflictProcessor::cache_hits")),
+      d_cacheResets(sr.registerInt("ConflictProcessor::cache_resets")),
+      d_litsRemoved(sr.registerAverage("ConflictProcessor::lits_removed"))
 {
 }
 
@@ -18,6 +18,7 @@
 #ifndef CVC5__THEORY__CONFLICT_PROCESSOR_H
 #define CVC5__THEORY__CONFLICT_PROCESSOR_H
 
+#include "context/context.h"
 #include "expr/node.h"
 #include "expr/subs.h"
 #include "proof/trust_node.h"
@@ -36,7 +37,7 @@ namespace theory {
  * A utility for inferring when a theory lemma or conflict can be strengthened
  * based on substitution + rewriting.
  */
-class ConflictProcessor : protected EnvObj
+class ConflictProcessor : protected EnvObj, public context::ContextNotifyObj
 {
  public:
   /**
@@ -69,6 +70,30 @@ class ConflictProcessor : protected EnvObj
   Node d_nullNode;
   /** Use the extended rewriter? */
   bool d_useExtRewriter;
+  /** A minimized lemma in the cache */
+  struct CacheEntry
+  {
+    /** The minimized lemma */
+    Node d_lemma;
+    /** The distinct literals of d_lemma */
+    std::vector<Node> d_lits;
+    /** The user context level at which d_lemma was cached */
+    uint32_t d_level;
+  };
+  /**
+   * The cache of minimized lemmas. Each lemma in the cache subsumes all
+   * lemmas whose literals include its literals, where literals are computed
+   * by getClauseLits.
+   *
+   * Since lemmas may depend on the assertions of the user context they were
+   * added in, the entries are ordered by user context level, and those above
+   * the current level are removed on every pop of the user context.
+   */
+  std::vector<CacheEntry> d_cache;
+  /** Maps literals to the indices of the cache entries containing them */
+  std::unordered_map<Node, std::vector<size_t>> d_cacheOcc;
+  /** The maximum number of entries in the cache */
+  size_t d_cacheSize;
   /** Statistics about the conflict processor */
   struct Statistics
   {
@@ -79,6 +104,12 @@ class ConflictProcessor : protected EnvObj
     IntStat d_lemmas;
     /** Total number of minimized lemmas */
     IntStat d_minLemmas;
+    /** Total number of lemmas replaced by a cached minimized lemma */
+    IntStat d_cacheHits;
+    /** Total number of times the cache was cleared since it was full */
+    IntStat d_cacheResets;
+    /** Number of literals removed from minimized or replaced lemmas */
+    AverageStat d_litsRemoved;
   };
   Statistics d_stats;
   /**
@@ -107,6 +138,22 @@ class ConflictProcessor : protected EnvObj
                       SubstitutionMap& s,
                       std::map<Node, Node>& varToExp,
                       std::vector<Node>& tgtLits) const;
+  /**
+   * Get the distinct literals of the clause lem, where like in decomposeLemma
+   * we flatten OR, IMPLIES and negated AND.
+   */
+  void getClauseLits(const Node& lem, std::vector<Node>& lits) const;
+  /**
+   * Get a cached minimized lemma whose literals are a strict subset of lits,
+   * or nullptr if none exists.
+   */
+  const CacheEntry* lookupCache(const std::vector<Node>& lits) const;
+  /** Add the minimized lemma lem whose literals are lits to the cache. */
+  void addToCache(const Node& lem, const std::vector<Node>& lits);
+  /** Clear the cache. */
+  void clearCache();
+  /** Remove the cache entries of the user context levels that were popped. */
+  void contextNotifyPop() override;
   /**
    * Evaluate substitution, which returns the result applying s to tgt and
    * applying extended rewriting. If this is not equal to constant Boolean,
@@ -61,6 +61,15 @@ void EqEngineManagerCentral::initializeTheories()
   {
     // the shared solver uses central equality engine
     d_sharedSolver.setEqualityEngine(&d_centralEqualityEngine);
+    // it may ask for merge and disequality notifications
+    if (esis.needsNotifyMerge())
+    {
+      d_centralEENotify.d_mergeNotify.push_back(esis.d_notify);
+    }
+    if (esis.needsNotifyDisequal())
+    {
+      d_centralEENotify.d_disequalNotify.push_back(esis.d_notify);
+    }
   }
   else
   {
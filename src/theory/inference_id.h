@@ -95,6 +95,8 @@ enum class InferenceId
   ARITH_BB_LEMMA,
   ARITH_DIO_CUT,
   ARITH_DIO_DECOMPOSITION,
+  // Gomory mixed-integer cut from the current basis
+  ARITH_GMI_CUT,
   // unate lemma during presolve
   ARITH_UNATE,
   // row implication
@@ -34,6 +34,9 @@ RelevanceManager::RelevanceManager(Env& env, TheoryEngine* engine)
       d_input(userContext()),
       d_atomMap(userContext()),
       d_rset(context()),
+      d_inputsVisited(context(), 0),
+      d_unjustified(context()),
+      d_computedInCheck(false),
       d_inFullEffortCheck(false),
       d_fullEffortCheckFail(false),
       d_success(false),
@@ -148,6 +151,7 @@ void RelevanceManager::check(Theory::Effort effort)
   {
     d_inFullEffortCheck = true;
     d_fullEffortCheckFail = false;
+    d_computedInCheck = false;
   }
 }
 
@@ -169,14 +173,40 @@ void RelevanceManager::computeRelevance()
     d_success = false;
     return;
   }
-  for (const Node& node: d_input)
+  // The SAT assignment does not change during a full effort check, hence
+  // we only need to visit the input assertions added since the last call.
+  size_t ninputs = d_input.size();
+  if (d_computedInCheck && d_inputsVisited.get() == ninputs)
   {
+    return;
+  }
+  // Visit the input assertions that we failed to justify to be true before,
+  // since their value may have changed. Those that were justified to be true
+  // remain so in the current SAT context.
+  for (const Node& node : d_unjustified)
+  {
+    if (!isJustifiedTrue(node) && !computeRelevanceFor(node))
+    {
+      d_success = false;
+      return;
+    }
+  }
+  // visit the new input assertions
+  for (size_t i = d_inputsVisited.get(); i < ninputs; i++)
+  {
+    Node node = d_input[i];
     if (!computeRelevanceFor(node))
     {
       d_success = false;
       return;
     }
+    if (!isJustifiedTrue(node))
+    {
+      d_unjustified.push_back(node);
+    }
   }
+  d_inputsVisited = ninputs;
+  d_computedInCheck = d_inFullEffortCheck;
   if (TraceIsOn("rel-manager"))
   {
     if (d_inFullEffortCheck)
@@ -193,6 +223,13 @@ void RelevanceManager::computeRelevance()
   d_success = !d_fullEffortCheckFail;
 }
 
+bool RelevanceManager::isJustifiedTrue(TNode input) const
+{
+  RlvPairIntMap::const_iterator it =
+      d_jcache.find(RlvPair(input, d_ptctx.initialValue()));
+  return it != d_jcache.end() && it->second == 1;
+}
+
 bool RelevanceManager::computeRelevanceFor(TNode input)
 {
   int32_t val = justify(input);
@@ -523,6 +560,7 @@ std::unordered_set<TNode> RelevanceManager::getRelevantAssertions(bool& success)
   // set in full effort check temporarily
   d_inFullEffortCheck = true;
   d_fullEffortCheckFail = false;
+  d_computedInCheck = false;
   computeRelevance();
   // update success flag
   success = d_success;
@@ -74,6 +74,13 @@ class TheoryModel;
  * asserted literal is part of the current relevant selection. The relevant
  * selection is computed lazily, i.e. only when someone asks if a literal is
  * relevant, and only at most once per FULL effort check.
+ *
+ * The relevant selection is computed incrementally. Since the justification
+ * of a formula remains valid in extensions of the current SAT context, we
+ * maintain a SAT-context-dependent index of the input formulas that have been
+ * justified, and the list of input formulas that could not be justified to be
+ * true. Only the latter and the input formulas that are new since the last
+ * computation are visited when computing the relevant selection.
  */
 class RelevanceManager : public TheoryEngineModule
 {
@@ -178,6 +185,8 @@ class RelevanceManager : public TheoryEngineModule
   void addAssertionsInternal(std::vector<Node>& toProcess);
   /** compute the relevant selection */
   void computeRelevance();
+  /** Returns true if input has been justified to be true */
+  bool isJustifiedTrue(TNode input) const;
   /**
    * Justify formula n. To "justify" means we have added literals to our
    * relevant selection set (d_rset) whose current values ensure that n
@@ -216,6 +225,19 @@ class RelevanceManager : public TheoryEngineModule
    * literals that are definitely relevant in this context.
    */
   NodeSet d_rset;
+  /**
+   * The number of input assertions visited by computeRelevance in the current
+   * SAT context, where all visited input assertions that were not justified
+   * to be true are in d_unjustified.
+   */
+  context::CDO<size_t> d_inputsVisited;
+  /** The visited input assertions that were not justified to be true */
+  NodeList d_unjustified;
+  /**
+   * Whether we have computed the relevant selection for all visited input
+   * assertions in the current full effort check.
+   */
+  bool d_computedInCheck;
   /** Are we in a full effort check? */
   bool d_inFullEffortCheck;
   /** Have we failed to justify a formula in a full effort check? */
@@ -111,6 +111,12 @@ EqualityStatus SharedSolver::getEqualityStatus(TNode a, TNode b)
   return EQUALITY_UNKNOWN;
 }
 
+size_t SharedSolver::getTouchedTerms(size_t start,
+                                     std::unordered_set<TNode>& terms) const
+{
+  return 0;
+}
+
 bool SharedSolver::propagateLit(TNode predicate, bool value)
 {
   if (value)
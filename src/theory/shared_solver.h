@@ -18,6 +18,8 @@
 #ifndef CVC5__THEORY__SHARED_SOLVER__H
 #define CVC5__THEORY__SHARED_SOLVER__H
 
+#include <unordered_set>
+
 #include "expr/node.h"
 #include "smt/env_obj.h"
 #include "theory/inference_id.h"
@@ -90,6 +92,14 @@ class SharedSolver : protected EnvObj
    * care graph.
    */
   virtual EqualityStatus getEqualityStatus(TNode a, TNode b);
+  /**
+   * Adds to terms the terms for which the result of getEqualityStatus may
+   * have changed due to the changes in the current SAT context, ignoring the
+   * first start changes. Returns the number of changes in the current SAT
+   * context.
+   */
+  virtual size_t getTouchedTerms(size_t start,
+                                 std::unordered_set<TNode>& terms) const;
   /**
    * Explain literal, which returns a conjunction of literals that entail
    * the given one.
@@ -65,6 +65,12 @@ EqualityStatus SharedSolverDistributed::getEqualityStatus(TNode a, TNode b)
   return d_te.theoryOf(tid)->getEqualityStatus(a, b);
 }
 
+size_t SharedSolverDistributed::getTouchedTerms(
+    size_t start, std::unordered_set<TNode>& terms) const
+{
+  return d_sharedTerms.getTouchedTerms(start, terms);
+}
+
 TrustNode SharedSolverDistributed::explain(TNode literal, TheoryId id)
 {
   TrustNode texp;
@@ -48,6 +48,9 @@ class SharedSolverDistributed : public SharedSolver
    * Get equality status based on the equality engine of shared terms database
    */
   EqualityStatus getEqualityStatus(TNode a, TNode b) override;
+  /** Get the touched terms of the shared terms database */
+  size_t getTouchedTerms(size_t start,
+                         std::unordered_set<TNode>& terms) const override;
   /** Explain literal that was propagated by a theory or using shared terms
    * database */
   TrustNode explain(TNode literal, TheoryId id) override;
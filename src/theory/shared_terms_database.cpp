@@ -34,6 +34,7 @@ SharedTermsDatabase::SharedTermsDatabase(Env& env, TheoryEngine* theoryEngine)
       d_alreadyNotifiedMap(env.getContext()),
       d_registeredEqualities(env.getContext()),
       d_EENotify(*this),
+      d_touched(env.getContext()),
       d_theoryEngine(theoryEngine),
       d_inConflict(env.getContext(), false),
       d_conflictPolarity(),
@@ -64,6 +65,9 @@ bool SharedTermsDatabase::needsEqualityEngine(EeSetupInfo& esi)
 {
   esi.d_notify = &d_EENotify;
   esi.d_name = "shared::ee";
+  // merges and disequalities are recorded in the touched terms
+  esi.d_notifyMerge = true;
+  esi.d_notifyDisequal = true;
   return true;
 }
 
@@ -244,6 +248,32 @@ bool SharedTermsDatabase::areDisequal(TNode a, TNode b) const {
   }
 }
 
+size_t SharedTermsDatabase::getTouchedTerms(
+    size_t start, std::unordered_set<TNode>& terms) const
+{
+  Assert(d_equalityEngine != nullptr);
+  Assert(start <= d_touched.size());
+  std::unordered_set<TNode> reps;
+  for (size_t i = start, ntouched = d_touched.size(); i < ntouched; ++i)
+  {
+    TNode r = d_equalityEngine->getRepresentative(d_touched[i]);
+    if (!reps.insert(r).second)
+    {
+      continue;
+    }
+    eq::EqClassIterator eqcIt(r, d_equalityEngine);
+    while (!eqcIt.isFinished())
+    {
+      if (isShared(*eqcIt))
+      {
+        terms.insert(*eqcIt);
+      }
+      ++eqcIt;
+    }
+  }
+  return d_touched.size();
+}
+
 theory::eq::EqualityEngine* SharedTermsDatabase::getEqualityEngine()
 {
   return d_equalityEngine;
@@ -19,8 +19,10 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
 
 #include "context/cdhashset.h"
+#include "context/cdlist.h"
 #include "expr/node.h"
 #include "proof/proof_node_manager.h"
 #include "proof/trust_node.h"
@@ -107,13 +109,26 @@ class SharedTermsDatabase : protected EnvObj, public context::ContextNotifyObj
     }
 
     void eqNotifyNewClass(TNode t) override {}
-    void eqNotifyMerge(TNode t1, TNode t2) override {}
-    void eqNotifyDisequal(TNode t1, TNode t2, TNode reason) override {}
+    void eqNotifyMerge(TNode t1, TNode t2) override
+    {
+      d_sharedTerms.d_touched.push_back(t1);
+    }
+    void eqNotifyDisequal(TNode t1, TNode t2, TNode reason) override
+    {
+      d_sharedTerms.d_touched.push_back(t1);
+      d_sharedTerms.d_touched.push_back(t2);
+    }
   };
 
   /** The notify class for d_equalityEngine */
   EENotifyClass d_EENotify;
 
+  /**
+   * The terms whose equivalence classes in d_equalityEngine were merged or
+   * made disequal in the current SAT context.
+   */
+  context::CDList<Node> d_touched;
+
   /**
    * Method called by equalityEngine when a becomes (dis-)equal to b and a and b are shared with
    * the theory. Returns false if there is a direct conflict (via rewrite for example).
@@ -257,6 +272,15 @@ class SharedTermsDatabase : protected EnvObj, public context::ContextNotifyObj
    */
   bool areDisequal(TNode a, TNode b) const;
 
+  /**
+   * Adds to terms the shared terms of the equivalence classes that were
+   * merged or made disequal in the current SAT context, ignoring the first
+   * start changes. These are the shared terms for which areEqual or
+   * areDisequal may have become true since.
+   * @return The number of changes in the current SAT context.
+   */
+  size_t getTouchedTerms(size_t start, std::unordered_set<TNode>& terms) const;
+
   /**
    * get equality engine
    */
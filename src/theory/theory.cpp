@@ -67,6 +67,10 @@ Theory::Theory(TheoryId id,
                                                      + "checkTime")),
       d_computeCareGraphTime(statisticsRegistry().registerTimer(
           getStatsPrefix(id) + name + "computeCareGraphTime")),
+      d_carePairsExamined(statisticsRegistry().registerInt(
+          getStatsPrefix(id) + name + "carePairsExamined")),
+      d_carePairsSettled(statisticsRegistry().registerInt(
+          getStatsPrefix(id) + name + "carePairsSettled")),
       d_out(&out),
       d_valuation(valuation),
       d_equalityEngine(nullptr),
@@ -79,7 +83,10 @@ Theory::Theory(TheoryId id,
       d_id(id),
       d_facts(d_env.getContext()),
       d_factsHead(d_env.getContext(), 0),
-      d_careGraph(nullptr)
+      d_careGraph(nullptr),
+      d_numCareTerms(d_env.getContext(), 0),
+      d_numSharedChanges(d_env.getContext(), 0),
+      d_carePairTrail(d_env.getContext(), true, CarePairCleanUp(this))
 {
 }
 
@@ -256,32 +263,132 @@ void Theory::computeCareGraph()
 {
   Assert(d_theoryState != nullptr);
   Trace("sharing") << "Theory::computeCareGraph<" << getId() << ">()" << endl;
+  // If we know about the equality of a pair, we should have propagated it,
+  // so we can skip it. This remains the case until we backtrack.
+  auto isUnsettled = [this](TNode a, TNode b) {
+    ++d_carePairsExamined;
+    switch (d_valuation.getEqualityStatus(a, b))
+    {
+      case EQUALITY_TRUE_AND_PROPAGATED:
+      case EQUALITY_FALSE_AND_PROPAGATED: ++d_carePairsSettled; return false;
+      default: return true;
+    }
+  };
+  // The status of a candidate only changes when the class of one of its terms
+  // is merged or made disequal, so we only examine the candidates of such
+  // terms again.
+  std::unordered_set<TNode> touched;
+  d_numSharedChanges =
+      d_valuation.getSharedTouchedTerms(d_numSharedChanges, touched);
+  for (TNode t : touched)
+  {
+    std::unordered_map<TNode, std::vector<size_t>>::const_iterator it =
+        d_carePairsOf.find(t);
+    if (it == d_carePairsOf.end())
+    {
+      continue;
+    }
+    for (size_t i : it->second)
+    {
+      if (isCarePairUnsettled(i)
+          && !isUnsettled(d_carePairs[i].first, d_carePairs[i].second))
+      {
+        settleCarePair(i);
+      }
+    }
+  }
+  // Pair the shared terms registered since with the previous ones
   const context::CDList<TNode>& sharedTerms = d_theoryState->getSharedTerms();
   size_t ssize = sharedTerms.size();
-  for (size_t i = 0; i < ssize; ++i)
+  Assert(d_numCareTerms <= ssize);
+  for (size_t j = d_numCareTerms; j < ssize; ++j)
   {
-    TNode a = sharedTerms[i];
-    TypeNode aType = a.getType();
-    for (size_t j = i + 1; j < ssize; ++j)
+    TNode b = sharedTerms[j];
+    TypeNode bType = b.getType();
+    for (size_t i = 0; i < j; ++i)
     {
-      TNode b = sharedTerms[j];
-      if (b.getType() != aType)
+      TNode a = sharedTerms[i];
+      // We don't care about the terms of different types
+      if (a.getType() == bType && isUnsettled(a, b))
       {
-        // We don't care about the terms of different types
-        continue;
+        addCarePairCandidate(a, b);
       }
-      switch (d_valuation.getEqualityStatus(a, b)) {
-      case EQUALITY_TRUE_AND_PROPAGATED:
-      case EQUALITY_FALSE_AND_PROPAGATED:
-        // If we know about it, we should have propagated it, so we can skip
-        break;
-      default:
-        // Let's split on it
-        addCarePair(a, b);
-        break;
+    }
+  }
+  d_numCareTerms = ssize;
+  // Let's split on the remaining pairs
+  for (size_t i : d_unsettledPairs)
+  {
+    addCarePair(d_carePairs[i].first, d_carePairs[i].second);
+  }
+}
+
+bool Theory::isCarePairUnsettled(size_t i) const
+{
+  size_t pos = d_unsettledPos[i];
+  return pos < d_unsettledPairs.size() && d_unsettledPairs[pos] == i;
+}
+
+void Theory::addCarePairCandidate(TNode a, TNode b)
+{
+  size_t i = d_carePairs.size();
+  d_carePairs.emplace_back(a, b);
+  d_unsettledPos.push_back(d_unsettledPairs.size());
+  d_unsettledPairs.push_back(i);
+  d_carePairsOf[a].push_back(i);
+  d_carePairsOf[b].push_back(i);
+  d_carePairTrail.push_back({i, true, 0});
+}
+
+void Theory::settleCarePair(size_t i)
+{
+  Assert(isCarePairUnsettled(i));
+  size_t pos = d_unsettledPos[i];
+  size_t last = d_unsettledPairs.back();
+  d_unsettledPairs[pos] = last;
+  d_unsettledPos[last] = pos;
+  d_unsettledPairs.pop_back();
+  d_carePairTrail.push_back({i, false, pos});
+}
+
+Theory::CarePairCleanUp::CarePairCleanUp(Theory* t) : d_theory(t) {}
+
+void Theory::CarePairCleanUp::operator()(CarePairChange& c)
+{
+  std::vector<size_t>& unsettled = d_theory->d_unsettledPairs;
+  if (c.d_added)
+  {
+    // the candidate is the last one added, and unsettled
+    Assert(c.d_pair + 1 == d_theory->d_carePairs.size());
+    Assert(unsettled.back() == c.d_pair);
+    unsettled.pop_back();
+    d_theory->d_unsettledPos.pop_back();
+    const std::pair<TNode, TNode>& p = d_theory->d_carePairs.back();
+    for (TNode t : {p.first, p.second})
+    {
+      std::vector<size_t>& tpairs = d_theory->d_carePairsOf[t];
+      Assert(!tpairs.empty() && tpairs.back() == c.d_pair);
+      tpairs.pop_back();
+      if (tpairs.empty())
+      {
+        d_theory->d_carePairsOf.erase(t);
       }
     }
+    d_theory->d_carePairs.pop_back();
+    return;
+  }
+  // move the candidate back to its position, and the candidate that took it
+  // back to the end
+  size_t last = unsettled.size();
+  unsettled.push_back(c.d_pair);
+  if (c.d_pos != last)
+  {
+    size_t moved = unsettled[c.d_pos];
+    unsettled[last] = moved;
+    d_theory->d_unsettledPos[moved] = last;
+    unsettled[c.d_pos] = c.d_pair;
   }
+  d_theory->d_unsettledPos[c.d_pair] = c.d_pos;
 }
 
 void Theory::printFacts(std::ostream& os) const {
@@ -19,9 +19,12 @@
 #define CVC5__THEORY__THEORY_H
 
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "context/cdlist.h"
 #include "context/cdo.h"
@@ -113,6 +116,13 @@ class Theory : protected EnvObj
   TimerStat d_checkTime;
   /** time spent in theory combination */
   TimerStat d_computeCareGraphTime;
+  /** number of pairs of terms examined when computing the care graph */
+  IntStat d_carePairsExamined;
+  /**
+   * number of pairs of shared terms dropped from the candidate care pairs,
+   * since their equality status was settled in the current SAT context
+   */
+  IntStat d_carePairsSettled;
 
   /** Add (t1, t2) to the care graph */
   void addCarePair(TNode t1, TNode t2);
@@ -796,6 +806,58 @@ class Theory : protected EnvObj
   /** The care graph the theory will use during combination. */
   CareGraph* d_careGraph;
 
+  /** Returns true if the candidate care pair i is unsettled. */
+  bool isCarePairUnsettled(size_t i) const;
+  /** Add the candidate care pair (a, b), which is unsettled. */
+  void addCarePairCandidate(TNode a, TNode b);
+  /** Remove the candidate care pair i from the unsettled ones. */
+  void settleCarePair(size_t i);
+  /**
+   * The candidate care pairs of the default implementation of
+   * computeCareGraph. These are pairs of shared terms of the same type that
+   * were neither equal nor disequal according to theory combination when
+   * they were added in the current SAT context.
+   */
+  std::vector<std::pair<TNode, TNode>> d_carePairs;
+  /**
+   * The candidates that are still neither equal nor disequal, by index in
+   * d_carePairs. These are added to the care graph.
+   */
+  std::vector<size_t> d_unsettledPairs;
+  /** The position of each unsettled candidate in d_unsettledPairs */
+  std::vector<size_t> d_unsettledPos;
+  /** The candidates of each shared term, by index in d_carePairs */
+  std::unordered_map<TNode, std::vector<size_t>> d_carePairsOf;
+  /** The number of shared terms whose candidates were added */
+  context::CDO<size_t> d_numCareTerms;
+  /** The number of changes to shared equalities processed by the candidates */
+  context::CDO<size_t> d_numSharedChanges;
+  /** A change to the candidate care pairs */
+  struct CarePairChange
+  {
+    /** The candidate */
+    size_t d_pair;
+    /** Whether the candidate was added, otherwise it was settled */
+    bool d_added;
+    /** The position of a settled candidate in d_unsettledPairs */
+    size_t d_pos;
+  };
+  /** Undoes a change to the candidate care pairs */
+  class CarePairCleanUp
+  {
+   public:
+    CarePairCleanUp(Theory* t);
+    void operator()(CarePairChange& c);
+
+   private:
+    Theory* d_theory;
+  };
+  /**
+   * The changes to the candidate care pairs in the current SAT context, which
+   * are undone on backtracking. This must be destroyed before the candidates.
+   */
+  context::CDList<CarePairChange, CarePairCleanUp> d_carePairTrail;
+
   /** Pointer to the decision manager. */
   DecisionManager* d_decManager;
 }; /* class Theory */
@@ -15,6 +15,8 @@
 
 #include "theory/theory_engine.h"
 
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 
 #include "base/map_util.h"
@@ -22,6 +24,7 @@
 #include "expr/attribute.h"
 #include "expr/node_builder.h"
 #include "expr/node_visitor.h"
+#include "options/base_options.h"
 #include "options/parallel_options.h"
 #include "options/quantifiers_options.h"
 #include "options/smt_options.h"
@@ -33,6 +36,7 @@
 #include "prop/prop_engine.h"
 #include "smt/env.h"
 #include "smt/logic_exception.h"
+#include "smt/profiler.h"
 #include "smt/solver_engine_state.h"
 #include "theory/combination_care_graph.h"
 #include "theory/conflict_processor.h"
@@ -63,6 +67,23 @@ namespace cvc5::internal {
 
 namespace theory {
 
+namespace {
+
+/** Get the name of the check of the given effort in profiles */
+const char* getCheckProfileName(Theory::Effort effort)
+{
+  switch (effort)
+  {
+    case Theory::EFFORT_STANDARD: return "check-standard";
+    case Theory::EFFORT_FULL: return "check-full";
+    case Theory::EFFORT_LAST_CALL: return "check-last-call";
+    default: Unreachable();
+  }
+  return "";
+}
+
+}  // namespace
+
 /**
  * IMPORTANT: The order of the theories is important. For example, strings
  *            depends on arith, quantifiers needs to come as the very last.
@@ -244,7 +265,10 @@ TheoryEngine::TheoryEngine(Env& env)
       d_interrupted(false),
       d_inPreregister(false),
       d_factsAsserted(context(), false),
-      d_cp(nullptr)
+      d_cp(nullptr),
+      d_useLemmaCache(options().theory.lemmaCache),
+      d_lemmaCache(userContext()),
+      d_lemmaCost(options().base.statistics)
 {
   for(TheoryId theoryId = theory::THEORY_FIRST; theoryId != theory::THEORY_LAST;
       ++ theoryId)
@@ -380,13 +404,19 @@ void TheoryEngine::check(Theory::Effort effort) {
   // Reset the interrupt flag
   d_interrupted = false;
 
+  Profiler* prof = profiler();
+  Profiler::Scope checkScope(prof, getCheckProfileName(effort));
+
 #ifdef CVC5_FOR_EACH_THEORY_STATEMENT
 #undef CVC5_FOR_EACH_THEORY_STATEMENT
 #endif
 #define CVC5_FOR_EACH_THEORY_STATEMENT(THEORY)                           \
   if (theory::TheoryTraits<THEORY>::hasCheck && isTheoryEnabled(THEORY)) \
   {                                                                      \
-    theoryOf(THEORY)->check(effort);                                     \
+    {                                                                    \
+      Profiler::Scope theoryScope(prof, toString(THEORY));               \
+      theoryOf(THEORY)->check(effort);                                   \
+    }                                                                    \
     if (d_inConflict)                                                    \
     {                                                                    \
       Trace("conflict") << THEORY << " in conflict. " << std::endl;      \
@@ -421,6 +451,7 @@ void TheoryEngine::check(Theory::Effort effort) {
     // check with the theory modules
     for (TheoryEngineModule* tem : d_modules)
     {
+      Profiler::Scope moduleScope(prof, tem->getName());
       tem->check(effort);
     }
 
@@ -452,7 +483,10 @@ void TheoryEngine::check(Theory::Effort effort) {
       Trace("theory") << "TheoryEngine::check(" << effort << "): running propagation after the initial check" << endl;
 
       // We are still satisfiable, propagate as much as possible
-      propagate(effort);
+      {
+        Profiler::Scope propagateScope(prof, "propagate");
+        propagate(effort);
+      }
 
       // Interrupt in case we reached a resource limit.
       if (rm->out())
@@ -475,6 +509,7 @@ void TheoryEngine::check(Theory::Effort effort) {
           {
             TimerStat::CodeTimer combineTheoriesTimer(
                 d_stats.d_combineTheoriesTime);
+            Profiler::Scope combineScope(prof, "combination");
             d_tc->combineTheories();
           }
           if (logicInfo().isQuantified())
@@ -522,6 +557,9 @@ void TheoryEngine::check(Theory::Effort effort) {
                 // uniformity ask all theories needsCheckLastEffort method.
                 continue;
               }
+              Profiler::Scope lastCallScope(
+                  prof, getCheckProfileName(Theory::EFFORT_LAST_CALL));
+              Profiler::Scope theoryScope(prof, toString(theoryId));
               theory->check(Theory::EFFORT_LAST_CALL);
             }
           }
@@ -532,6 +570,9 @@ void TheoryEngine::check(Theory::Effort effort) {
         if (logicInfo().isQuantified())
         {
           // quantifiers engine must check at last call effort
+          Profiler::Scope lastCallScope(
+              prof, getCheckProfileName(Theory::EFFORT_LAST_CALL));
+          Profiler::Scope quantScope(prof, toString(THEORY_QUANTIFIERS));
           d_quantEngine->check(Theory::EFFORT_LAST_CALL);
         }
         // notify the theory modules of the model
@@ -547,6 +588,7 @@ void TheoryEngine::check(Theory::Effort effort) {
             // model failed to build, we are done
             break;
           }
+          Profiler::Scope moduleScope(prof, tem->getName());
           tem->notifyCandidateModel(getModel());
         }
       }
@@ -558,6 +600,7 @@ void TheoryEngine::check(Theory::Effort effort) {
     // post check with the theory modules
     for (TheoryEngineModule* tem : d_modules)
     {
+      Profiler::Scope moduleScope(prof, tem->getName());
       tem->postCheck(effort);
     }
     if (Theory::fullEffort(effort))
@@ -1248,6 +1291,12 @@ theory::EqualityStatus TheoryEngine::getEqualityStatus(TNode a, TNode b)
   return d_sharedSolver->getEqualityStatus(a, b);
 }
 
+size_t TheoryEngine::getSharedTouchedTerms(
+    size_t start, std::unordered_set<TNode>& terms) const
+{
+  return d_sharedSolver->getTouchedTerms(start, terms);
+}
+
 void TheoryEngine::getDifficultyMap(std::map<Node, Node>& dmap,
                                     bool includeLemmas)
 {
@@ -1485,6 +1534,7 @@ void TheoryEngine::lemma(TrustNode tlemma,
   // minimize or generalize conflict
   if (d_cp)
   {
+    Profiler::Scope cpScope(profiler(), "ConflictProcessor");
     TrustNode tproc = d_cp->processLemma(tlemma);
     if (!tproc.isNull())
     {
@@ -1520,8 +1570,48 @@ void TheoryEngine::lemma(TrustNode tlemma,
         options(), "te-proof-debug", "TheoryEngine::lemma_initial");
   }
 
-  // assert the lemma
-  d_propEngine->assertLemma(id, tlemma, p);
+  // Do not send lemmas that were already sent in this user context. We only
+  // consider lemmas that are neither removable nor local, since these persist
+  // in the SAT solver for the remainder of the user context. We still mark
+  // that lemmas were added below, so that the control flow of check does not
+  // depend on the cache.
+  if (d_useLemmaCache && tlemma.getKind() == TrustNodeKind::LEMMA
+      && !isLemmaPropertyRemovable(p) && !isLemmaPropertyLocal(p)
+      && !d_lemmaCache.insert(getLemmaCacheKey(lemma)))
+  {
+    Trace("te-lemma-cache") << "Duplicate lemma " << lemma << " from " << id
+                            << std::endl;
+    ++d_stats.d_lemmasDuplicate;
+    d_lemmasAdded = true;
+    return;
+  }
+
+  // assert the lemma, tracking its cost if statistics are enabled
+  d_stats.d_lemmaIds << id;
+  Profiler* prof = profiler();
+  if (prof != nullptr)
+  {
+    // attribute the lemma to the component that sent it
+    prof->notifyLemma();
+  }
+  Profiler::Scope lemmaScope(prof, "lemma");
+  if (d_lemmaCost)
+  {
+    uint64_t clausesBefore = d_propEngine->getNumClauses();
+    auto start = std::chrono::steady_clock::now();
+    d_propEngine->assertLemma(id, tlemma, p);
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+    d_stats.d_lemmaIdTimeUs.add(id, us.count());
+    d_stats.d_lemmaIdClauses.add(
+        id, d_propEngine->getNumClauses() - clausesBefore);
+    d_stats.d_lemmaIdLiterals.add(
+        id, lemma.getKind() == Kind::OR ? lemma.getNumChildren() : 1);
+  }
+  else
+  {
+    d_propEngine->assertLemma(id, tlemma, p);
+  }
 
   // If specified, we must add this lemma to the set of those that need to be
   // justified, where note we pass all auxiliary lemmas in skAsserts as well,
@@ -1548,6 +1638,18 @@ void TheoryEngine::lemma(TrustNode tlemma,
   d_lemmasAdded = true;
 }
 
+Node TheoryEngine::getLemmaCacheKey(const Node& lemma)
+{
+  Node key = rewrite(lemma);
+  if (key.getKind() == Kind::OR)
+  {
+    std::vector<Node> lits(key.begin(), key.end());
+    std::sort(lits.begin(), lits.end());
+    key = nodeManager()->mkNode(Kind::OR, lits);
+  }
+  return key;
+}
+
 void TheoryEngine::markInConflict()
 {
 #ifdef CVC5_FOR_EACH_THEORY_STATEMENT
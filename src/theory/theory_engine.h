@@ -19,10 +19,12 @@
 #define CVC5__THEORY_ENGINE_H
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "base/check.h"
 #include "context/cdhashmap.h"
+#include "context/cdhashset.h"
 #include "expr/node.h"
 #include "options/theory_options.h"
 #include "proof/trust_node.h"
@@ -397,6 +399,10 @@ class TheoryEngine : protected EnvObj
    */
   theory::EqualityStatus getEqualityStatus(TNode a, TNode b);
 
+  /** Returns the touched terms of the shared solver. */
+  size_t getSharedTouchedTerms(size_t start,
+                               std::unordered_set<TNode>& terms) const;
+
   /**
    * Returns the value that a theory that owns the type of var currently
    * has (or null if none);
@@ -472,6 +478,12 @@ class TheoryEngine : protected EnvObj
   /** set in conflict */
   void markInConflict();
 
+  /**
+   * Get the key of lemma in d_lemmaCache, which is its rewritten form, where
+   * the disjuncts of a top-level disjunction are sorted.
+   */
+  Node getLemmaCacheKey(const Node& lemma);
+
   /** Called by the theories to notify that the current branch is incomplete. */
   void setModelUnsound(theory::TheoryId theory, theory::IncompleteId id);
   /** Called by the theories to notify that we are unsound (user-context). */
@@ -689,6 +701,15 @@ class TheoryEngine : protected EnvObj
   std::vector<theory::TheoryEngineModule*> d_modules;
   /** Conflict processor */
   std::unique_ptr<theory::ConflictProcessor> d_cp;
+  /** Whether --lemma-cache is enabled */
+  bool d_useLemmaCache;
+  /**
+   * The lemmas sent in the current user context, normalized by
+   * getLemmaCacheKey, if --lemma-cache is enabled.
+   */
+  context::CDHashSet<Node> d_lemmaCache;
+  /** Whether we track the cost of lemmas per inference identifier */
+  bool d_lemmaCost;
   /** User plugin modules */
   std::vector<std::unique_ptr<theory::PluginModule>> d_userPlugins;
 
@@ -50,5 +50,7 @@ void TheoryEngineModule::notifyCandidateModel(TheoryModel* m) {}
 
 TheoryId TheoryEngineModule::getId() const { return d_out.getId(); }
 
+const std::string& TheoryEngineModule::getName() const { return d_name; }
+
 }  // namespace theory
 }  // namespace cvc5::internal
@@ -83,6 +83,8 @@ class TheoryEngineModule : protected EnvObj
   virtual void notifyCandidateModel(TheoryModel* m);
   /** Get the theory identifier */
   TheoryId getId() const;
+  /** Get the name */
+  const std::string& getName() const;
 
  protected:
   /** The output channel, for sending lemmas */
@@ -25,7 +25,15 @@ TheoryEngineStatistics::TheoryEngineStatistics(StatisticsRegistry& sr)
       d_fullEffortChecks(sr.registerInt("TheoryEngine::Checks_Full")),
       d_combineTheoriesCalls(
           sr.registerInt("TheoryEngine::combineTheoriesCalls")),
-      d_lcEffortChecks(sr.registerInt("TheoryEngine::Checks_Last_Call"))
+      d_lcEffortChecks(sr.registerInt("TheoryEngine::Checks_Last_Call")),
+      d_lemmaIds(sr.registerHistogram<InferenceId>("TheoryEngine::lemmaIds")),
+      d_lemmaIdLiterals(sr.registerHistogram<InferenceId>(
+          "TheoryEngine::lemmaIdLiterals")),
+      d_lemmaIdClauses(
+          sr.registerHistogram<InferenceId>("TheoryEngine::lemmaIdClauses")),
+      d_lemmaIdTimeUs(
+          sr.registerHistogram<InferenceId>("TheoryEngine::lemmaIdTimeUs")),
+      d_lemmasDuplicate(sr.registerInt("TheoryEngine::lemmasDuplicate"))
 {
 }
 
@@ -18,6 +18,7 @@
 #ifndef CVC5__THEORY__THEORY_ENGINE_STATISTICS_H
 #define CVC5__THEORY__THEORY_ENGINE_STATISTICS_H
 
+#include "theory/inference_id.h"
 #include "util/statistics_registry.h"
 #include "util/statistics_stats.h"
 
@@ -42,6 +43,19 @@ class TheoryEngineStatistics
   IntStat d_combineTheoriesCalls;
   /** Number of last call effort checks */
   IntStat d_lcEffortChecks;
+  /** Number of lemmas sent, per inference identifier */
+  HistogramStat<InferenceId> d_lemmaIds;
+  /** Total number of top-level disjuncts of lemmas, per inference identifier */
+  HistogramStat<InferenceId> d_lemmaIdLiterals;
+  /** Total number of clauses added to the CNF, per inference identifier */
+  HistogramStat<InferenceId> d_lemmaIdClauses;
+  /**
+   * Total time in microseconds spent preprocessing and converting lemmas to
+   * CNF, per inference identifier
+   */
+  HistogramStat<InferenceId> d_lemmaIdTimeUs;
+  /** Number of lemmas not sent since they were sent before */
+  IntStat d_lemmasDuplicate;
 };
 
 }  // namespace theory
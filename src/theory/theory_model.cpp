@@ -22,6 +22,7 @@
 #include "options/theory_options.h"
 #include "options/uf_options.h"
 #include "smt/env.h"
+#include "theory/theory_model_builder.h"
 #include "theory/trust_substitutions.h"
 #include "theory/uf/function_const.h"
 #include "util/rational.h"
@@ -38,7 +39,8 @@ TheoryModel::TheoryModel(Env& env, std::string name, bool enableFuncModels)
       d_name(name),
       d_equalityEngine(nullptr),
       d_using_model_core(false),
-      d_enableFuncModels(enableFuncModels)
+      d_enableFuncModels(enableFuncModels),
+      d_lazyBuilder(nullptr)
 {
   // must use function models when ufHo is enabled
   Assert(d_enableFuncModels || !logicInfo().isHigherOrder());
@@ -89,6 +91,7 @@ void TheoryModel::reset(){
   d_uf_terms.clear();
   d_ho_uf_terms.clear();
   d_uf_models.clear();
+  d_lazyBuilder = nullptr;
   d_using_model_core = false;
   d_model_core.clear();
 }
@@ -114,6 +117,7 @@ std::vector<Node> TheoryModel::getDomainElements(TypeNode tn) const
   // must be an uninterpreted sort
   Assert(tn.isUninterpretedSort());
   std::vector<Node> elements;
+  assignDeferredValues(tn);
   const std::vector<Node>* type_refs = d_rep_set.getTypeRepsOrNull(tn);
   if (type_refs == nullptr || type_refs->empty())
   {
@@ -179,6 +183,7 @@ size_t TheoryModel::getCardinality(const TypeNode& tn) const
 {
   //for now, we only handle cardinalities for uninterpreted sorts
   Assert(tn.isUninterpretedSort());
+  assignDeferredValues(tn);
   if (d_rep_set.hasType(tn))
   {
     Trace("model-getvalue-debug")
@@ -294,8 +299,13 @@ Node TheoryModel::getModelValue(TNode n) const
     Trace("model-getvalue-debug")
         << "get value from representative " << ret << "..." << std::endl;
     ret = d_equalityEngine->getRepresentative(ret);
-    Assert(d_reps.find(ret) != d_reps.end());
     std::map<Node, Node>::const_iterator it2 = d_reps.find(ret);
+    if (it2 == d_reps.end())
+    {
+      assignDeferredValues(t);
+      it2 = d_reps.find(ret);
+    }
+    Assert(it2 != d_reps.end());
     if (it2 != d_reps.end())
     {
       ret = it2->second;
@@ -336,6 +346,13 @@ Node TheoryModel::getModelValue(TNode n) const
       if (d_enableFuncModels)
       {
         std::map<Node, Node>::const_iterator entry = d_uf_models.find(n);
+        if (entry == d_uf_models.end() && d_lazyBuilder != nullptr
+            && hasUfTerms(n) && isAssignableUf(n))
+        {
+          // the value of n was deferred, assign it now
+          ret = d_lazyBuilder->getFunctionValue(this, n);
+          entry = d_uf_models.emplace(n, ret).first;
+        }
         if (entry != d_uf_models.end())
         {
           // Existing function
@@ -653,12 +670,19 @@ bool TheoryModel::hasTerm(TNode a)
   return d_equalityEngine->hasTerm( a );
 }
 
-Node TheoryModel::getRepresentative(TNode a)
+Node TheoryModel::getRepresentative(TNode a) const
 {
   if( d_equalityEngine->hasTerm( a ) ){
     Node r = d_equalityEngine->getRepresentative( a );
-    if( d_reps.find( r )!=d_reps.end() ){
-      return d_reps[ r ];
+    std::map<Node, Node>::const_iterator it = d_reps.find(r);
+    if (it == d_reps.end())
+    {
+      assignDeferredValues(r.getType());
+      it = d_reps.find(r);
+    }
+    if (it != d_reps.end())
+    {
+      return it->second;
     }else{
       return r;
     }
@@ -687,6 +711,48 @@ bool TheoryModel::areDisequal(TNode a, TNode b)
   }
 }
 
+const RepSet* TheoryModel::getRepSet() const
+{
+  assignDeferredValues();
+  return &d_rep_set;
+}
+
+RepSet* TheoryModel::getRepSetPtr()
+{
+  assignDeferredValues();
+  return &d_rep_set;
+}
+
+void TheoryModel::assignDeferredValues(const TypeNode& tn) const
+{
+  if (d_lazyBuilder == nullptr || !d_lazyBuilder->hasDeferredValues(tn))
+  {
+    return;
+  }
+  std::map<Node, Node> vals;
+  d_lazyBuilder->assignDeferredValues(tn, vals);
+  for (const std::pair<const Node, Node>& v : vals)
+  {
+    d_rep_set.setTermForRepresentative(v.second, v.first);
+    d_reps[v.first] = v.second;
+    d_rep_set.add(tn, v.second);
+  }
+}
+
+void TheoryModel::assignDeferredValues() const
+{
+  if (d_lazyBuilder == nullptr)
+  {
+    return;
+  }
+  std::vector<TypeNode> types;
+  d_lazyBuilder->getDeferredTypes(types);
+  for (const TypeNode& tn : types)
+  {
+    assignDeferredValues(tn);
+  }
+}
+
 bool TheoryModel::hasUfTerms(Node f) const
 {
   return d_uf_terms.find(f) != d_uf_terms.end();
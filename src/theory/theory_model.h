@@ -35,6 +35,8 @@ class Env;
 
 namespace theory {
 
+class TheoryEngineModelBuilder;
+
 /** Theory Model class.
  *
  * This class represents a model produced by the TheoryEngine.
@@ -74,6 +76,11 @@ namespace theory {
  * The above functions can be used for a model m after it has been
  * successfully built, i.e. when m->isBuiltSuccess() returns true.
  *
+ * With --lazy-model-values, the model builder may defer assigning the values
+ * of some equivalence classes of uninterpreted sorts and of uninterpreted
+ * functions. These are assigned by the first of the above functions that
+ * requires them, which is why the data structures (2)-(4) are mutable.
+ *
  * Additionally, all of the above functions, with the exception of getValue,
  * can be used during step (5) of TheoryEngineModelBuilder::buildModel, as
  * documented in theory_model_builder.h. In particular, we make calls to the
@@ -254,7 +261,7 @@ class TheoryModel : protected EnvObj
   /** does the equality engine of this model have term a? */
   bool hasTerm(TNode a);
   /** get the representative of a in the equality engine of this model */
-  Node getRepresentative(TNode a);
+  Node getRepresentative(TNode a) const;
   /** are a and b equal in the equality engine of this model? */
   bool areEqual(TNode a, TNode b);
   /** are a and b disequal in the equality engine of this model? */
@@ -279,9 +286,9 @@ class TheoryModel : protected EnvObj
   /** get domain elements for uninterpreted sort t */
   std::vector<Node> getDomainElements(TypeNode t) const;
   /** get the representative set object */
-  const RepSet* getRepSet() const { return &d_rep_set; }
+  const RepSet* getRepSet() const;
   /** get the representative set object (FIXME: remove this, see #1199) */
-  RepSet* getRepSetPtr() { return &d_rep_set; }
+  RepSet* getRepSetPtr();
 
   //---------------------------- model cores
   /** True if a model core has been computed for this model. */
@@ -364,7 +371,7 @@ class TheoryModel : protected EnvObj
    * Map of representatives of equality engine to used representatives in
    * representative set
    */
-  std::map<Node, Node> d_reps;
+  mutable std::map<Node, Node> d_reps;
   /** Map of terms to their assignment exclusion set. */
   std::map<Node, std::vector<Node> > d_assignExcSet;
   /**
@@ -377,7 +384,7 @@ class TheoryModel : protected EnvObj
   /** Reverse of the above map */
   std::map<Node, std::vector<Node> > d_aesSlaves;
   /** stores set of representatives for each type */
-  RepSet d_rep_set;
+  mutable RepSet d_rep_set;
   /** true/false nodes */
   Node d_true;
   Node d_false;
@@ -418,6 +425,13 @@ class TheoryModel : protected EnvObj
    * @return The model values of the arguments of n.
    */
   std::vector<Node> getModelValueArgs(TNode n) const;
+  /**
+   * Assign the values of the equivalence classes of type tn whose values were
+   * deferred by the model builder, if any.
+   */
+  void assignDeferredValues(const TypeNode& tn) const;
+  /** Assign the values of all equivalence classes that were deferred. */
+  void assignDeferredValues() const;
 
  private:
   /** cache for getModelValue */
@@ -447,7 +461,12 @@ class TheoryModel : protected EnvObj
    * After the model is built, the domain of this map is all terms of function
    * type that appear as terms in d_equalityEngine.
    */
-  std::map<Node, Node> d_uf_models;
+  mutable std::map<Node, Node> d_uf_models;
+  /**
+   * The model builder that assigns deferred values on demand, or nullptr if
+   * all values have been assigned when building this model.
+   */
+  TheoryEngineModelBuilder* d_lazyBuilder;
   //---------------------------- end function values
 };/* class TheoryModel */
 
@@ -16,9 +16,11 @@
 
 #include "expr/dtype.h"
 #include "expr/dtype_cons.h"
+#include "expr/node_algorithm.h"
 #include "expr/skolem_manager.h"
 #include "expr/sort_to_term.h"
 #include "expr/sort_type_size.h"
+#include "options/base_options.h"
 #include "options/quantifiers_options.h"
 #include "options/smt_options.h"
 #include "options/strings_options.h"
@@ -37,7 +39,17 @@ using namespace cvc5::context;
 namespace cvc5::internal {
 namespace theory {
 
-TheoryEngineModelBuilder::TheoryEngineModelBuilder(Env& env) : EnvObj(env) {}
+TheoryEngineModelBuilder::TheoryEngineModelBuilder(Env& env)
+    : EnvObj(env), d_reuseValues(false), d_stats(statisticsRegistry())
+{
+}
+
+TheoryEngineModelBuilder::Statistics::Statistics(StatisticsRegistry& sr)
+    : d_eqcEnumerated(
+        sr.registerInt("TheoryEngineModelBuilder::eqcEnumerated")),
+      d_eqcReused(sr.registerInt("TheoryEngineModelBuilder::eqcReused"))
+{
+}
 
 void TheoryEngineModelBuilder::Assigner::initialize(
     TypeNode tn, TypeEnumeratorProperties* tep, const std::vector<Node>& aes)
@@ -406,6 +418,16 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
          ", collect representatives and compute assignable information..."
       << std::endl;
 
+  // In incremental mode, we try to give equivalence classes the values they
+  // had in the previous model. We do not do this with finite model finding,
+  // since previous values may violate the cardinality bounds of the current
+  // model.
+  d_reuseValues = options().base.incrementalSolving
+                  && !options().quantifiers.finiteModelFind;
+  d_nextValues.clear();
+  d_deferredEqc.clear();
+  d_deferredUsedValues.clear();
+
   // type enumerator properties
   bool tepFixUSortCard = options().quantifiers.finiteModelFind;
   uint32_t tepStrAlphaCard = options().strings.stringsAlphaCard;
@@ -449,6 +471,11 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
   // assigner object with (all elements in the range of this map are in the
   // domain of eqcToAssigner).
   std::map<Node, Node> eqcToAssignerMaster;
+  // The previous values reserved for equivalence classes assigned by
+  // enumeration (if d_reuseValues is true), and the types for which they were
+  // reserved.
+  std::map<Node, Node> reusedValues;
+  std::unordered_set<TypeNode> reusedTypes;
 
   // Loop through equivalence classes of the equality engine of the model.
   eq::EqualityEngine* ee = tm->d_equalityEngine;
@@ -459,6 +486,20 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
   bool computeAssigners = tm->hasAssignmentExclusionSets();
   // the set of exclusion sets we have processed
   std::unordered_set<Node> processedExcSet;
+  // Should we defer assigning values to equivalence classes of uninterpreted
+  // sorts until they are requested? We do not do this if the values of
+  // previous models are reused, since they are mapped at the end of this
+  // method, nor if values are restricted by assignment exclusion sets or
+  // finite model finding, or if the model is needed by quantifiers.
+  bool deferValues = options().theory.lazyModelValues
+                     && !logicInfo().isHigherOrder()
+                     && !logicInfo().isQuantified()
+                     && !options().quantifiers.finiteModelFind
+                     && !options().smt.checkModels && !d_reuseValues
+                     && !computeAssigners;
+  // The types of subterms of terms that are evaluated or normalized below,
+  // whose values we thus cannot defer.
+  std::unordered_set<TypeNode> evalTypes;
   for (; !eqcs_i.isFinished(); ++eqcs_i)
   {
     Node eqc = *eqcs_i;
@@ -490,6 +531,8 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
     // were assigned (see the argument group of
     // TheoryModel::getAssignmentExclusionSet).
     std::vector<Node> esetGroup;
+    // The terms in this equivalence class that are not assignable nor values.
+    std::vector<Node> evalTerms;
 
     // Loop through terms in this EC
     eq::EqClassIterator eqc_i = eq::EqClassIterator(eqc, ee);
@@ -572,6 +615,10 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
           continue;
         }
 
+        if (deferValues)
+        {
+          evalTerms.push_back(n);
+        }
         // If we don't have a constant rep, check if this is an assigned rep.
         itm = tm->d_reps.find(n);
         if (itm != tm->d_reps.end())
@@ -649,7 +696,11 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
       typeConstSet.add(eqct, constRep);
       continue;
     }
-    else if (!rep.isNull())
+    for (const Node& n : evalTerms)
+    {
+      expr::getTypes(n, evalTypes);
+    }
+    if (!rep.isNull())
     {
       assertedReps[eqc] = rep;
       typeRepSet.add(eqct, eqc);
@@ -737,6 +788,39 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
     typeConstSet.setTypeEnumeratorProperties(&tep);
   }
 
+  // Compute the uninterpreted sorts whose values we defer. These must not
+  // be component types of other types we assign values to, since their values
+  // are enumerated using the values of the uninterpreted sort.
+  std::unordered_set<TypeNode> deferredTypes;
+  if (deferValues)
+  {
+    for (const TypeNode& t : type_list)
+    {
+      if (t.isUninterpretedSort())
+      {
+        continue;
+      }
+      if (t.isDatatype() && t.getDType().involvesUninterpretedType())
+      {
+        deferValues = false;
+        break;
+      }
+      expr::getComponentTypes(t, evalTypes);
+    }
+  }
+  if (deferValues)
+  {
+    for (const TypeNode& t : type_list)
+    {
+      if (t.isUninterpretedSort() && evalTypes.find(t) == evalTypes.end())
+      {
+        Trace("model-builder") << "Defer assigning values of type " << t
+                               << std::endl;
+        deferredTypes.insert(t);
+      }
+    }
+  }
+
   // Need to ensure that each EC has a constant representative.
 
   Trace("model-builder") << "Processing EC's..." << std::endl;
@@ -767,6 +851,10 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
       for (type_it = type_list.begin(); type_it != type_list.end(); ++type_it)
       {
         TypeNode t = *type_it;
+        if (deferredTypes.find(t) != deferredTypes.end())
+        {
+          continue;
+        }
         TypeNode tb = t;
         set<Node>* noRepSet = typeNoRepSet.getSet(t);
 
@@ -890,7 +978,7 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
       // continue if there are no more equivalence classes of this type to
       // assign
       std::set<Node>* noRepSetPtr = typeNoRepSet.getSet(t);
-      if (noRepSetPtr == NULL)
+      if (noRepSetPtr == NULL || deferredTypes.find(t) != deferredTypes.end())
       {
         continue;
       }
@@ -936,6 +1024,32 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
       std::map<Node, Assigner>::iterator itAssigner;
       std::map<Node, Node>::iterator itAssignerM;
       set<Node>* repSet = typeRepSet.getSet(t);
+      if (d_reuseValues && !isCorecursive
+          && (t.isUninterpretedSort() || !d_env.isFiniteType(t))
+          && reusedTypes.insert(t).second)
+      {
+        // Reserve the previous values of all classes of this type before
+        // enumerating, so that a value enumerated for one class is never the
+        // previous value of another one.
+        for (const Node& eqc : noRepSet)
+        {
+          if (evaluableEqc.find(eqc) != evaluableEqc.end()
+              || assignableEqc.find(eqc) == assignableEqc.end()
+              || eqcToAssigner.find(eqc) != eqcToAssigner.end()
+              || eqcToAssignerMaster.find(eqc) != eqcToAssignerMaster.end())
+          {
+            continue;
+          }
+          std::vector<Node> eqcTerms;
+          Node v = getPreviousValue(
+              tm, eqc, t, typeConstSet.getSet(t), eqcTerms);
+          if (!v.isNull())
+          {
+            typeConstSet.add(t, v);
+            reusedValues[eqc] = v;
+          }
+        }
+      }
       for (i = noRepSet.begin(); i != noRepSet.end();)
       {
         i2 = i;
@@ -1000,8 +1114,30 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
             // assign uninterpreted constants to equivalence classes in its
             // collectModelValues method. Doing so would have the same effect
             // as running the code in this case.
-            bool success;
-            do
+            std::vector<Node> eqcTerms;
+            if (d_reuseValues && !isCorecursive)
+            {
+              // collect the terms whose values are remembered
+              getPreviousValue(tm, *i2, t, nullptr, eqcTerms);
+              std::map<Node, Node>::iterator itr = reusedValues.find(*i2);
+              if (itr != reusedValues.end())
+              {
+                n = itr->second;
+              }
+            }
+            bool success = !n.isNull();
+            if (success)
+            {
+              // the value was reserved in typeConstSet above
+              Trace("model-builder-debug")
+                  << "Reuse previous value " << n << std::endl;
+              ++d_stats.d_eqcReused;
+            }
+            else
+            {
+              ++d_stats.d_eqcEnumerated;
+            }
+            while (!success)
             {
               Trace("model-builder-debug") << "Enumerate term of type " << t
                                            << std::endl;
@@ -1048,8 +1184,12 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
                 }
               }
               //---
-            } while (!success);
+            }
             Assert(!n.isNull());
+            for (const Node& e : eqcTerms)
+            {
+              d_nextValues[e] = n;
+            }
           }
           else
           {
@@ -1138,12 +1278,29 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
   for (it = typeNoRepSet.begin(); it != typeNoRepSet.end(); ++it)
   {
     set<Node>& noRepSet = TypeSet::getSet(it);
+    TypeNode t = TypeSet::getType(it);
+    if (deferredTypes.find(t) != deferredTypes.end())
+    {
+      // remember the classes and used values, which are assigned on demand
+      d_deferredEqc[t] = noRepSet;
+      set<Node>* usedValues = typeConstSet.getSet(t);
+      if (usedValues != nullptr)
+      {
+        d_deferredUsedValues[t] = *usedValues;
+      }
+      continue;
+    }
     for (const Node& node : noRepSet)
     {
       tm->assignRepresentative(node, node, false);
     }
   }
 
+  if (!d_deferredEqc.empty())
+  {
+    tm->d_lazyBuilder = this;
+  }
+
   // modelBuilder-specific initialization
   if (!processBuildModel(tm))
   {
@@ -1151,10 +1308,53 @@ bool TheoryEngineModelBuilder::buildModel(TheoryModel* tm)
         << "TheoryEngineModelBuilder: fail process build model." << std::endl;
     return false;
   }
+  if (d_reuseValues)
+  {
+    d_prevValues.swap(d_nextValues);
+    d_nextValues.clear();
+  }
   Trace("model-builder") << "TheoryEngineModelBuilder: success" << std::endl;
   return true;
 }
 
+Node TheoryEngineModelBuilder::getPreviousValue(
+    TheoryModel* tm,
+    TNode eqc,
+    TypeNode t,
+    const std::set<Node>* usedValues,
+    std::vector<Node>& terms)
+{
+  Node ret;
+  eq::EqClassIterator eqcIt(eqc, tm->d_equalityEngine);
+  for (; !eqcIt.isFinished(); ++eqcIt)
+  {
+    Node n = *eqcIt;
+    if (!isAssignable(n))
+    {
+      continue;
+    }
+    terms.push_back(n);
+    if (!ret.isNull())
+    {
+      continue;
+    }
+    std::unordered_map<Node, Node>::const_iterator it = d_prevValues.find(n);
+    if (it == d_prevValues.end())
+    {
+      continue;
+    }
+    // We only reuse atomic values, since the values of parametric types
+    // constrain the values of their component types.
+    const Node& v = it->second;
+    if (v.getType() == t && v.getNumChildren() == 0
+        && (usedValues == nullptr || usedValues->find(v) == usedValues->end()))
+    {
+      ret = v;
+    }
+  }
+  return ret;
+}
+
 void TheoryEngineModelBuilder::postProcessModel(bool incomplete, TheoryModel* m)
 {
   // if we are incomplete, there is no guarantee on the model.
@@ -1303,21 +1503,82 @@ bool TheoryEngineModelBuilder::processBuildModel(TheoryModel* m)
 {
   if (m->areFunctionValuesEnabled())
   {
-    assignFunctions(m);
+    // In higher-order logics, function values are representatives of
+    // equivalence classes and must be assigned eagerly. We also assign them
+    // eagerly when checking models, which considers all functions anyways.
+    if (options().theory.lazyModelValues
+        && options().theory.assignFunctionValues
+        && !logicInfo().isHigherOrder() && !options().smt.checkModels)
+    {
+      Trace("model-builder") << "Defer assigning function values" << std::endl;
+      m->d_lazyBuilder = this;
+    }
+    else
+    {
+      assignFunctions(m);
+    }
   }
   return true;
 }
 
+bool TheoryEngineModelBuilder::hasDeferredValues(const TypeNode& tn) const
+{
+  return d_deferredEqc.find(tn) != d_deferredEqc.end();
+}
+
+void TheoryEngineModelBuilder::getDeferredTypes(
+    std::vector<TypeNode>& types) const
+{
+  for (const std::pair<const TypeNode, std::set<Node>>& d : d_deferredEqc)
+  {
+    types.push_back(d.first);
+  }
+}
+
+void TheoryEngineModelBuilder::assignDeferredValues(
+    const TypeNode& tn, std::map<Node, Node>& vals)
+{
+  std::map<TypeNode, std::set<Node>>::iterator it = d_deferredEqc.find(tn);
+  Assert(it != d_deferredEqc.end());
+  Trace("model-builder") << "Assign deferred values of type " << tn
+                         << std::endl;
+  // enumerate fresh values as done in buildModel
+  TypeSet typeConstSet;
+  for (const Node& v : d_deferredUsedValues[tn])
+  {
+    typeConstSet.add(tn, v);
+  }
+  for (const Node& eqc : it->second)
+  {
+    Node n = typeConstSet.nextTypeEnum(tn);
+    Assert(!n.isNull());
+    ++d_stats.d_eqcEnumerated;
+    Trace("model-builder") << "    Assign: Setting constant rep of " << eqc
+                           << " to " << n << std::endl;
+    vals[eqc] = n;
+  }
+  d_deferredEqc.erase(it);
+  d_deferredUsedValues.erase(tn);
+}
+
 void TheoryEngineModelBuilder::assignFunction(TheoryModel* m, Node f)
+{
+  m->assignFunctionDefinition(f, getFunctionValue(m, f));
+}
+
+Node TheoryEngineModelBuilder::getFunctionValue(const TheoryModel* m, Node f)
 {
   Assert(!logicInfo().isHigherOrder());
   uf::UfModelTree ufmt(f);
   options::DefaultFunctionValueMode dfvm =
       options().theory.defaultFunctionValueMode;
   Node default_v;
-  for (size_t i = 0; i < m->d_uf_terms[f].size(); i++)
+  std::map<Node, std::vector<Node>>::const_iterator itu = m->d_uf_terms.find(f);
+  const std::vector<Node> noTerms;
+  const std::vector<Node>& ufTerms =
+      itu != m->d_uf_terms.end() ? itu->second : noTerms;
+  for (const Node& un : ufTerms)
   {
-    Node un = m->d_uf_terms[f][i];
     vector<TNode> children;
     children.push_back(f);
     Trace("model-builder-debug") << "  process term : " << un << std::endl;
@@ -1365,8 +1626,7 @@ void TheoryEngineModelBuilder::assignFunction(TheoryModel* m, Node f)
   Rewriter* r = condenseFuncValues ? d_env.getRewriter() : nullptr;
   Node val = ufmt.getFunctionValue(ss.str(), r);
   Trace("model-builder-debug") << "...assign via function" << std::endl;
-  m->assignFunctionDefinition(f, val);
-  // ufmt.debugPrint( std::cout, m );
+  return val;
 }
 
 void TheoryEngineModelBuilder::assignHoFunction(TheoryModel* m, Node f)
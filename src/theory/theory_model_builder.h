@@ -23,6 +23,7 @@
 
 #include "smt/env_obj.h"
 #include "theory/theory_model.h"
+#include "util/statistics_stats.h"
 
 namespace cvc5::internal {
 
@@ -87,6 +88,29 @@ class TheoryEngineModelBuilder : protected EnvObj
    * build.
    */
   void postProcessModel(bool incomplete, TheoryModel* m);
+  //-----------------------------------values assigned on demand
+  /**
+   * Does the last model built by this class have equivalence classes of type
+   * tn whose values were deferred (see --lazy-model-values)?
+   */
+  bool hasDeferredValues(const TypeNode& tn) const;
+  /** Get the types of the equivalence classes whose values were deferred */
+  void getDeferredTypes(std::vector<TypeNode>& types) const;
+  /**
+   * Assign values to the equivalence classes of type tn whose values were
+   * deferred. These are the values the classes would have been assigned by
+   * buildModel otherwise.
+   * @param tn The type, for which hasDeferredValues(tn) holds.
+   * @param vals Updated to map each of these equivalence classes to its value.
+   */
+  void assignDeferredValues(const TypeNode& tn, std::map<Node, Node>& vals);
+  /**
+   * Get the value of function f in model m, as constructed by assignFunction.
+   * This is called by m if the values of functions are assigned lazily and
+   * the value of f is requested.
+   */
+  Node getFunctionValue(const TheoryModel* m, Node f);
+  //-----------------------------------end values assigned on demand
 
  protected:
 
@@ -222,6 +246,54 @@ class TheoryEngineModelBuilder : protected EnvObj
   /** mapping from terms to the constant associated with their equivalence class
    */
   std::map<Node, Node> d_constantReps;
+  /**
+   * Whether we reuse the values of the previous model for equivalence classes
+   * that are assigned values by enumeration, which is the case in incremental
+   * mode.
+   */
+  bool d_reuseValues;
+  /**
+   * The values of assignable terms in equivalence classes that were assigned
+   * values by enumeration in the last model that was successfully built.
+   */
+  std::unordered_map<Node, Node> d_prevValues;
+  /** The values of assignable terms for d_prevValues in the current build */
+  std::unordered_map<Node, Node> d_nextValues;
+  /**
+   * The equivalence classes of uninterpreted sorts whose values were deferred
+   * in the last model built by this class, per sort. We only defer the values
+   * of sorts whose values are not needed by the values of other equivalence
+   * classes, so that assigning them later yields the same model.
+   */
+  std::map<TypeNode, std::set<Node>> d_deferredEqc;
+  /** The values of each sort in d_deferredEqc that are used by the model */
+  std::map<TypeNode, std::set<Node>> d_deferredUsedValues;
+  /**
+   * Get the value of an assignable term of equivalence class eqc of type t in
+   * the previous model, if that value is atomic and not already used in the
+   * current model, i.e. not in the set of constants usedValues of type t.
+   * @param tm The model being built.
+   * @param eqc The equivalence class.
+   * @param t The type of eqc.
+   * @param usedValues The constants of type t used in tm, or nullptr.
+   * @param terms Updated to the assignable terms of eqc.
+   * @return The previous value, or null if none can be reused.
+   */
+  Node getPreviousValue(TheoryModel* tm,
+                        TNode eqc,
+                        TypeNode t,
+                        const std::set<Node>* usedValues,
+                        std::vector<Node>& terms);
+  /** Statistics about the model builder */
+  struct Statistics
+  {
+    Statistics(StatisticsRegistry& sr);
+    /** Number of equivalence classes assigned a value by enumeration */
+    IntStat d_eqcEnumerated;
+    /** Number of equivalence classes assigned their previous value */
+    IntStat d_eqcReused;
+  };
+  Statistics d_stats;
 
   /** Theory engine model builder assigner class
    *
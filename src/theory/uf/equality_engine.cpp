@@ -33,7 +33,9 @@ EqualityEngine::Statistics::Statistics(StatisticsRegistry& sr,
     : d_mergesCount(sr.registerInt(name + "mergesCount")),
       d_termsCount(sr.registerInt(name + "termsCount")),
       d_functionTermsCount(sr.registerInt(name + "functionTermsCount")),
-      d_constantTermsCount(sr.registerInt(name + "constantTermsCount"))
+      d_constantTermsCount(sr.registerInt(name + "constantTermsCount")),
+      d_explanationCacheHits(sr.registerInt(name + "explanationCacheHits")),
+      d_explanationLength(sr.registerAverage(name + "explanationLength"))
 {
 }
 
@@ -115,6 +117,8 @@ EqualityEngine::EqualityEngine(Env& env,
       d_subtermEvaluatesSize(c, 0),
       d_stats(statisticsRegistry(), name + "::"),
       d_inPropagate(false),
+      d_explanationCache(c),
+      d_explanationCacheReasonsSize(c, 0),
       d_constantsAreTriggers(constantsAreTriggers),
       d_anyTermsAreTriggers(anyTermTriggers),
       d_triggerDatabaseSize(c, 0),
@@ -147,6 +151,8 @@ EqualityEngine::EqualityEngine(Env& env,
       d_subtermEvaluatesSize(c, 0),
       d_stats(statisticsRegistry(), name + "::"),
       d_inPropagate(false),
+      d_explanationCache(c),
+      d_explanationCacheReasonsSize(c, 0),
       d_constantsAreTriggers(constantsAreTriggers),
       d_anyTermsAreTriggers(anyTermTriggers),
       d_triggerDatabaseSize(c, 0),
@@ -215,8 +221,8 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
   d_applications[funId] = FunctionApplicationPair(funOriginal, funNormalized);
 
   // Add the lookup data, if it's not already there
-  ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-  if (find == d_applicationLookup.end()) {
+  EqualityNodeId find = d_applicationLookup.find(funNormalized);
+  if (find == null_id) {
     Trace("equality") << d_name << "::eq::newApplicationNode(" << original
                       << ", " << t1 << ", " << t2
                       << "): no lookup, setting up funNorm: (" << type << " "
@@ -227,8 +233,8 @@ EqualityNodeId EqualityEngine::newApplicationNode(TNode original, EqualityNodeId
   } else {
     // If it's there, we need to merge these two
     Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup exists, adding to queue" << std::endl;
-    Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[find->second] << std::endl;
-    enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+    Trace("equality") << d_name << "::eq::newApplicationNode(" << original << ", " << t1 << ", " << t2 << "): lookup = " << d_nodes[find] << std::endl;
+    enqueue(MergeCandidate(funId, find, MERGED_THROUGH_CONGRUENCE, TNode::null()));
   }
 
   // Add to the use lists
@@ -262,14 +268,8 @@ EqualityNodeId EqualityEngine::newNode(TNode node) {
   d_equalityGraph.push_back(+null_edge);
   // Mark the no-individual trigger
   d_nodeIndividualTrigger.push_back(+null_set_id);
-  // Mark non-constant by default
-  d_isConstant.push_back(false);
   // No terms to evaluate by defaul
   d_subtermsToEvaluate.push_back(0);
-  // Mark equality nodes
-  d_isEquality.push_back(false);
-  // Mark the node as internal by default
-  d_isInternal.push_back(true);
   // Add the equality node to the nodes
   d_equalityNodes.push_back(EqualityNode(newId));
 
@@ -307,7 +307,7 @@ void EqualityEngine::addFunctionKind(Kind fun,
 
 void EqualityEngine::subtermEvaluates(EqualityNodeId id)  {
   Trace("equality::evaluation") << d_name << "::eq::subtermEvaluates(" << d_nodes[id] << "): " << d_subtermsToEvaluate[id] << std::endl;
-  Assert(!d_isInternal[id]);
+  Assert(!d_equalityNodes[id].isInternal());
   Assert(d_subtermsToEvaluate[id] > 0);
   if ((-- d_subtermsToEvaluate[id]) == 0) {
     d_evaluationQueue.push(id);
@@ -341,8 +341,8 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
     EqualityNodeId t0id = getNodeId(t[0]);
     EqualityNodeId t1id = getNodeId(t[1]);
     result = newApplicationNode(t, t0id, t1id, APP_EQUALITY);
-    d_isInternal[result] = false;
-    d_isConstant[result] = false;
+    d_equalityNodes[result].setInternal(false);
+    d_equalityNodes[result].setConstant(false);
   }
   else if (t.getNumChildren() > 0 && d_congruenceKinds[tk])
   {
@@ -359,8 +359,8 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
       // Add the application
       result = newApplicationNode(t, result, tiId, isInterpreted ? APP_INTERPRETED : APP_UNINTERPRETED);
     }
-    d_isInternal[result] = false;
-    d_isConstant[result] = t.isConst();
+    d_equalityNodes[result].setInternal(false);
+    d_equalityNodes[result].setConstant(t.isConst());
     // If interpreted, set the number of non-interpreted children
     if (isInterpreted) {
       // How many children are not constants yet
@@ -378,22 +378,22 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
     // Otherwise we just create the new id
     result = newNode(t);
     // Is this an operator
-    d_isInternal[result] = isOperator;
-    d_isConstant[result] = !isOperator && t.isConst();
+    d_equalityNodes[result].setInternal(isOperator);
+    d_equalityNodes[result].setConstant(!isOperator && t.isConst());
   }
 
   if (tk == Kind::EQUAL)
   {
     // We set this here as this only applies to actual terms, not the
     // intermediate application terms
-    d_isEquality[result] = true;
+    d_equalityNodes[result].setEquality(true);
   }
   else
   {
     // Notify e.g. the theory that owns this equality engine that there is a
     // new equivalence class.
     d_notify->eqNotifyNewClass(t);
-    if (d_constantsAreTriggers && d_isConstant[result])
+    if (d_constantsAreTriggers && d_equalityNodes[result].isConstant())
     {
       // Non-Boolean constants are trigger terms for all tags
       EqualityNodeId tId = getNodeId(t);
@@ -417,7 +417,7 @@ void EqualityEngine::addTermInternal(TNode t, bool isOperator) {
   }
 
   // If this is not an internal node, add it to the master
-  if (d_masterEqualityEngine && !d_isInternal[result]) {
+  if (d_masterEqualityEngine && !d_equalityNodes[result].isInternal()) {
     d_masterEqualityEngine->addTermInternal(t);
   }
 
@@ -530,7 +530,7 @@ bool EqualityEngine::assertEquality(TNode eq,
     EqualityNodeId b = getNodeId(eq[1]);
     EqualityNodeId aClassId = getEqualityNode(a).getFind();
     EqualityNodeId bClassId = getEqualityNode(b).getFind();
-    if (d_isConstant[aClassId] && d_isConstant[bClassId]) {
+    if (d_equalityNodes[aClassId].isConstant() && d_equalityNodes[bClassId].isConstant()) {
       return true;
     }
 
@@ -592,7 +592,7 @@ TNode EqualityEngine::getRepresentative(TNode t) const {
   Trace("equality::internal") << d_name << "::eq::getRepresentative(" << t << ")" << std::endl;
   Assert(hasTerm(t));
   EqualityNodeId representativeId = getEqualityNode(t).getFind();
-  Assert(!d_isInternal[representativeId]);
+  Assert(!d_equalityNodes[representativeId].isInternal());
   Trace("equality::internal") << d_name << "::eq::getRepresentative(" << t << ") => " << d_nodes[representativeId] << std::endl;
   return d_nodes[representativeId];
 }
@@ -622,8 +622,8 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
   }
 
   // Check for constant merges
-  bool class1isConstant = d_isConstant[class1Id];
-  bool class2isConstant = d_isConstant[class2Id];
+  bool class1isConstant = d_equalityNodes[class1Id].isConstant();
+  bool class2isConstant = d_equalityNodes[class2Id].isConstant();
   Assert(class1isConstant || !class2isConstant)
       << "Should always merge into constants";
   Assert(!class1isConstant || !class2isConstant) << "Don't merge constants";
@@ -696,7 +696,7 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
 
   // Update class2 table lookup and information if not a boolean
   // since booleans can't be in an application
-  if (!d_isEquality[class2Id]) {
+  if (!d_equalityNodes[class2Id].isEquality()) {
     Trace("equality") << d_name << "::eq::merge(" << class1.getFind() << "," << class2.getFind() << "): updating lookups of " << class2Id << std::endl;
     do {
       // Get the current node
@@ -714,7 +714,7 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
         const FunctionApplication& fun =
             d_applications[useNode.getApplicationId()].d_normalized;
         // If it's interpreted and we can interpret
-        if (fun.isInterpreted() && class1isConstant && !d_isInternal[currentId])
+        if (fun.isInterpreted() && class1isConstant && !d_equalityNodes[currentId].isInternal())
         {
           // Get the actual term id
           TNode term = d_nodes[funId];
@@ -724,11 +724,11 @@ bool EqualityEngine::merge(EqualityNode& class1, EqualityNode& class2, std::vect
         EqualityNodeId aNormalized = getEqualityNode(fun.d_a).getFind();
         EqualityNodeId bNormalized = getEqualityNode(fun.d_b).getFind();
         FunctionApplication funNormalized(fun.d_type, aNormalized, bNormalized);
-        ApplicationIdsMap::iterator find = d_applicationLookup.find(funNormalized);
-        if (find != d_applicationLookup.end()) {
+        EqualityNodeId find = d_applicationLookup.find(funNormalized);
+        if (find != null_id) {
           // Applications fun and the funNormalized can be merged due to congruence
-          if (getEqualityNode(funId).getFind() != getEqualityNode(find->second).getFind()) {
-            enqueue(MergeCandidate(funId, find->second, MERGED_THROUGH_CONGRUENCE, TNode::null()));
+          if (getEqualityNode(funId).getFind() != getEqualityNode(find).getFind()) {
+            enqueue(MergeCandidate(funId, find, MERGED_THROUGH_CONGRUENCE, TNode::null()));
           }
         } else {
           // There is no representative, so we can add one, we remove this when backtracking
@@ -924,11 +924,8 @@ void EqualityEngine::backtrack() {
     d_equalityTriggersOriginal.resize(d_equalityTriggersCount);
   }
 
-  if (d_applicationLookups.size() > d_applicationLookupsCount) {
-    for (int i = d_applicationLookups.size() - 1, i_end = (int) d_applicationLookupsCount; i >= i_end; -- i) {
-      d_applicationLookup.erase(d_applicationLookups[i]);
-    }
-    d_applicationLookups.resize(d_applicationLookupsCount);
+  if (d_applicationLookup.size() > d_applicationLookupsCount) {
+    d_applicationLookup.resize(d_applicationLookupsCount);
   }
 
   if (d_subtermEvaluates.size() > d_subtermEvaluatesSize) {
@@ -959,10 +956,7 @@ void EqualityEngine::backtrack() {
     d_applications.resize(d_nodesCount);
     d_nodeTriggers.resize(d_nodesCount);
     d_nodeIndividualTrigger.resize(d_nodesCount);
-    d_isConstant.resize(d_nodesCount);
     d_subtermsToEvaluate.resize(d_nodesCount);
-    d_isEquality.resize(d_nodesCount);
-    d_isInternal.resize(d_nodesCount);
     d_equalityGraph.resize(d_nodesCount);
     d_equalityNodes.resize(d_nodesCount);
   }
@@ -981,6 +975,11 @@ void EqualityEngine::backtrack() {
     d_deducedDisequalities.resize(d_deducedDisequalitiesSize);
   }
 
+  if (d_explanationCacheReasons.size() > d_explanationCacheReasonsSize)
+  {
+    d_explanationCacheReasons.resize(d_explanationCacheReasonsSize);
+  }
+
 }
 
 void EqualityEngine::addGraphEdge(EqualityNodeId t1, EqualityNodeId t2, unsigned type, TNode reason) {
@@ -1025,7 +1024,7 @@ void EqualityEngine::buildEqConclusion(EqualityNodeId id1,
   // only try to build build if full applications corresponding to the given ids
   // have the same congruence n-ary non-APPLY_* kind, since the internal nodes
   // may be full nodes.
-  if ((d_isInternal[id1] || d_isInternal[id2])
+  if ((d_equalityNodes[id1].isInternal() || d_equalityNodes[id2].isInternal())
       && (k1 != k2 || k1 == Kind::APPLY_UF || k1 == Kind::APPLY_CONSTRUCTOR
           || k1 == Kind::APPLY_SELECTOR || k1 == Kind::APPLY_TESTER
           || !NodeManager::isNAryKind(k1)))
@@ -1043,7 +1042,7 @@ void EqualityEngine::buildEqConclusion(EqualityNodeId id1,
     EqualityNodeId equalityNodeId = i == 0 ? id1 : id2;
     Node equalityNode = d_nodes[equalityNodeId];
     // if not an internal node, just retrieve it
-    if (!d_isInternal[equalityNodeId])
+    if (!d_equalityNodes[equalityNodeId].isInternal())
     {
       eq[i] = equalityNode;
       continue;
@@ -1119,7 +1118,14 @@ void EqualityEngine::explainEquality(TNode t1, TNode t2, bool polarity,
   std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*> cache;
   if (polarity) {
     // Get the explanation
-    getExplanation(t1Id, t2Id, equalities, cache, eqp);
+    if (eqp)
+    {
+      getExplanation(t1Id, t2Id, equalities, cache, eqp);
+    }
+    else
+    {
+      getExplanationCached(t1Id, t2Id, equalities);
+    }
   } else {
     if (eqp) {
       eqp->d_id = MERGED_THROUGH_TRANS;
@@ -1273,8 +1279,16 @@ void EqualityEngine::explainPredicate(TNode p, bool polarity,
     debugPrintGraph();
   }
   // Get the explanation
-  getExplanation(
-      getNodeId(p), polarity ? d_trueId : d_falseId, assertions, cache, eqp);
+  EqualityNodeId pId = getNodeId(p);
+  EqualityNodeId polId = polarity ? d_trueId : d_falseId;
+  if (eqp)
+  {
+    getExplanation(pId, polId, assertions, cache, eqp);
+  }
+  else
+  {
+    getExplanationCached(pId, polId, assertions);
+  }
 }
 
 void EqualityEngine::explainLit(TNode lit,
@@ -1338,6 +1352,38 @@ Node EqualityEngine::mkExplainLit(TNode lit) const
   return ret;
 }
 
+void EqualityEngine::getExplanationCached(
+    EqualityNodeId t1Id,
+    EqualityNodeId t2Id,
+    std::vector<TNode>& equalities) const
+{
+  if (t1Id == t2Id)
+  {
+    return;
+  }
+  EqualityPair key = std::minmax(t1Id, t2Id);
+  ExplanationCache::const_iterator it = d_explanationCache.find(key);
+  if (it != d_explanationCache.end())
+  {
+    ++d_stats.d_explanationCacheHits;
+    equalities.insert(equalities.end(),
+                      d_explanationCacheReasons.begin() + it->second.first,
+                      d_explanationCacheReasons.begin() + it->second.second);
+    return;
+  }
+  size_t start = equalities.size();
+  std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*> cache;
+  getExplanation(t1Id, t2Id, equalities, cache, nullptr);
+  d_stats.d_explanationLength << (equalities.size() - start);
+  // Remember the explanation
+  std::vector<TNode>& reasons = d_explanationCacheReasons;
+  DefaultSizeType begin = reasons.size();
+  reasons.insert(reasons.end(), equalities.begin() + start, equalities.end());
+  d_explanationCacheReasonsSize = reasons.size();
+  d_explanationCache.insert(
+      key, std::pair<DefaultSizeType, DefaultSizeType>(begin, reasons.size()));
+}
+
 void EqualityEngine::getExplanation(
     EqualityNodeId t1Id,
     EqualityNodeId t2Id,
@@ -1416,8 +1462,8 @@ void EqualityEngine::getExplanation(
       //
       // Note that this is robust for HOL because in that case function
       // symbols are not internal nodes
-      if (d_isInternal[t1Id] && d_nodes[t1Id].getNumChildren() == 0
-          && !d_isConstant[t1Id])
+      if (d_equalityNodes[t1Id].isInternal() && d_nodes[t1Id].getNumChildren() == 0
+          && !d_equalityNodes[t1Id].isConstant())
       {
         eqp->d_node = Node::null();
       }
@@ -1932,8 +1978,8 @@ void EqualityEngine::propagate() {
       continue;
     }
 
-    Trace("equality::internal") << d_name << "::eq::propagate(): t1: " << (d_isInternal[t1classId] ? "internal" : "proper") << std::endl;
-    Trace("equality::internal") << d_name << "::eq::propagate(): t2: " << (d_isInternal[t2classId] ? "internal" : "proper") << std::endl;
+    Trace("equality::internal") << d_name << "::eq::propagate(): t1: " << (d_equalityNodes[t1classId].isInternal() ? "internal" : "proper") << std::endl;
+    Trace("equality::internal") << d_name << "::eq::propagate(): t2: " << (d_equalityNodes[t2classId].isInternal() ? "internal" : "proper") << std::endl;
 
     // Get the nodes of the representatives
     EqualityNode& node1 = getEqualityNode(t1classId);
@@ -1947,7 +1993,7 @@ void EqualityEngine::propagate() {
         current.d_t1Id, current.d_t2Id, current.d_type, current.d_reason);
 
     // If constants are being merged we're done
-    if (d_isConstant[t1classId] && d_isConstant[t2classId]) {
+    if (d_equalityNodes[t1classId].isConstant() && d_equalityNodes[t2classId].isConstant()) {
       // When merging constants we are inconsistent, hence done
       d_done = true;
       // But in order to keep invariants (edges = 2*equalities) we put an equalities in
@@ -1966,18 +2012,18 @@ void EqualityEngine::propagate() {
 
     // Figure out the merge preference
     EqualityNodeId mergeInto = t1classId;
-    if (d_isInternal[t2classId] != d_isInternal[t1classId]) {
+    if (d_equalityNodes[t2classId].isInternal() != d_equalityNodes[t1classId].isInternal()) {
       // We always keep non-internal nodes as representatives: if any node in
       // the class is non-internal, then the representative will be non-internal
-      if (d_isInternal[t1classId]) {
+      if (d_equalityNodes[t1classId].isInternal()) {
         mergeInto = t2classId;
       } else {
         mergeInto = t1classId;
       }
-    } else if (d_isConstant[t2classId] != d_isConstant[t1classId]) {
+    } else if (d_equalityNodes[t2classId].isConstant() != d_equalityNodes[t1classId].isConstant()) {
       // We always keep constants as representatives: if any (at most one) node
       // in the class in a constant, then the representative will be a constant
-      if (d_isConstant[t2classId]) {
+      if (d_equalityNodes[t2classId].isConstant()) {
         mergeInto = t2classId;
       } else {
         mergeInto = t1classId;
@@ -2009,7 +2055,7 @@ void EqualityEngine::propagate() {
     }
 
     // If not merging internal nodes, notify the master
-    if (d_masterEqualityEngine && !d_isInternal[t1classId] && !d_isInternal[t2classId]) {
+    if (d_masterEqualityEngine && !d_equalityNodes[t1classId].isInternal() && !d_equalityNodes[t2classId].isInternal()) {
       d_masterEqualityEngine->assertEqualityInternal(d_nodes[t1classId], d_nodes[t2classId], TNode::null());
       d_masterEqualityEngine->propagate();
     }
@@ -2152,7 +2198,7 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
   EqualityEngine* nonConst = const_cast<EqualityEngine*>(this);
 
   // Check for constants
-  if (d_isConstant[t1ClassId] && d_isConstant[t2ClassId] && t1ClassId != t2ClassId) {
+  if (d_equalityNodes[t1ClassId].isConstant() && d_equalityNodes[t2ClassId].isConstant() && t1ClassId != t2ClassId) {
     if (ensureProof) {
       nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t1Id, t1ClassId));
       nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(t2Id, t2ClassId));
@@ -2164,15 +2210,15 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
 
   // Create the equality
   FunctionApplication eqNormalized(APP_EQUALITY, t1ClassId, t2ClassId);
-  ApplicationIdsMap::const_iterator find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  EqualityNodeId find = d_applicationLookup.find(eqNormalized);
+  if (find != null_id) {
+    if (getEqualityNode(find).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
         const FunctionApplication original =
-            d_applications[find->second].d_original;
+            d_applications[find].d_original;
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t1Id, original.d_a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t2Id, original.d_b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
@@ -2185,14 +2231,14 @@ bool EqualityEngine::areDisequal(TNode t1, TNode t2, bool ensureProof) const
   // Check the symmetric disequality
   std::swap(eqNormalized.d_a, eqNormalized.d_b);
   find = d_applicationLookup.find(eqNormalized);
-  if (find != d_applicationLookup.end()) {
-    if (getEqualityNode(find->second).getFind() == getEqualityNode(d_falseId).getFind()) {
+  if (find != null_id) {
+    if (getEqualityNode(find).getFind() == getEqualityNode(d_falseId).getFind()) {
       if (ensureProof) {
         const FunctionApplication original =
-            d_applications[find->second].d_original;
+            d_applications[find].d_original;
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t2Id, original.d_a));
-        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find->second, d_falseId));
+        nonConst->d_deducedDisequalityReasons.push_back(EqualityPair(find, d_falseId));
         nonConst->d_deducedDisequalityReasons.push_back(
             EqualityPair(t1Id, original.d_b));
         nonConst->storePropagatedDisequality(THEORY_LAST, t1Id, t2Id);
@@ -2260,7 +2306,7 @@ void EqualityEngine::addTriggerTerm(TNode t, TheoryId tag)
     // side of such disequalities, that have the tag on, are put in a set.
     TaggedEqualitiesSet disequalitiesToNotify;
     TheoryIdSet tags = TheoryIdSetUtil::setInsert(tag);
-    getDisequalities(!d_isConstant[classId], classId, tags, disequalitiesToNotify);
+    getDisequalities(!d_equalityNodes[classId].isConstant(), classId, tags, disequalitiesToNotify);
 
     // Trigger data
     TheoryIdSet newSetTags;
@@ -2327,13 +2373,11 @@ TNode EqualityEngine::getTriggerTermRepresentative(TNode t, TheoryId tag) const
 }
 
 void EqualityEngine::storeApplicationLookup(FunctionApplication& funNormalized, EqualityNodeId funId) {
-  Assert(d_applicationLookup.find(funNormalized) == d_applicationLookup.end());
-  d_applicationLookup[funNormalized] = funId;
-  d_applicationLookups.push_back(funNormalized);
+  d_applicationLookup.insert(funNormalized, funId);
   d_applicationLookupsCount = d_applicationLookupsCount + 1;
   Trace("equality::backtrack") << "d_applicationLookupsCount = " << d_applicationLookupsCount << std::endl;
-  Trace("equality::backtrack") << "d_applicationLookups.size() = " << d_applicationLookups.size() << std::endl;
-  Assert(d_applicationLookupsCount == d_applicationLookups.size());
+  Trace("equality::backtrack") << "d_applicationLookup.size() = " << d_applicationLookup.size() << std::endl;
+  Assert(d_applicationLookupsCount == d_applicationLookup.size());
 
   // If an equality over constants we merge to false
   if (funNormalized.isEquality()) {
@@ -2341,7 +2385,7 @@ void EqualityEngine::storeApplicationLookup(FunctionApplication& funNormalized,
     {
       enqueue(MergeCandidate(funId, d_trueId, MERGED_THROUGH_REFLEXIVITY, TNode::null()));
     }
-    else if (d_isConstant[funNormalized.d_a] && d_isConstant[funNormalized.d_b])
+    else if (d_equalityNodes[funNormalized.d_a].isConstant() && d_equalityNodes[funNormalized.d_b].isConstant())
     {
       enqueue(MergeCandidate(funId, d_falseId, MERGED_THROUGH_CONSTANTS, TNode::null()));
     }
@@ -2527,7 +2571,7 @@ void EqualityEngine::getDisequalities(bool allowConstants,
           // Get the trigger set
           TriggerTermSetRef toCompareTriggerSetRef = d_nodeIndividualTrigger[toCompareRep];
           // We only care if we're not both constants and there are trigger terms in the other class
-          if ((allowConstants || !d_isConstant[toCompareRep]) && toCompareTriggerSetRef != null_set_id) {
+          if ((allowConstants || !d_equalityNodes[toCompareRep].isConstant()) && toCompareTriggerSetRef != null_set_id) {
             // Tags of the other gey
             TriggerTermSet& toCompareTriggerSet = getTriggerTermSet(toCompareTriggerSetRef);
             // We only care if there are things in inputTags that is also in toCompareTags
@@ -135,7 +135,7 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
   /**
    * Add a kind to treat as function applications.
    * When extOperator is true, this equality engine will treat the operators of
-   * this kind as "external" e.g. not internal nodes (see d_isInternal). This
+   * this kind as "external" e.g. not internal nodes (see EqualityNode::isInternal). This
    * means that we will consider equivalence classes containing the operators of
    * such terms, and "hasTerm" will return true.
    */
@@ -283,6 +283,10 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
     IntStat d_functionTermsCount;
     /** Number of constant terms managed by the system */
     IntStat d_constantTermsCount;
+    /** Number of explanations taken from the explanation cache */
+    mutable IntStat d_explanationCacheHits;
+    /** Number of reasons of computed explanations */
+    mutable AverageStat d_explanationLength;
 
     Statistics(StatisticsRegistry& sr, const std::string& name);
   };
@@ -308,17 +312,11 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
   /** Map from nodes to their ids */
   std::unordered_map<TNode, EqualityNodeId> d_nodeIds;
 
-  /** Map from function applications to their ids */
-  typedef std::unordered_map<FunctionApplication, EqualityNodeId, FunctionApplicationHashFunction> ApplicationIdsMap;
-
   /**
    * A map from a pair (a', b') to a function application f(a, b), where a' and b' are the current representatives
-   * of a and b.
+   * of a and b. Lookups are kept in order, so that we can backtrack.
    */
-  ApplicationIdsMap d_applicationLookup;
-
-  /** Application lookups in order, so that we can backtrack. */
-  std::vector<FunctionApplication> d_applicationLookups;
+  ApplicationLookupTable d_applicationLookup;
 
   /** Number of application lookups, for backtracking.  */
   context::CDO<DefaultSizeType> d_applicationLookupsCount;
@@ -507,12 +505,6 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
    */
   std::vector<TriggerId> d_nodeTriggers;
 
-  /**
-   * Map from ids to whether they are constants (constants are always
-   * representatives of their class.
-   */
-  std::vector<bool> d_isConstant;
-
   /**
    * Map from ids of proper terms, to the number of non-constant direct subterms. If we update an interpreted
    * application to a constant, we can decrease this value. If we hit 0, we can evaluate the term.
@@ -549,20 +541,9 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
    * Returns true if it's a constant
    */
   bool isConstant(EqualityNodeId id) const {
-    return d_isConstant[getEqualityNode(id).getFind()];
+    return getEqualityNode(getEqualityNode(id).getFind()).isConstant();
   }
 
-  /**
-   * Map from ids to whether they are Boolean.
-   */
-  std::vector<bool> d_isEquality;
-
-  /**
-   * Map from ids to whether the nods is internal. An internal node is a node
-   * that corresponds to a partially currified node, for example.
-   */
-  std::vector<bool> d_isInternal;
-
   /**
    * Adds the trigger with triggerId to the beginning of the trigger list of the node with id nodeId.
    */
@@ -626,6 +607,32 @@ class EqualityEngine : public context::ContextNotifyObj, protected EnvObj
       std::map<std::pair<EqualityNodeId, EqualityNodeId>, EqProof*>& cache,
       EqProof* eqp) const;
 
+  /**
+   * Same as above without proofs, where the explanation of t1 = t2 is taken
+   * from d_explanationCache if possible, and added to it otherwise.
+   */
+  void getExplanationCached(EqualityNodeId t1Id,
+                            EqualityNodeId t2Id,
+                            std::vector<TNode>& equalities) const;
+
+  /**
+   * Map from (ordered) pairs of equal terms to the range of their explanation
+   * in d_explanationCacheReasons. An explanation only uses edges of the
+   * equality graph that exist in the context it was computed in, hence it
+   * remains valid until that context is popped.
+   */
+  typedef context::CDHashMap<EqualityPair,
+                             std::pair<DefaultSizeType, DefaultSizeType>,
+                             EqualityPairHashFunction>
+      ExplanationCache;
+  mutable ExplanationCache d_explanationCache;
+
+  /** The reasons of the explanations in d_explanationCache. */
+  mutable std::vector<TNode> d_explanationCacheReasons;
+
+  /** Context dependent size of the explanation cache reasons. */
+  mutable context::CDO<DefaultSizeType> d_explanationCacheReasonsSize;
+
   /**
    * Print the equality graph.
    */
@@ -24,7 +24,9 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
+#include "base/check.h"
 #include "util/hash.h"
 
 namespace cvc5::internal {
@@ -190,18 +192,57 @@ private:
   /** The use list of this node */
   UseListNodeId d_useList;
 
+  /** Bits of the node flags */
+  enum Flag : uint8_t
+  {
+    FLAG_CONSTANT = 1,
+    FLAG_EQUALITY = 2,
+    FLAG_INTERNAL = 4
+  };
+
+  /**
+   * The flags of this node. These are set when the node is added and never
+   * change afterwards. They are kept here rather than in separate vectors, as
+   * they are mostly accessed together with the find and size of the node.
+   */
+  uint8_t d_flags;
+
+  /** Set or clear the given flag */
+  void setFlag(Flag flag, bool value)
+  {
+    d_flags = value ? (d_flags | flag) : (d_flags & ~flag);
+  }
+
 public:
 
   /**
-   * Creates a new node, which is in a list of it's own.
+   * Creates a new node, which is in a list of it's own. Nodes are internal by
+   * default.
    */
   EqualityNode(EqualityNodeId nodeId = null_id)
   : d_size(1)
   , d_findId(nodeId)
   , d_nextId(nodeId)
   , d_useList(null_uselist_id)
+  , d_flags(FLAG_INTERNAL)
   {}
 
+  /** Returns true if this node is a constant. */
+  bool isConstant() const { return d_flags & FLAG_CONSTANT; }
+  /** Returns true if this node is an equality. */
+  bool isEquality() const { return d_flags & FLAG_EQUALITY; }
+  /**
+   * Returns true if this node is internal, i.e. it corresponds to a partially
+   * currified node or an operator.
+   */
+  bool isInternal() const { return d_flags & FLAG_INTERNAL; }
+  /** Set whether this node is a constant. */
+  void setConstant(bool value) { setFlag(FLAG_CONSTANT, value); }
+  /** Set whether this node is an equality. */
+  void setEquality(bool value) { setFlag(FLAG_EQUALITY, value); }
+  /** Set whether this node is internal. */
+  void setInternal(bool value) { setFlag(FLAG_INTERNAL, value); }
+
   /**
    * Returns the requested uselist.
    */
@@ -327,6 +368,138 @@ struct FunctionApplicationHashFunction {
   }
 };
 
+/**
+ * Map from normalized function applications to their ids, for congruence
+ * closure. The map is an open-addressing hash table with linear probing,
+ * whose entries are stored inline in a single array.
+ *
+ * Entries can only be removed in the reverse order of their insertion (via
+ * resize()), as done on backtracking. Since any entry inserted after an entry e
+ * is removed before e, the probe sequence of no remaining entry passes over
+ * the slot of e when it is removed, hence removal just clears the slot and no
+ * tombstones are needed. To keep this invariant, the table is rebuilt in
+ * insertion order when it grows.
+ */
+class ApplicationLookupTable
+{
+ public:
+  ApplicationLookupTable() : d_mask(s_initialCapacity - 1)
+  {
+    d_slots.resize(s_initialCapacity);
+  }
+
+  /** Returns the id of app, or null_id if app is not in the table. */
+  EqualityNodeId find(const FunctionApplication& app) const
+  {
+    for (size_t i = getSlot(app);; i = (i + 1) & d_mask)
+    {
+      const Slot& slot = d_slots[i];
+      if (slot.d_app.isNull())
+      {
+        return null_id;
+      }
+      if (slot.d_app == app)
+      {
+        return slot.d_id;
+      }
+    }
+  }
+
+  /** Add app with the given id. Requires that app is not in the table. */
+  void insert(const FunctionApplication& app, EqualityNodeId id)
+  {
+    Assert(!app.isNull());
+    Assert(find(app) == null_id);
+    // keep the load factor below one half
+    if (2 * (d_log.size() + 1) > d_slots.size())
+    {
+      grow();
+    }
+    insertSlot(app, id);
+    d_log.push_back(app);
+  }
+
+  /** Remove the most recently added entries until size() is newSize. */
+  void resize(size_t newSize)
+  {
+    while (d_log.size() > newSize)
+    {
+      size_t i = getSlot(d_log.back());
+      while (!(d_slots[i].d_app == d_log.back()))
+      {
+        i = (i + 1) & d_mask;
+      }
+      d_slots[i] = Slot();
+      d_log.pop_back();
+    }
+  }
+
+  /** The number of entries in the table. */
+  size_t size() const { return d_log.size(); }
+
+ private:
+  /** An entry of the table, empty if the application is null. */
+  struct Slot
+  {
+    Slot() : d_id(null_id) {}
+    FunctionApplication d_app;
+    EqualityNodeId d_id;
+  };
+
+  /** Returns the first slot of the probe sequence of app. */
+  size_t getSlot(const FunctionApplication& app) const
+  {
+    // Fibonacci hashing, to spread the low entropy of consecutive ids
+    uint64_t hash = FunctionApplicationHashFunction()(app);
+    return ((hash * UINT64_C(0x9e3779b97f4a7c15)) >> 32) & d_mask;
+  }
+
+  /** Put app into the first free slot of its probe sequence. */
+  void insertSlot(const FunctionApplication& app, EqualityNodeId id)
+  {
+    size_t i = getSlot(app);
+    while (!d_slots[i].d_app.isNull())
+    {
+      i = (i + 1) & d_mask;
+    }
+    d_slots[i].d_app = app;
+    d_slots[i].d_id = id;
+  }
+
+  /** Double the capacity, re-inserting the entries in insertion order. */
+  void grow()
+  {
+    std::vector<Slot> old;
+    old.swap(d_slots);
+    std::vector<EqualityNodeId> ids;
+    ids.reserve(d_log.size());
+    for (const FunctionApplication& app : d_log)
+    {
+      size_t i = getSlot(app);
+      while (!(old[i].d_app == app))
+      {
+        i = (i + 1) & d_mask;
+      }
+      ids.push_back(old[i].d_id);
+    }
+    d_slots.resize(2 * old.size());
+    d_mask = d_slots.size() - 1;
+    for (size_t i = 0, size = d_log.size(); i < size; ++i)
+    {
+      insertSlot(d_log[i], ids[i]);
+    }
+  }
+
+  /** The initial capacity, must be a power of two */
+  static const size_t s_initialCapacity = 16;
+  /** The slots, whose number is a power of two */
+  std::vector<Slot> d_slots;
+  /** The number of slots minus one */
+  size_t d_mask;
+  /** The applications in the table, in insertion order */
+  std::vector<FunctionApplication> d_log;
+};
+
 /**
  * At time of addition a function application can already normalize to something, so
  * we keep both the original, and the normalized version.
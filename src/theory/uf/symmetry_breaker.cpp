@@ -42,6 +42,7 @@
 #include <iterator>
 #include <queue>
 
+#include "options/uf_options.h"
 #include "theory/rewriter.h"
 #include "util/hash.h"
 #include "util/statistics_registry.h"
@@ -609,9 +610,232 @@ void SymmetryBreaker::apply(std::vector<Node>& newClauses) {
   clear();
 }
 
+/**
+ * Returns true if the order of the children of nodes of kind k does not
+ * matter.
+ */
+static bool isCommutativeKind(Kind k)
+{
+  switch (k)
+  {
+    case Kind::AND:
+    case Kind::OR:
+    case Kind::XOR:
+    case Kind::EQUAL:
+    case Kind::DISTINCT:
+    case Kind::ADD:
+    case Kind::MULT:
+    case Kind::NONLINEAR_MULT: return true;
+    default: return false;
+  }
+}
+
 void SymmetryBreaker::guessPermutations() {
   // use d_phi, put into d_permutations
   Trace("ufsymm") << "UFSYMM guessPermutations()" << endl;
+  if (!options().uf.ufSymmetryBreakerRefine || d_phi.empty())
+  {
+    return;
+  }
+  TimerStat::CodeTimer codeTimer(d_stats.d_guessPermutationsTimer);
+
+  // Colors the nodes of the assertion DAG such that any permutation of
+  // variables that leaves the assertions invariant maps variables to
+  // variables of the same color, by refining an initial coloring until it is
+  // equitable (as done in the first phase of graph automorphism tools). The
+  // variables of each color are a candidate permutation set, which is checked
+  // by invariantByPermutations().
+  vector<TNode> nodes;
+  unordered_map<TNode, size_t> ids;
+  vector<TNode> visit(d_phi.begin(), d_phi.end());
+  while (!visit.empty())
+  {
+    TNode cur = visit.back();
+    if (ids.find(cur) != ids.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    bool childrenDone = true;
+    for (TNode cn : cur)
+    {
+      if (ids.find(cn) == ids.end())
+      {
+        visit.push_back(cn);
+        childrenDone = false;
+      }
+    }
+    if (childrenDone)
+    {
+      visit.pop_back();
+      ids[cur] = nodes.size();
+      nodes.push_back(cur);
+    }
+  }
+  size_t nnodes = nodes.size();
+  // the parents of each node, with the position of the node in the parent
+  vector<vector<pair<size_t, size_t>>> parents(nnodes);
+  for (size_t i = 0; i < nnodes; i++)
+  {
+    bool comm = isCommutativeKind(nodes[i].getKind());
+    for (size_t j = 0, nchild = nodes[i].getNumChildren(); j < nchild; j++)
+    {
+      parents[ids[nodes[i][j]]].emplace_back(i, comm ? 0 : j + 1);
+    }
+  }
+  // the initial coloring distinguishes kinds, operators and constants, and
+  // only puts variables of the same type together
+  set<TNode> roots(d_phi.begin(), d_phi.end());
+  map<vector<uint64_t>, size_t> colorIds;
+  vector<size_t> color(nnodes);
+  for (size_t i = 0; i < nnodes; i++)
+  {
+    TNode n = nodes[i];
+    vector<uint64_t> sig;
+    if (n.isVar())
+    {
+      sig = {0, n.getType().getId()};
+    }
+    else if (n.getNumChildren() == 0)
+    {
+      sig = {1, n.getId()};
+    }
+    else
+    {
+      uint64_t op = n.getMetaKind() == kind::metakind::PARAMETERIZED
+                        ? n.getOperator().getId()
+                        : 0;
+      sig = {2,
+             static_cast<uint64_t>(n.getKind()),
+             op,
+             roots.find(n) != roots.end()};
+    }
+    color[i] = colorIds.emplace(sig, colorIds.size()).first->second;
+  }
+  size_t ncolors = colorIds.size();
+  // Refine the coloring with a worklist of splitter colors, as done by saucy
+  // and bliss. The nodes adjacent to the nodes of a splitter color are split
+  // by the number of their edges of each label to that color, where a node
+  // with a child at position j (or any child, for commutative kinds) has an
+  // edge labeled (0, j) to it, and the child has an edge labeled (1, j) to
+  // its parent. Only the colors of these nodes can be split. All initial
+  // colors are splitters, and of a split color, all parts but a largest one
+  // become splitters.
+  vector<vector<size_t>> cells(ncolors);
+  for (size_t i = 0; i < nnodes; i++)
+  {
+    cells[color[i]].push_back(i);
+  }
+  vector<size_t> worklist;
+  for (size_t c = 0; c < ncolors; c++)
+  {
+    worklist.push_back(c);
+  }
+  // the edge labels of each node adjacent to the current splitter
+  unordered_map<size_t, vector<uint64_t>> labels;
+  while (!worklist.empty())
+  {
+    size_t splitter = worklist.back();
+    worklist.pop_back();
+    labels.clear();
+    for (size_t i : cells[splitter])
+    {
+      for (const pair<size_t, size_t>& p : parents[i])
+      {
+        labels[p.first].push_back(2 * p.second);
+      }
+      bool comm = isCommutativeKind(nodes[i].getKind());
+      for (size_t j = 0, nchild = nodes[i].getNumChildren(); j < nchild; j++)
+      {
+        labels[ids[nodes[i][j]]].push_back(2 * (comm ? 0 : j + 1) + 1);
+      }
+    }
+    // the colors with nodes adjacent to the splitter
+    map<size_t, vector<pair<vector<uint64_t>, size_t>>> touched;
+    for (pair<const size_t, vector<uint64_t>>& l : labels)
+    {
+      std::sort(l.second.begin(), l.second.end());
+      touched[color[l.first]].emplace_back(std::move(l.second), l.first);
+    }
+    for (pair<const size_t, vector<pair<vector<uint64_t>, size_t>>>& t :
+         touched)
+    {
+      size_t c = t.first;
+      vector<pair<vector<uint64_t>, size_t>>& adj = t.second;
+      // nodes of c that are not adjacent to the splitter have no edges to it
+      size_t nonadj = cells[c].size() - adj.size();
+      std::sort(adj.begin(), adj.end());
+      vector<vector<size_t>> parts;
+      if (nonadj > 0)
+      {
+        parts.emplace_back();
+        for (size_t i : cells[c])
+        {
+          if (labels.find(i) == labels.end())
+          {
+            parts.back().push_back(i);
+          }
+        }
+      }
+      for (size_t k = 0, nadj = adj.size(); k < nadj; k++)
+      {
+        if (k == 0 || adj[k].first != adj[k - 1].first)
+        {
+          parts.emplace_back();
+        }
+        parts.back().push_back(adj[k].second);
+      }
+      if (parts.size() == 1)
+      {
+        continue;
+      }
+      // a largest part keeps the color c
+      size_t largest = 0;
+      for (size_t k = 1, nparts = parts.size(); k < nparts; k++)
+      {
+        if (parts[k].size() > parts[largest].size())
+        {
+          largest = k;
+        }
+      }
+      for (size_t k = 0, nparts = parts.size(); k < nparts; k++)
+      {
+        if (k == largest)
+        {
+          continue;
+        }
+        size_t nc = cells.size();
+        for (size_t i : parts[k])
+        {
+          color[i] = nc;
+        }
+        cells.emplace_back(std::move(parts[k]));
+        worklist.push_back(nc);
+      }
+      // c remains a splitter if it is one, otherwise splitting by the other
+      // parts suffices, since the edges to c were already counted
+      cells[c] = std::move(parts[largest]);
+    }
+  }
+  ncolors = cells.size();
+  Trace("ufsymm") << "UFSYMM refinement has " << ncolors << " colors for "
+                  << nnodes << " nodes" << endl;
+  map<size_t, Permutation> classes;
+  for (size_t i = 0; i < nnodes; i++)
+  {
+    if (nodes[i].isVar() && !nodes[i].getType().isFunction())
+    {
+      classes[color[i]].insert(nodes[i]);
+    }
+  }
+  for (const pair<const size_t, Permutation>& c : classes)
+  {
+    if (c.second.size() > 1 && d_permutations.insert(c.second).second)
+    {
+      Trace("ufsymm") << "UFSYMM refinement guessed " << c.second << endl;
+      ++(d_stats.d_permutationSetsRefined);
+    }
+  }
 }
 
 bool SymmetryBreaker::invariantByPermutations(const Permutation& p) {
@@ -812,7 +1036,10 @@ SymmetryBreaker::Statistics::Statistics(StatisticsRegistry& sr,
           sr.registerTimer(name + "timers::invariantByPermutations")),
       d_selectTermsTimer(sr.registerTimer(name + "timers::selectTerms")),
       d_initNormalizationTimer(
-          sr.registerTimer(name + "timers::initNormalization"))
+          sr.registerTimer(name + "timers::initNormalization")),
+      d_permutationSetsRefined(sr.registerInt(name + "permutationSetsRefined")),
+      d_guessPermutationsTimer(
+          sr.registerTimer(name + "timers::guessPermutations"))
 {
 }
 
@@ -146,6 +146,10 @@ public:
     TimerStat d_selectTermsTimer;
     /** time spent in initial round of normalization */
     TimerStat d_initNormalizationTimer;
+    /** number of permutation sets guessed by partition refinement */
+    IntStat d_permutationSetsRefined;
+    /** time spent in guessPermutations() */
+    TimerStat d_guessPermutationsTimer;
 
     Statistics(StatisticsRegistry& sr, const std::string& name);
   };
@@ -35,7 +35,7 @@ void UfModelTreeNode::clear(){
 }
 
 //set value function
-void UfModelTreeNode::setValue( TheoryModel* m, Node n, Node v, std::vector< int >& indexOrder, bool ground, int argIndex ){
+void UfModelTreeNode::setValue( const TheoryModel* m, Node n, Node v, std::vector< int >& indexOrder, bool ground, int argIndex ){
   if( d_data.empty() ){
     //overwrite value if either at leaf or this is a fresh tree
     d_value = v;
@@ -98,7 +98,7 @@ Node UfModelTreeNode::getFunctionValue(const std::vector<Node>& args,
 }
 
 //update function
-void UfModelTreeNode::update( TheoryModel* m ){
+void UfModelTreeNode::update( const TheoryModel* m ){
   if( !d_value.isNull() ){
     d_value = m->getRepresentative( d_value );
   }
@@ -119,6 +119,13 @@ EqualityStatus Valuation::getEqualityStatus(TNode a, TNode b) {
   return d_engine->getEqualityStatus(a, b);
 }
 
+size_t Valuation::getSharedTouchedTerms(size_t start,
+                                        std::unordered_set<TNode>& terms) const
+{
+  Assert(d_engine != nullptr);
+  return d_engine->getSharedTouchedTerms(start, terms);
+}
+
 Node Valuation::getCandidateModelValue(TNode var)
 {
   Assert(d_engine != nullptr);
@@ -22,6 +22,8 @@
 #ifndef CVC5__THEORY__VALUATION_H
 #define CVC5__THEORY__VALUATION_H
 
+#include <unordered_set>
+
 #include "context/cdlist.h"
 #include "expr/node.h"
 #include "options/theory_options.h"
@@ -109,6 +111,15 @@ public:
    */
   EqualityStatus getEqualityStatus(TNode a, TNode b);
 
+  /**
+   * Adds to terms the shared terms whose equality status may have changed,
+   * i.e. whose classes were merged or made disequal, in the current SAT
+   * context, ignoring the first start such changes.
+   * @return The number of such changes in the current SAT context.
+   */
+  size_t getSharedTouchedTerms(size_t start,
+                               std::unordered_set<TNode>& terms) const;
+
   /**
    * Returns the candidate model value of the shared term (or null if not
    * available). A candidate model value is one computed at full effort,
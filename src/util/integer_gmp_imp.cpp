@@ -17,6 +17,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "base/check.h"
 #include "base/cvc5config.h"
@@ -31,108 +32,315 @@ using namespace std;
 
 namespace cvc5::internal {
 
+namespace {
+
+/** Set res to a + b. */
+void addSi(mpz_ptr res, mpz_srcptr a, signed long int b)
+{
+  if (b >= 0)
+  {
+    mpz_add_ui(res, a, static_cast<unsigned long int>(b));
+  }
+  else
+  {
+    mpz_sub_ui(res, a, -static_cast<unsigned long int>(b));
+  }
+}
+
+/** Set res to a - b. */
+void subSi(mpz_ptr res, mpz_srcptr a, signed long int b)
+{
+  if (b >= 0)
+  {
+    mpz_sub_ui(res, a, static_cast<unsigned long int>(b));
+  }
+  else
+  {
+    mpz_add_ui(res, a, -static_cast<unsigned long int>(b));
+  }
+}
+
+}  // namespace
+
 Integer::Integer(const char* s, unsigned base)
-  : d_value(s, base)
-{}
+    : d_small(0), d_isSmall(false), d_value(s, base)
+{
+  normalize();
+}
 
 Integer::Integer(const std::string& s, unsigned base)
-  : d_value(s, base)
-{}
+    : d_small(0), d_isSmall(false), d_value(s, base)
+{
+  normalize();
+}
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
-Integer::Integer(int64_t z) : d_value(construct_mpz(z)) {}
-Integer::Integer(uint64_t z) : d_value(construct_mpz(z)) {}
+Integer::Integer(int64_t z)
+    : d_small(0), d_isSmall(false), d_value(construct_mpz(z))
+{
+  normalize();
+}
+Integer::Integer(uint64_t z)
+    : d_small(0), d_isSmall(false), d_value(construct_mpz(z))
+{
+  normalize();
+}
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
 Integer& Integer::operator=(const Integer& x)
 {
   if (this == &x) return *this;
-  d_value = x.d_value;
+  d_small = x.d_small;
+  d_isSmall = x.d_isSmall;
+  if (!d_isSmall)
+  {
+    d_value = x.d_value;
+  }
   return *this;
 }
 
+int Integer::cmp(const Integer& y) const
+{
+  if (d_isSmall && y.d_isSmall)
+  {
+    return d_small < y.d_small ? -1 : (d_small > y.d_small ? 1 : 0);
+  }
+  // values that are not small are out of the range of small ones
+  if (d_isSmall)
+  {
+    return -y.sgn();
+  }
+  if (y.d_isSmall)
+  {
+    return sgn();
+  }
+  int c = mpz_cmp(d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  return c < 0 ? -1 : (c > 0 ? 1 : 0);
+}
+
 bool Integer::operator==(const Integer& y) const
 {
+  if (d_isSmall || y.d_isSmall)
+  {
+    // the representation is canonical
+    return d_isSmall == y.d_isSmall && d_small == y.d_small;
+  }
   return d_value == y.d_value;
 }
 
-Integer Integer::operator-() const { return Integer(-(d_value)); }
-
-bool Integer::operator!=(const Integer& y) const
+Integer Integer::operator-() const
 {
-  return d_value != y.d_value;
+  if (d_isSmall && d_small != std::numeric_limits<signed long int>::min())
+  {
+    return Integer(-d_small);
+  }
+  mpz_class buf;
+  return Integer(-get_mpz(buf));
 }
 
-bool Integer::operator<(const Integer& y) const { return d_value < y.d_value; }
+bool Integer::operator!=(const Integer& y) const { return !(*this == y); }
 
-bool Integer::operator<=(const Integer& y) const
-{
-  return d_value <= y.d_value;
-}
+bool Integer::operator<(const Integer& y) const { return cmp(y) < 0; }
 
-bool Integer::operator>(const Integer& y) const { return d_value > y.d_value; }
+bool Integer::operator<=(const Integer& y) const { return cmp(y) <= 0; }
 
-bool Integer::operator>=(const Integer& y) const
-{
-  return d_value >= y.d_value;
-}
+bool Integer::operator>(const Integer& y) const { return cmp(y) > 0; }
+
+bool Integer::operator>=(const Integer& y) const { return cmp(y) >= 0; }
 
 Integer Integer::operator+(const Integer& y) const
 {
-  return Integer(d_value + y.d_value);
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_add_overflow(d_small, y.d_small, &res))
+  {
+    return Integer(res);
+  }
+  mpz_class sum;
+  if (y.d_isSmall)
+  {
+    mpz_class buf;
+    addSi(sum.get_mpz_t(), get_mpz(buf).get_mpz_t(), y.d_small);
+  }
+  else if (d_isSmall)
+  {
+    addSi(sum.get_mpz_t(), y.d_value.get_mpz_t(), d_small);
+  }
+  else
+  {
+    mpz_add(sum.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  return Integer(std::move(sum));
 }
 
 Integer& Integer::operator+=(const Integer& y)
 {
-  d_value += y.d_value;
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_add_overflow(d_small, y.d_small, &res))
+  {
+    d_small = res;
+    return *this;
+  }
+  // y may be this
+  mpz_class& value = get_mpz_mutable();
+  if (y.d_isSmall)
+  {
+    addSi(value.get_mpz_t(), value.get_mpz_t(), y.d_small);
+  }
+  else
+  {
+    mpz_add(value.get_mpz_t(), value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  normalize();
   return *this;
 }
 
 Integer Integer::operator-(const Integer& y) const
 {
-  return Integer(d_value - y.d_value);
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_sub_overflow(d_small, y.d_small, &res))
+  {
+    return Integer(res);
+  }
+  mpz_class diff;
+  if (y.d_isSmall)
+  {
+    mpz_class buf;
+    subSi(diff.get_mpz_t(), get_mpz(buf).get_mpz_t(), y.d_small);
+  }
+  else if (d_isSmall)
+  {
+    subSi(diff.get_mpz_t(), y.d_value.get_mpz_t(), d_small);
+    mpz_neg(diff.get_mpz_t(), diff.get_mpz_t());
+  }
+  else
+  {
+    mpz_sub(diff.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  return Integer(std::move(diff));
 }
 
 Integer& Integer::operator-=(const Integer& y)
 {
-  d_value -= y.d_value;
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_sub_overflow(d_small, y.d_small, &res))
+  {
+    d_small = res;
+    return *this;
+  }
+  // y may be this
+  mpz_class& value = get_mpz_mutable();
+  if (y.d_isSmall)
+  {
+    subSi(value.get_mpz_t(), value.get_mpz_t(), y.d_small);
+  }
+  else
+  {
+    mpz_sub(value.get_mpz_t(), value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  normalize();
   return *this;
 }
 
 Integer Integer::operator*(const Integer& y) const
 {
-  return Integer(d_value * y.d_value);
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_mul_overflow(d_small, y.d_small, &res))
+  {
+    return Integer(res);
+  }
+  mpz_class prod;
+  if (y.d_isSmall)
+  {
+    mpz_class buf;
+    mpz_mul_si(prod.get_mpz_t(), get_mpz(buf).get_mpz_t(), y.d_small);
+  }
+  else if (d_isSmall)
+  {
+    mpz_mul_si(prod.get_mpz_t(), y.d_value.get_mpz_t(), d_small);
+  }
+  else
+  {
+    mpz_mul(prod.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  return Integer(std::move(prod));
 }
 
 Integer& Integer::operator*=(const Integer& y)
 {
-  d_value *= y.d_value;
+  signed long int res;
+  if (d_isSmall && y.d_isSmall
+      && !__builtin_mul_overflow(d_small, y.d_small, &res))
+  {
+    d_small = res;
+    return *this;
+  }
+  // y may be this
+  mpz_class& value = get_mpz_mutable();
+  if (y.d_isSmall)
+  {
+    mpz_mul_si(value.get_mpz_t(), value.get_mpz_t(), y.d_small);
+  }
+  else
+  {
+    mpz_mul(value.get_mpz_t(), value.get_mpz_t(), y.d_value.get_mpz_t());
+  }
+  normalize();
   return *this;
 }
 
 Integer Integer::bitwiseOr(const Integer& y) const
 {
+  if (d_isSmall && y.d_isSmall)
+  {
+    return Integer(d_small | y.d_small);
+  }
   mpz_class result;
-  mpz_ior(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_ior(result.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
   return Integer(result);
 }
 
 Integer Integer::bitwiseAnd(const Integer& y) const
 {
+  if (d_isSmall && y.d_isSmall)
+  {
+    return Integer(d_small & y.d_small);
+  }
   mpz_class result;
-  mpz_and(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_and(result.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
   return Integer(result);
 }
 
 Integer Integer::bitwiseXor(const Integer& y) const
 {
+  if (d_isSmall && y.d_isSmall)
+  {
+    return Integer(d_small ^ y.d_small);
+  }
   mpz_class result;
-  mpz_xor(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_xor(result.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
   return Integer(result);
 }
 
 Integer Integer::bitwiseNot() const
 {
+  if (d_isSmall)
+  {
+    return Integer(~d_small);
+  }
   mpz_class result;
   mpz_com(result.get_mpz_t(), d_value.get_mpz_t());
   return Integer(result);
@@ -141,7 +349,8 @@ Integer Integer::bitwiseNot() const
 Integer Integer::multiplyByPow2(uint32_t pow) const
 {
   mpz_class result;
-  mpz_mul_2exp(result.get_mpz_t(), d_value.get_mpz_t(), pow);
+  mpz_class buf;
+  mpz_mul_2exp(result.get_mpz_t(), get_mpz(buf).get_mpz_t(), pow);
   return Integer(result);
 }
 
@@ -149,12 +358,13 @@ void Integer::setBit(uint32_t i, bool value)
 {
   if (value)
   {
-    mpz_setbit(d_value.get_mpz_t(), i);
+    mpz_setbit(get_mpz_mutable().get_mpz_t(), i);
   }
   else
   {
-    mpz_clrbit(d_value.get_mpz_t(), i);
+    mpz_clrbit(get_mpz_mutable().get_mpz_t(), i);
   }
+  normalize();
 }
 
 bool Integer::isBitSet(uint32_t i) const
@@ -166,7 +376,8 @@ Integer Integer::oneExtend(uint32_t size, uint32_t amount) const
 {
   // check that the size is accurate
   Assert((*this) < Integer(1).multiplyByPow2(size));
-  mpz_class res = d_value;
+  mpz_class buf;
+  mpz_class res = get_mpz(buf);
 
   for (unsigned i = size; i < size + amount; ++i)
   {
@@ -178,7 +389,8 @@ Integer Integer::oneExtend(uint32_t size, uint32_t amount) const
 
 uint32_t Integer::toUnsignedInt() const
 {
-  return mpz_get_ui(d_value.get_mpz_t());
+  mpz_class buf;
+  return mpz_get_ui(get_mpz(buf).get_mpz_t());
 }
 
 Integer Integer::extractBitRange(uint32_t bitCount, uint32_t low) const
@@ -187,7 +399,8 @@ Integer Integer::extractBitRange(uint32_t bitCount, uint32_t low) const
   uint32_t high = low + bitCount - 1;
   //- Function: void mpz_fdiv_r_2exp (mpz_t r, mpz_t n, mp_bitcnt_t b)
   mpz_class rem, div;
-  mpz_fdiv_r_2exp(rem.get_mpz_t(), d_value.get_mpz_t(), high + 1);
+  mpz_class buf;
+  mpz_fdiv_r_2exp(rem.get_mpz_t(), get_mpz(buf).get_mpz_t(), high + 1);
   mpz_fdiv_q_2exp(div.get_mpz_t(), rem.get_mpz_t(), low);
 
   return Integer(div);
@@ -195,16 +408,16 @@ Integer Integer::extractBitRange(uint32_t bitCount, uint32_t low) const
 
 Integer Integer::floorDivideQuotient(const Integer& y) const
 {
-  mpz_class q;
-  mpz_fdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(q);
+  Integer q, r;
+  floorQR(q, r, *this, y);
+  return q;
 }
 
 Integer Integer::floorDivideRemainder(const Integer& y) const
 {
-  mpz_class r;
-  mpz_fdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  return Integer(r);
+  Integer q, r;
+  floorQR(q, r, *this, y);
+  return r;
 }
 
 void Integer::floorQR(Integer& q,
@@ -212,26 +425,51 @@ void Integer::floorQR(Integer& q,
                       const Integer& x,
                       const Integer& y)
 {
-  mpz_fdiv_qr(q.d_value.get_mpz_t(),
-              r.d_value.get_mpz_t(),
-              x.d_value.get_mpz_t(),
-              y.d_value.get_mpz_t());
+  if (x.d_isSmall && y.d_isSmall && y.d_small != 0
+      && !(x.d_small == std::numeric_limits<signed long int>::min()
+           && y.d_small == -1))
+  {
+    // truncating division, rounded towards negative infinity
+    signed long int qs = x.d_small / y.d_small;
+    signed long int rs = x.d_small % y.d_small;
+    if (rs != 0 && ((rs < 0) != (y.d_small < 0)))
+    {
+      qs -= 1;
+      rs += y.d_small;
+    }
+    q = Integer(qs);
+    r = Integer(rs);
+    return;
+  }
+  mpz_class qv, rv;
+  mpz_class xbuf, ybuf;
+  mpz_fdiv_qr(qv.get_mpz_t(),
+              rv.get_mpz_t(),
+              x.get_mpz(xbuf).get_mpz_t(),
+              y.get_mpz(ybuf).get_mpz_t());
+  q = Integer(qv);
+  r = Integer(rv);
 }
 
 Integer Integer::ceilingDivideQuotient(const Integer& y) const
 {
   mpz_class q;
-  mpz_cdiv_q(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_cdiv_q(q.get_mpz_t(),
+             get_mpz(buf).get_mpz_t(),
+             y.get_mpz(ybuf).get_mpz_t());
   return Integer(q);
 }
 
 Integer Integer::ceilingDivideRemainder(const Integer& y) const
 {
   mpz_class r;
-  mpz_cdiv_r(r.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_cdiv_r(r.get_mpz_t(),
+             get_mpz(buf).get_mpz_t(),
+             y.get_mpz(ybuf).get_mpz_t());
   return Integer(r);
 }
-
 void Integer::euclidianQR(Integer& q,
                           Integer& r,
                           const Integer& x,
@@ -283,26 +521,42 @@ Integer Integer::euclidianDivideRemainder(const Integer& y) const
 Integer Integer::exactQuotient(const Integer& y) const
 {
   Assert(y.divides(*this));
+  if (d_isSmall && y.d_isSmall && y.d_small != 0 && y.d_small != -1)
+  {
+    return Integer(d_small / y.d_small);
+  }
   mpz_class q;
-  mpz_divexact(q.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_divexact(q.get_mpz_t(),
+               get_mpz(buf).get_mpz_t(),
+               y.get_mpz(ybuf).get_mpz_t());
   return Integer(q);
 }
 
 Integer Integer::modByPow2(uint32_t exp) const
 {
   mpz_class res;
-  mpz_fdiv_r_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
+  mpz_class buf;
+  mpz_fdiv_r_2exp(res.get_mpz_t(), get_mpz(buf).get_mpz_t(), exp);
   return Integer(res);
 }
 
 Integer Integer::divByPow2(uint32_t exp) const
 {
   mpz_class res;
-  mpz_fdiv_q_2exp(res.get_mpz_t(), d_value.get_mpz_t(), exp);
+  mpz_class buf;
+  mpz_fdiv_q_2exp(res.get_mpz_t(), get_mpz(buf).get_mpz_t(), exp);
   return Integer(res);
 }
 
-int Integer::sgn() const { return mpz_sgn(d_value.get_mpz_t()); }
+int Integer::sgn() const
+{
+  if (d_isSmall)
+  {
+    return d_small < 0 ? -1 : (d_small > 0 ? 1 : 0);
+  }
+  return mpz_sgn(d_value.get_mpz_t());
+}
 
 bool Integer::strictlyPositive() const { return sgn() > 0; }
 
@@ -310,47 +564,74 @@ bool Integer::strictlyNegative() const { return sgn() < 0; }
 
 bool Integer::isZero() const { return sgn() == 0; }
 
-bool Integer::isOne() const { return mpz_cmp_si(d_value.get_mpz_t(), 1) == 0; }
+bool Integer::isOne() const { return d_isSmall && d_small == 1; }
 
-bool Integer::isNegativeOne() const
-{
-  return mpz_cmp_si(d_value.get_mpz_t(), -1) == 0;
-}
+bool Integer::isNegativeOne() const { return d_isSmall && d_small == -1; }
 
 Integer Integer::pow(uint32_t exp) const
 {
   mpz_class result;
-  mpz_pow_ui(result.get_mpz_t(), d_value.get_mpz_t(), exp);
+  mpz_class buf;
+  mpz_pow_ui(result.get_mpz_t(), get_mpz(buf).get_mpz_t(), exp);
   return Integer(result);
 }
 
 Integer Integer::gcd(const Integer& y) const
 {
+  if (d_isSmall && y.d_isSmall)
+  {
+    // Euclid's algorithm on the absolute values, which may not fit into a
+    // signed long
+    unsigned long int a = d_small < 0 ? -static_cast<unsigned long int>(d_small)
+                                      : d_small;
+    unsigned long int b = y.d_small < 0
+                              ? -static_cast<unsigned long int>(y.d_small)
+                              : y.d_small;
+    while (b != 0)
+    {
+      unsigned long int t = a % b;
+      a = b;
+      b = t;
+    }
+    return Integer(a);
+  }
   mpz_class result;
-  mpz_gcd(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_gcd(result.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
   return Integer(result);
 }
 
 Integer Integer::lcm(const Integer& y) const
 {
   mpz_class result;
-  mpz_lcm(result.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
+  mpz_class buf, ybuf;
+  mpz_lcm(result.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
   return Integer(result);
 }
 
 Integer Integer::modAdd(const Integer& y, const Integer& m) const
 {
   mpz_class res;
-  mpz_add(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
+  mpz_class buf, ybuf, mbuf;
+  mpz_add(res.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.get_mpz(mbuf).get_mpz_t());
   return Integer(res);
 }
 
 Integer Integer::modMultiply(const Integer& y, const Integer& m) const
 {
   mpz_class res;
-  mpz_mul(res.get_mpz_t(), d_value.get_mpz_t(), y.d_value.get_mpz_t());
-  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.d_value.get_mpz_t());
+  mpz_class buf, ybuf, mbuf;
+  mpz_mul(res.get_mpz_t(),
+          get_mpz(buf).get_mpz_t(),
+          y.get_mpz(ybuf).get_mpz_t());
+  mpz_mod(res.get_mpz_t(), res.get_mpz_t(), m.get_mpz(mbuf).get_mpz_t());
   return Integer(res);
 }
 
@@ -358,7 +639,10 @@ Integer Integer::modInverse(const Integer& m) const
 {
   Assert(m > 0) << "m must be greater than zero";
   mpz_class res;
-  if (mpz_invert(res.get_mpz_t(), d_value.get_mpz_t(), m.d_value.get_mpz_t())
+  mpz_class buf, mbuf;
+  if (mpz_invert(res.get_mpz_t(),
+                 get_mpz(buf).get_mpz_t(),
+                 m.get_mpz(mbuf).get_mpz_t())
       == 0)
   {
     return Integer(-1);
@@ -368,50 +652,74 @@ Integer Integer::modInverse(const Integer& m) const
 
 bool Integer::divides(const Integer& y) const
 {
-  int res = mpz_divisible_p(y.d_value.get_mpz_t(), d_value.get_mpz_t());
+  if (d_isSmall && y.d_isSmall && d_small != 0 && d_small != -1)
+  {
+    return y.d_small % d_small == 0;
+  }
+  mpz_class ybuf, buf;
+  int res =
+      mpz_divisible_p(y.get_mpz(ybuf).get_mpz_t(), get_mpz(buf).get_mpz_t());
   return res != 0;
 }
 
-Integer Integer::abs() const { return d_value >= 0 ? *this : -*this; }
+Integer Integer::abs() const { return sgn() >= 0 ? *this : -*this; }
 
-std::string Integer::toString(int base) const { return d_value.get_str(base); }
+std::string Integer::toString(int base) const
+{
+  if (d_isSmall && base == 10)
+  {
+    return std::to_string(d_small);
+  }
+  mpz_class buf;
+  return get_mpz(buf).get_str(base);
+}
 
-bool Integer::fitsSignedInt() const { return d_value.fits_sint_p(); }
+bool Integer::fitsSignedInt() const
+{
+  return d_isSmall && d_small >= std::numeric_limits<int>::min()
+         && d_small <= std::numeric_limits<int>::max();
+}
 
-bool Integer::fitsUnsignedInt() const { return d_value.fits_uint_p(); }
+bool Integer::fitsUnsignedInt() const
+{
+  if (d_isSmall)
+  {
+    return d_small >= 0
+           && static_cast<unsigned long int>(d_small)
+                  <= std::numeric_limits<unsigned int>::max();
+  }
+  return d_value.fits_uint_p();
+}
 
 signed int Integer::getSignedInt() const
 {
   // ensure there isn't overflow
-  Assert(d_value <= std::numeric_limits<int>::max())
-      << "Overflow detected in Integer::getSignedInt().";
-  Assert(d_value >= std::numeric_limits<int>::min())
-      << "Overflow detected in Integer::getSignedInt().";
   Assert(fitsSignedInt()) << "Overflow detected in Integer::getSignedInt().";
-  return (signed int)d_value.get_si();
+  return (signed int)getLong();
 }
 
 unsigned int Integer::getUnsignedInt() const
 {
   // ensure there isn't overflow
-  Assert(d_value <= std::numeric_limits<unsigned int>::max())
-      << "Overflow detected in Integer::getUnsignedInt()";
-  Assert(d_value >= std::numeric_limits<unsigned int>::min())
-      << "Overflow detected in Integer::getUnsignedInt()";
   Assert(fitsUnsignedInt()) << "Overflow detected in Integer::getUnsignedInt()";
-  return (unsigned int)d_value.get_ui();
+  return (unsigned int)getUnsignedLong();
 }
 
 long Integer::getLong() const
 {
   // ensure there it fits
-  Assert(mpz_fits_slong_p(d_value.get_mpz_t()) != 0)
-      << "Overflow detected in Integer::getLong().";
-  return d_value.get_si();
+  Assert(d_isSmall) << "Overflow detected in Integer::getLong().";
+  return d_small;
 }
 
 unsigned long Integer::getUnsignedLong() const
 {
+  if (d_isSmall)
+  {
+    Assert(d_small >= 0)
+        << "Overflow detected in Integer::getUnsignedLong().";
+    return static_cast<unsigned long>(d_small);
+  }
   // ensure that it fits
   Assert(mpz_fits_ulong_p(d_value.get_mpz_t()) != 0)
       << "Overflow detected in Integer::getUnsignedLong().";
@@ -426,7 +734,7 @@ int64_t Integer::getSigned64() const
   }
   else
   {
-    if (mpz_fits_slong_p(d_value.get_mpz_t()) != 0)
+    if (d_isSmall)
     {
       return getLong();
     }
@@ -449,7 +757,7 @@ uint64_t Integer::getUnsigned64() const
   }
   else
   {
-    if (mpz_fits_ulong_p(d_value.get_mpz_t()) != 0)
+    if (d_isSmall || mpz_fits_ulong_p(d_value.get_mpz_t()) != 0)
     {
       return getUnsignedLong();
     }
@@ -466,16 +774,42 @@ uint64_t Integer::getUnsigned64() const
   return 0;
 }
 
-size_t Integer::hash() const { return gmpz_hash(d_value.get_mpz_t()); }
+size_t Integer::hash() const
+{
+  if (d_isSmall && sizeof(mp_limb_t) >= sizeof(signed long int))
+  {
+    // same as the hash of the GMP integer, which is the absolute value
+    return d_small < 0 ? -static_cast<size_t>(d_small)
+                       : static_cast<size_t>(d_small);
+  }
+  return gmpz_hash(d_value.get_mpz_t());
+}
 
 bool Integer::testBit(unsigned n) const
 {
+  if (d_isSmall)
+  {
+    // two's complement, as in GMP
+    return n >= std::numeric_limits<unsigned long int>::digits
+               ? d_small < 0
+               : ((static_cast<unsigned long int>(d_small) >> n) & 1) != 0;
+  }
   return mpz_tstbit(d_value.get_mpz_t(), n);
 }
 
 unsigned Integer::isPow2() const
 {
-  if (d_value <= 0) return 0;
+  if (sgn() <= 0) return 0;
+  if (d_isSmall)
+  {
+    unsigned long int v = static_cast<unsigned long int>(d_small);
+    if ((v & (v - 1)) == 0)
+    {
+      // return the index of the one plus 1
+      return __builtin_ctzl(v) + 1;
+    }
+    return 0;
+  }
   // check that the number of ones in the binary representation is 1
   if (mpz_popcount(d_value.get_mpz_t()) == 1)
   {
@@ -491,6 +825,13 @@ size_t Integer::length() const
   {
     return 1;
   }
+  else if (d_isSmall)
+  {
+    unsigned long int v = d_small < 0
+                              ? -static_cast<unsigned long int>(d_small)
+                              : static_cast<unsigned long int>(d_small);
+    return std::numeric_limits<unsigned long int>::digits - __builtin_clzl(v);
+  }
   else
   {
     return mpz_sizeinbase(d_value.get_mpz_t(), 2);
@@ -499,7 +840,8 @@ size_t Integer::length() const
 
 bool Integer::isProbablePrime() const
 {
-  return mpz_probab_prime_p(d_value.get_mpz_t(), 30) > 0;
+  mpz_class buf;
+  return mpz_probab_prime_p(get_mpz(buf).get_mpz_t(), 30) > 0;
 }
 
 void Integer::extendedGcd(
@@ -507,11 +849,16 @@ void Integer::extendedGcd(
 {
   // see the documentation for:
   // mpz_gcdext (mpz_t g, mpz_t s, mpz_t t, mpz_t a, mpz_t b);
-  mpz_gcdext(g.d_value.get_mpz_t(),
-             s.d_value.get_mpz_t(),
-             t.d_value.get_mpz_t(),
-             a.d_value.get_mpz_t(),
-             b.d_value.get_mpz_t());
+  mpz_class gv, sv, tv;
+  mpz_class abuf, bbuf;
+  mpz_gcdext(gv.get_mpz_t(),
+             sv.get_mpz_t(),
+             tv.get_mpz_t(),
+             a.get_mpz(abuf).get_mpz_t(),
+             b.get_mpz(bbuf).get_mpz_t());
+  g = Integer(gv);
+  s = Integer(sv);
+  t = Integer(tv);
 }
 
 const Integer& Integer::min(const Integer& a, const Integer& b)
@@ -21,12 +21,21 @@
 #include <gmpxx.h>
 
 #include <iosfwd>
+#include <limits>
 #include <string>
+#include <utility>
 
 namespace cvc5::internal {
 
 class Rational;
 
+/**
+ * Integers whose value fits into a signed long are stored inline, and
+ * arithmetic on them is done on machine words, with overflow checks that fall
+ * back to GMP. Larger values are stored in a GMP integer. The representation is
+ * canonical, i.e. an Integer is stored inline iff its value fits into a signed
+ * long.
+ */
 class Integer
 {
   friend class cvc5::internal::Rational;
@@ -35,10 +44,20 @@ class Integer
   /**
    * Constructs an Integer by copying a GMP C++ primitive.
    */
-  Integer(const mpz_class& val) : d_value(val) {}
+  Integer(const mpz_class& val) : d_small(0), d_isSmall(false), d_value(val)
+  {
+    normalize();
+  }
+
+  /** Constructs an Integer by moving a GMP C++ primitive. */
+  Integer(mpz_class&& val)
+      : d_small(0), d_isSmall(false), d_value(std::move(val))
+  {
+    normalize();
+  }
 
   /** Constructs a rational with the value 0. */
-  Integer() : d_value(0) {}
+  Integer() : d_small(0), d_isSmall(true) {}
 
   /**
    * Constructs a Integer from a C string.
@@ -49,12 +68,18 @@ class Integer
   explicit Integer(const char* s, unsigned base = 10);
   explicit Integer(const std::string& s, unsigned base = 10);
 
-  Integer(const Integer& q) : d_value(q.d_value) {}
+  Integer(const Integer& q) : d_small(q.d_small), d_isSmall(q.d_isSmall)
+  {
+    if (!d_isSmall)
+    {
+      d_value = q.d_value;
+    }
+  }
 
-  Integer(signed int z) : d_value(z) {}
-  Integer(unsigned int z) : d_value(z) {}
-  Integer(signed long int z) : d_value(z) {}
-  Integer(unsigned long int z) : d_value(z) {}
+  Integer(signed int z) : d_small(z), d_isSmall(true) {}
+  Integer(unsigned int z) { setUnsigned(z); }
+  Integer(signed long int z) : d_small(z), d_isSmall(true) {}
+  Integer(unsigned long int z) { setUnsigned(z); }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   Integer(int64_t z);
@@ -64,8 +89,11 @@ class Integer
   /** Destructor. */
   ~Integer() {}
 
-  /** Returns a copy of d_value to enable public access of GMP data. */
-  const mpz_class& getValue() const { return d_value; }
+  /**
+   * Returns the value as GMP data, to enable public access of GMP data. See
+   * get_mpz().
+   */
+  const mpz_class& getValue(mpz_class& buf) const { return get_mpz(buf); }
 
   /** Overload copy assignment operator. */
   Integer& operator=(const Integer& x);
@@ -320,14 +348,72 @@ class Integer
 
  private:
   /**
-   * Gets a reference to the gmp data that backs up the integer.
-   * Only accessible to friend classes.
+   * Gets the value as gmp data. Returns a reference to d_value if the value
+   * is not stored inline. Otherwise, the value is written to buf, and a
+   * reference to buf is returned. Only accessible to friend classes.
+   */
+  const mpz_class& get_mpz(mpz_class& buf) const
+  {
+    if (d_isSmall)
+    {
+      buf = d_small;
+      return buf;
+    }
+    return d_value;
+  }
+
+  /**
+   * Gets a reference to the gmp data for modification, normalize() must be
+   * called after modifying it.
    */
-  const mpz_class& get_mpz() const { return d_value; }
+  mpz_class& get_mpz_mutable()
+  {
+    if (d_isSmall)
+    {
+      d_value = d_small;
+      d_isSmall = false;
+    }
+    return d_value;
+  }
+
+  /** Use the inline representation if the value of d_value fits into it. */
+  void normalize()
+  {
+    d_isSmall = d_value.fits_slong_p();
+    if (d_isSmall)
+    {
+      d_small = d_value.get_si();
+    }
+  }
+
+  /** Set this to the given unsigned value. */
+  void setUnsigned(unsigned long int z)
+  {
+    d_isSmall = z <= static_cast<unsigned long int>(
+                    std::numeric_limits<signed long int>::max());
+    if (d_isSmall)
+    {
+      d_small = static_cast<signed long int>(z);
+    }
+    else
+    {
+      d_small = 0;
+      d_value = z;
+    }
+  }
+
+  /** Returns -1, 0 or 1 if this is less than, equal to or greater than y. */
+  int cmp(const Integer& y) const;
+
+  /** The value, if d_isSmall is true. */
+  signed long int d_small;
+
+  /** Whether the value is stored in d_small, rather than in d_value. */
+  bool d_isSmall;
 
   /**
-   * The value of the rational is stored in a C++ GMP integer class.
-   * Using this instead of mpz_t allows for easier destruction.
+   * The value of the integer is stored in a C++ GMP integer class, if
+   * d_isSmall is false.
    */
   mpz_class d_value;
 }; /* class Integer */
@@ -125,7 +125,8 @@ Rational toRationalBelow(const poly::Value& v)
 poly::Integer toInteger(const Integer& i)
 {
 #ifdef CVC5_GMP_IMP
-  return poly::Integer(i.getValue());
+  mpz_class buf;
+  return poly::Integer(i.getValue(buf));
 #endif
 #ifdef CVC5_CLN_IMP
   if (std::numeric_limits<long>::min() <= i.getValue()
@@ -148,7 +149,8 @@ std::vector<poly::Integer> toInteger(const std::vector<Integer>& vi)
 poly::Rational toRational(const Rational& r)
 {
 #ifdef CVC5_GMP_IMP
-  return poly::Rational(r.getValue());
+  mpq_class buf;
+  return poly::Rational(r.getValue(buf));
 #endif
 #ifdef CVC5_CLN_IMP
   return poly::Rational(toInteger(r.getNumerator()),
@@ -13,8 +13,11 @@
  * A multi-precision rational constant.
  */
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "base/cvc5config.h"
 #include "util/rational.h"
@@ -31,6 +34,321 @@ std::ostream& operator<<(std::ostream& os, const Rational& q){
   return os << q.toString();
 }
 
+namespace {
+
+/** Returns the absolute value of x as an unsigned long. */
+unsigned long int absValue(signed long int x)
+{
+  return x < 0 ? 0UL - static_cast<unsigned long int>(x)
+               : static_cast<unsigned long int>(x);
+}
+
+}  // namespace
+
+Rational::Rational(const Integer& n, const Integer& d)
+    : d_num(0), d_den(1), d_isSmall(false)
+{
+  if (n.d_isSmall && d.d_isSmall && d.d_small != 0)
+  {
+    setFraction(n.d_small, d.d_small);
+    return;
+  }
+  mpz_class nbuf, dbuf;
+  d_value = mpq_class(n.get_mpz(nbuf), d.get_mpz(dbuf));
+  d_value.canonicalize();
+  normalize();
+}
+
+Rational::Rational(const Integer& n) : d_num(0), d_den(1), d_isSmall(false)
+{
+  if (n.d_isSmall)
+  {
+    d_num = n.d_small;
+    d_isSmall = true;
+    return;
+  }
+  d_value = mpq_class(n.d_value);
+  normalize();
+}
+
+void Rational::setFraction(signed long int n, signed long int d)
+{
+  setFraction(absValue(n), (n < 0) != (d < 0), absValue(d));
+}
+
+void Rational::setFraction(unsigned long int absN,
+                           bool neg,
+                           unsigned long int absD)
+{
+  Assert(absD != 0);
+  unsigned long int g = std::gcd(absN, absD);
+  absN /= g;
+  absD /= g;
+  constexpr unsigned long int max = std::numeric_limits<signed long int>::max();
+  // the numerator may be the minimal signed long if it is negative
+  d_isSmall = absD <= max && (absN <= max || (neg && absN == max + 1));
+  if (d_isSmall)
+  {
+    d_num = static_cast<signed long int>(neg ? 0UL - absN : absN);
+    d_den = static_cast<signed long int>(absD);
+    return;
+  }
+  d_value = mpq_class(mpz_class(absN), mpz_class(absD));
+  if (neg)
+  {
+    d_value = -d_value;
+  }
+}
+
+bool Rational::setProduct(signed long int a,
+                          signed long int b,
+                          signed long int c,
+                          signed long int d)
+{
+  // cancel the common factors first, so that the result is canonical
+  signed long int g1 = static_cast<signed long int>(std::gcd(absValue(a), d));
+  signed long int g2 = static_cast<signed long int>(std::gcd(absValue(c), b));
+  signed long int num, den;
+  if (__builtin_mul_overflow(a / g1, c / g2, &num)
+      || __builtin_mul_overflow(b / g2, d / g1, &den))
+  {
+    return false;
+  }
+  d_num = num;
+  d_den = den;
+  d_isSmall = true;
+  return true;
+}
+
+double Rational::getDouble() const
+{
+  // integers with at most 53 bits are exact doubles, larger values and
+  // fractions are truncated as done by GMP
+  if (d_isSmall && d_den == 1 && absValue(d_num) <= (1UL << 53))
+  {
+    return static_cast<double>(d_num);
+  }
+  mpq_class buf;
+  return get_mpq(buf).get_d();
+}
+
+int Rational::cmp(const Rational& x) const
+{
+  if (d_isSmall && x.d_isSmall)
+  {
+    signed long int l, r;
+    if (d_den == x.d_den)
+    {
+      l = d_num;
+      r = x.d_num;
+    }
+    else if (__builtin_mul_overflow(d_num, x.d_den, &l)
+             || __builtin_mul_overflow(x.d_num, d_den, &r))
+    {
+      mpq_class buf, xbuf;
+      return mpq_cmp(get_mpq(buf).get_mpq_t(), x.get_mpq(xbuf).get_mpq_t());
+    }
+    return l < r ? -1 : (l > r ? 1 : 0);
+  }
+  // compare to the small operand without materializing it
+  if (x.d_isSmall)
+  {
+    return mpq_cmp_si(
+        d_value.get_mpq_t(), x.d_num, static_cast<unsigned long int>(x.d_den));
+  }
+  if (d_isSmall)
+  {
+    int c = mpq_cmp_si(
+        x.d_value.get_mpq_t(), d_num, static_cast<unsigned long int>(d_den));
+    return c < 0 ? 1 : (c > 0 ? -1 : 0);
+  }
+  // Don't use mpq_class's cmp() function.
+  // The name ends up conflicting with this function.
+  return mpq_cmp(d_value.get_mpq_t(), x.d_value.get_mpq_t());
+}
+
+Integer Rational::floor() const
+{
+  if (d_isSmall)
+  {
+    // the denominator is positive, and division truncates towards zero
+    signed long int q = d_num / d_den;
+    return Integer(d_num < 0 && d_num % d_den != 0 ? q - 1 : q);
+  }
+  mpz_class q;
+  mpz_fdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+  return Integer(q);
+}
+
+Integer Rational::ceiling() const
+{
+  if (d_isSmall)
+  {
+    signed long int q = d_num / d_den;
+    return Integer(d_num > 0 && d_num % d_den != 0 ? q + 1 : q);
+  }
+  mpz_class q;
+  mpz_cdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
+  return Integer(q);
+}
+
+Rational& Rational::operator=(const Rational& x)
+{
+  if (this == &x) return *this;
+  d_num = x.d_num;
+  d_den = x.d_den;
+  d_isSmall = x.d_isSmall;
+  if (!d_isSmall)
+  {
+    d_value = x.d_value;
+  }
+  return *this;
+}
+
+Rational Rational::operator-() const
+{
+  if (d_isSmall && d_num != std::numeric_limits<signed long int>::min())
+  {
+    Rational res;
+    res.d_num = -d_num;
+    res.d_den = d_den;
+    return res;
+  }
+  mpq_class buf;
+  return Rational(-get_mpq(buf));
+}
+
+bool Rational::operator==(const Rational& y) const
+{
+  if (d_isSmall || y.d_isSmall)
+  {
+    // the representation is canonical
+    return d_isSmall == y.d_isSmall && d_num == y.d_num && d_den == y.d_den;
+  }
+  return d_value == y.d_value;
+}
+
+Rational Rational::operator+(const Rational& y) const
+{
+  if (d_isSmall && y.d_isSmall)
+  {
+    signed long int l, r, n, d;
+    if (d_den == 1 && y.d_den == 1)
+    {
+      if (!__builtin_add_overflow(d_num, y.d_num, &n))
+      {
+        return Rational(n);
+      }
+    }
+    else if (!__builtin_mul_overflow(d_num, y.d_den, &l)
+             && !__builtin_mul_overflow(y.d_num, d_den, &r)
+             && !__builtin_add_overflow(l, r, &n)
+             && !__builtin_mul_overflow(d_den, y.d_den, &d))
+    {
+      return Rational(n, d);
+    }
+  }
+  mpq_class buf, ybuf, res;
+  mpq_add(res.get_mpq_t(),
+          get_mpq(buf).get_mpq_t(),
+          y.get_mpq(ybuf).get_mpq_t());
+  return Rational(std::move(res));
+}
+
+Rational Rational::operator-(const Rational& y) const
+{
+  if (d_isSmall && y.d_isSmall)
+  {
+    signed long int l, r, n, d;
+    if (d_den == 1 && y.d_den == 1)
+    {
+      if (!__builtin_sub_overflow(d_num, y.d_num, &n))
+      {
+        return Rational(n);
+      }
+    }
+    else if (!__builtin_mul_overflow(d_num, y.d_den, &l)
+             && !__builtin_mul_overflow(y.d_num, d_den, &r)
+             && !__builtin_sub_overflow(l, r, &n)
+             && !__builtin_mul_overflow(d_den, y.d_den, &d))
+    {
+      return Rational(n, d);
+    }
+  }
+  mpq_class buf, ybuf, res;
+  mpq_sub(res.get_mpq_t(),
+          get_mpq(buf).get_mpq_t(),
+          y.get_mpq(ybuf).get_mpq_t());
+  return Rational(std::move(res));
+}
+
+Rational Rational::operator*(const Rational& y) const
+{
+  Rational res;
+  if (d_isSmall && y.d_isSmall
+      && res.setProduct(d_num, d_den, y.d_num, y.d_den))
+  {
+    return res;
+  }
+  mpq_class buf, ybuf, prod;
+  mpq_mul(prod.get_mpq_t(),
+          get_mpq(buf).get_mpq_t(),
+          y.get_mpq(ybuf).get_mpq_t());
+  return Rational(std::move(prod));
+}
+
+Rational Rational::operator/(const Rational& y) const
+{
+  // division by zero is left to GMP
+  Rational res;
+  if (d_isSmall && y.d_isSmall && y.d_num != 0
+      && y.d_num != std::numeric_limits<signed long int>::min())
+  {
+    // multiply by the inverse of y, whose denominator must be positive
+    bool neg = y.d_num < 0;
+    if (res.setProduct(d_num,
+                       d_den,
+                       neg ? -y.d_den : y.d_den,
+                       neg ? -y.d_num : y.d_num))
+    {
+      return res;
+    }
+  }
+  mpq_class buf, ybuf;
+  return Rational(get_mpq(buf) / y.get_mpq(ybuf));
+}
+
+std::string Rational::toString(int base) const
+{
+  if (d_isSmall && base == 10)
+  {
+    std::string res = std::to_string(d_num);
+    if (d_den != 1)
+    {
+      res += "/" + std::to_string(d_den);
+    }
+    return res;
+  }
+  mpq_class buf;
+  return get_mpq(buf).get_str(base);
+}
+
+size_t Rational::hash() const
+{
+  if (d_isSmall && sizeof(mp_limb_t) >= sizeof(signed long int))
+  {
+    // same as the hash of the GMP rational, see Integer::hash()
+    return static_cast<size_t>(absValue(d_num))
+           ^ static_cast<size_t>(d_den);
+  }
+  mpq_class buf;
+  const mpq_class& value = get_mpq(buf);
+  size_t numeratorHash = gmpz_hash(value.get_num_mpz_t());
+  size_t denominatorHash = gmpz_hash(value.get_den_mpz_t());
+
+  return numeratorHash ^ denominatorHash;
+}
+
 
 /* Computes a rational given a decimal string. The rational
  * version of <code>xxx.yyy</code> is <code>xxxyyy/(10^3)</code>.
@@ -89,9 +407,9 @@ std::optional<Rational> Rational::fromDouble(double d)
 {
   using namespace std;
   if(isfinite(d)){
-    Rational q;
-    mpq_set_d(q.d_value.get_mpq_t(), d);
-    return q;
+    mpq_class q;
+    mpq_set_d(q.get_mpq_t(), d);
+    return Rational(q);
   }
   return std::optional<Rational>();
 }
@@ -22,6 +22,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 
 #include "util/gmp_util.h"
 #include "util/integer.h"
@@ -37,6 +38,12 @@ namespace cvc5::internal {
  * literature.) A consequence is that that the numerator and denominator may be
  * different than the values used to construct the Rational.
  *
+ * Rationals whose numerator and denominator fit into a signed long are stored
+ * inline, and arithmetic on them is done on machine words, with overflow
+ * checks that fall back to GMP. As for Integer, the representation is
+ * canonical, i.e. a Rational is stored inline iff its canonical numerator and
+ * denominator fit into a signed long.
+ *
  * NOTE: The correct way to create a Rational from an int is to use one of the
  * int numerator/int denominator constructors with the denominator 1.  Trying
  * to construct a Rational with a single int, e.g., Rational(0), will put you
@@ -52,7 +59,21 @@ class Rational
    * Assumes that the value is in canonical form, and thus does not
    * have to call canonicalize() on the value.
    */
-  Rational(const mpq_class& val) : d_value(val) {}
+  Rational(const mpq_class& val)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(val)
+  {
+    normalize();
+  }
+
+  /**
+   * Constructs a Rational by moving a mpq_class object. Assumes that the value
+   * is in canonical form.
+   */
+  Rational(mpq_class&& val)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(std::move(val))
+  {
+    normalize();
+  }
 
   /**
    * Creates a rational from a decimal string (e.g., <code>"1.5"</code>).
@@ -63,7 +84,7 @@ class Rational
   static Rational fromDecimal(const std::string& dec);
 
   /** Constructs a rational with the value 0/1. */
-  Rational() : d_value(0) { d_value.canonicalize(); }
+  Rational() : d_num(0), d_den(1), d_isSmall(true) {}
 
   /**
    * Constructs a Rational from a C string in a given base (defaults to 10).
@@ -72,95 +93,135 @@ class Rational
    * For more information about what is a valid rational string,
    * see GMP's documentation for mpq_set_str().
    */
-  explicit Rational(const char* s, unsigned base = 10) : d_value(s, base)
+  explicit Rational(const char* s, unsigned base = 10)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(s, base)
   {
     d_value.canonicalize();
+    normalize();
   }
-  Rational(const std::string& s, unsigned base = 10) : d_value(s, base)
+  Rational(const std::string& s, unsigned base = 10)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(s, base)
   {
     d_value.canonicalize();
+    normalize();
   }
 
   /**
    * Creates a Rational from another Rational, q, by performing a deep copy.
    */
-  Rational(const Rational& q) : d_value(q.d_value) { d_value.canonicalize(); }
+  Rational(const Rational& q)
+      : d_num(q.d_num), d_den(q.d_den), d_isSmall(q.d_isSmall)
+  {
+    if (!d_isSmall)
+    {
+      d_value = q.d_value;
+    }
+  }
 
   /**
    * Constructs a canonical Rational from a numerator.
    */
-  Rational(signed int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(signed long int n) : d_value(n, 1) { d_value.canonicalize(); }
-  Rational(unsigned long int n) : d_value(n, 1) { d_value.canonicalize(); }
+  Rational(signed int n) : d_num(n), d_den(1), d_isSmall(true) {}
+  Rational(unsigned int n) : d_num(0), d_den(1), d_isSmall(false)
+  {
+    setFraction(n, false, 1);
+  }
+  Rational(signed long int n) : d_num(n), d_den(1), d_isSmall(true) {}
+  Rational(unsigned long int n) : d_num(0), d_den(1), d_isSmall(false)
+  {
+    setFraction(n, false, 1);
+  }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   // to avoid truncation, we convert the input value to an mpz and then build
   // the mpq.
-  Rational(int64_t n) : d_value(construct_mpz(n), 1) { d_value.canonicalize(); }
-  Rational(uint64_t n) : d_value(construct_mpz(n), 1)
+  Rational(int64_t n)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(construct_mpz(n), 1)
   {
     d_value.canonicalize();
+    normalize();
+  }
+  Rational(uint64_t n)
+      : d_num(0), d_den(1), d_isSmall(false), d_value(construct_mpz(n), 1)
+  {
+    d_value.canonicalize();
+    normalize();
   }
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
   /**
    * Constructs a canonical Rational from a numerator and denominator.
    */
-  Rational(signed int n, signed int d) : d_value(n, d)
+  Rational(signed int n, signed int d) : d_num(0), d_den(1), d_isSmall(false)
   {
-    d_value.canonicalize();
+    setFraction(n, d);
   }
-  Rational(unsigned int n, unsigned int d) : d_value(n, d)
+  Rational(unsigned int n, unsigned int d)
+      : d_num(0), d_den(1), d_isSmall(false)
   {
-    d_value.canonicalize();
+    setFraction(n, false, d);
   }
-  Rational(signed long int n, signed long int d) : d_value(n, d)
+  Rational(signed long int n, signed long int d)
+      : d_num(0), d_den(1), d_isSmall(false)
   {
-    d_value.canonicalize();
+    setFraction(n, d);
   }
-  Rational(unsigned long int n, unsigned long int d) : d_value(n, d)
+  Rational(unsigned long int n, unsigned long int d)
+      : d_num(0), d_den(1), d_isSmall(false)
   {
-    d_value.canonicalize();
+    setFraction(n, false, d);
   }
 
 #ifdef CVC5_NEED_INT64_T_OVERLOADS
   // to avoid truncation, we convert the input value to an mpz and then build
   // the mpq.
-  Rational(int64_t n, int64_t d) : d_value(construct_mpz(n), construct_mpz(d))
+  Rational(int64_t n, int64_t d)
+      : d_num(0),
+        d_den(1),
+        d_isSmall(false),
+        d_value(construct_mpz(n), construct_mpz(d))
   {
     d_value.canonicalize();
+    normalize();
   }
-  Rational(uint64_t n, uint64_t d) : d_value(construct_mpz(n), construct_mpz(d))
+  Rational(uint64_t n, uint64_t d)
+      : d_num(0),
+        d_den(1),
+        d_isSmall(false),
+        d_value(construct_mpz(n), construct_mpz(d))
   {
     d_value.canonicalize();
+    normalize();
   }
 #endif /* CVC5_NEED_INT64_T_OVERLOADS */
 
-  Rational(const Integer& n, const Integer& d)
-      : d_value(n.get_mpz(), d.get_mpz())
-  {
-    d_value.canonicalize();
-  }
-  Rational(const Integer& n) : d_value(n.get_mpz()) { d_value.canonicalize(); }
+  Rational(const Integer& n, const Integer& d);
+  Rational(const Integer& n);
   ~Rational() {}
 
   /**
-   * Returns a copy of d_value to enable public access of GMP data.
+   * Returns the value as GMP data, to enable public access of GMP data. See
+   * get_mpq().
    */
-  const mpq_class& getValue() const { return d_value; }
+  const mpq_class& getValue(mpq_class& buf) const { return get_mpq(buf); }
 
   /**
    * Returns the value of numerator of the Rational.
    * Note that this makes a deep copy of the numerator.
    */
-  Integer getNumerator() const { return Integer(d_value.get_num()); }
+  Integer getNumerator() const
+  {
+    return d_isSmall ? Integer(d_num) : Integer(d_value.get_num());
+  }
 
   /**
    * Returns the value of denominator of the Rational.
    * Note that this makes a deep copy of the denominator.
    */
-  Integer getDenominator() const { return Integer(d_value.get_den()); }
+  Integer getDenominator() const
+  {
+    return d_isSmall ? Integer(d_den) : Integer(d_value.get_den());
+  }
 
   static std::optional<Rational> fromDouble(double d);
 
@@ -169,30 +230,30 @@ class Rational
    * approximate: truncation may occur, overflow may result in
    * infinity, and underflow may result in zero.
    */
-  double getDouble() const { return d_value.get_d(); }
+  double getDouble() const;
 
   Rational inverse() const
   {
     return Rational(getDenominator(), getNumerator());
   }
 
-  int cmp(const Rational& x) const
+  int cmp(const Rational& x) const;
+
+  int sgn() const
   {
-    // Don't use mpq_class's cmp() function.
-    // The name ends up conflicting with this function.
-    return mpq_cmp(d_value.get_mpq_t(), x.d_value.get_mpq_t());
+    if (d_isSmall)
+    {
+      return d_num < 0 ? -1 : (d_num > 0 ? 1 : 0);
+    }
+    return mpq_sgn(d_value.get_mpq_t());
   }
 
-  int sgn() const { return mpq_sgn(d_value.get_mpq_t()); }
-
   bool isZero() const { return sgn() == 0; }
 
-  bool isOne() const { return mpq_cmp_si(d_value.get_mpq_t(), 1, 1) == 0; }
+  // the representation is canonical, so these values are stored inline
+  bool isOne() const { return d_isSmall && d_num == 1 && d_den == 1; }
 
-  bool isNegativeOne() const
-  {
-    return mpq_cmp_si(d_value.get_mpq_t(), -1, 1) == 0;
-  }
+  bool isNegativeOne() const { return d_isSmall && d_num == -1 && d_den == 1; }
 
   Rational abs() const
   {
@@ -206,100 +267,58 @@ class Rational
     }
   }
 
-  Integer floor() const
-  {
-    mpz_class q;
-    mpz_fdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
-    return Integer(q);
-  }
+  Integer floor() const;
 
-  Integer ceiling() const
-  {
-    mpz_class q;
-    mpz_cdiv_q(q.get_mpz_t(), d_value.get_num_mpz_t(), d_value.get_den_mpz_t());
-    return Integer(q);
-  }
+  Integer ceiling() const;
 
   Rational floor_frac() const { return (*this) - Rational(floor()); }
 
-  Rational& operator=(const Rational& x)
-  {
-    if (this == &x) return *this;
-    d_value = x.d_value;
-    return *this;
-  }
+  Rational& operator=(const Rational& x);
 
-  Rational operator-() const { return Rational(-(d_value)); }
+  Rational operator-() const;
 
-  bool operator==(const Rational& y) const { return d_value == y.d_value; }
+  bool operator==(const Rational& y) const;
 
-  bool operator!=(const Rational& y) const { return d_value != y.d_value; }
+  bool operator!=(const Rational& y) const { return !(*this == y); }
 
-  bool operator<(const Rational& y) const { return d_value < y.d_value; }
+  bool operator<(const Rational& y) const { return cmp(y) < 0; }
 
-  bool operator<=(const Rational& y) const { return d_value <= y.d_value; }
+  bool operator<=(const Rational& y) const { return cmp(y) <= 0; }
 
-  bool operator>(const Rational& y) const { return d_value > y.d_value; }
+  bool operator>(const Rational& y) const { return cmp(y) > 0; }
 
-  bool operator>=(const Rational& y) const { return d_value >= y.d_value; }
+  bool operator>=(const Rational& y) const { return cmp(y) >= 0; }
 
-  Rational operator+(const Rational& y) const
-  {
-    return Rational(d_value + y.d_value);
-  }
-  Rational operator-(const Rational& y) const
-  {
-    return Rational(d_value - y.d_value);
-  }
+  Rational operator+(const Rational& y) const;
+  Rational operator-(const Rational& y) const;
 
-  Rational operator*(const Rational& y) const
-  {
-    return Rational(d_value * y.d_value);
-  }
-  Rational operator/(const Rational& y) const
-  {
-    return Rational(d_value / y.d_value);
-  }
+  Rational operator*(const Rational& y) const;
+  Rational operator/(const Rational& y) const;
 
-  Rational& operator+=(const Rational& y)
-  {
-    d_value += y.d_value;
-    return (*this);
-  }
-  Rational& operator-=(const Rational& y)
-  {
-    d_value -= y.d_value;
-    return (*this);
-  }
+  Rational& operator+=(const Rational& y) { return *this = *this + y; }
+  Rational& operator-=(const Rational& y) { return *this = *this - y; }
 
-  Rational& operator*=(const Rational& y)
-  {
-    d_value *= y.d_value;
-    return (*this);
-  }
+  Rational& operator*=(const Rational& y) { return *this = *this * y; }
+
+  Rational& operator/=(const Rational& y) { return *this = *this / y; }
 
-  Rational& operator/=(const Rational& y)
+  bool isIntegral() const
   {
-    d_value /= y.d_value;
-    return (*this);
+    if (d_isSmall)
+    {
+      return d_den == 1;
+    }
+    return mpz_cmp_ui(d_value.get_den_mpz_t(), 1) == 0;
   }
 
-  bool isIntegral() const { return mpz_cmp_ui(d_value.get_den_mpz_t(), 1) == 0; }
-
   /** Returns a string representing the rational in the given base. */
-  std::string toString(int base = 10) const { return d_value.get_str(base); }
+  std::string toString(int base = 10) const;
 
   /**
    * Computes the hash of the rational from hashes of the numerator and the
    * denominator.
    */
-  size_t hash() const
-  {
-    size_t numeratorHash = gmpz_hash(d_value.get_num_mpz_t());
-    size_t denominatorHash = gmpz_hash(d_value.get_den_mpz_t());
-
-    return numeratorHash ^ denominatorHash;
-  }
+  size_t hash() const;
 
   uint32_t complexity() const
   {
@@ -313,8 +332,61 @@ class Rational
 
  private:
   /**
-   * Stores the value of the rational is stored in a C++ GMP rational class.
-   * Using this instead of mpq_t allows for easier destruction.
+   * Gets the value as gmp data. Returns a reference to d_value if the value
+   * is not stored inline. Otherwise, the value is written to buf, and a
+   * reference to buf is returned.
+   */
+  const mpq_class& get_mpq(mpq_class& buf) const
+  {
+    if (d_isSmall)
+    {
+      // the inline representation is canonical with a positive denominator
+      mpq_set_si(
+          buf.get_mpq_t(), d_num, static_cast<unsigned long int>(d_den));
+      return buf;
+    }
+    return d_value;
+  }
+
+  /** Use the inline representation if the value of d_value fits into it. */
+  void normalize()
+  {
+    d_isSmall =
+        d_value.get_num().fits_slong_p() && d_value.get_den().fits_slong_p();
+    if (d_isSmall)
+    {
+      d_num = d_value.get_num().get_si();
+      d_den = d_value.get_den().get_si();
+    }
+  }
+
+  /** Set this to the canonical form of n/d, where d is not zero. */
+  void setFraction(signed long int n, signed long int d);
+  /**
+   * Set this to the canonical form of the fraction with numerator absN (which
+   * is negated if neg is true) and denominator absD, which is not zero.
+   */
+  void setFraction(unsigned long int absN, bool neg, unsigned long int absD);
+  /**
+   * Set this to the product of the inline fractions a/b and c/d, where b and
+   * d are positive. Returns false if this overflows, without changing this.
+   */
+  bool setProduct(signed long int a,
+                  signed long int b,
+                  signed long int c,
+                  signed long int d);
+
+  /** The numerator and the (positive) denominator, if d_isSmall is true. */
+  signed long int d_num;
+  signed long int d_den;
+
+  /** Whether the value is stored in d_num and d_den, rather than d_value. */
+  bool d_isSmall;
+
+  /**
+   * Stores the value of the rational in a C++ GMP rational class, if
+   * d_isSmall is false. Using this instead of mpq_t allows for easier
+   * destruction.
    */
   mpq_class d_value;
 
@@ -92,6 +92,14 @@ class HistogramStat
     }
     return *this;
   }
+  /** Add the value `val` to the histogram `count` times */
+  void add(Integral val, uint64_t count)
+  {
+    if constexpr (configuration::isStatisticsBuild())
+    {
+      d_data->add(val, count);
+    }
+  }
   /** Get the current value for key `val` */
   uint64_t getValue(Integral val) { return d_data->getValue(val); }
 
@@ -163,10 +163,10 @@ struct StatisticHistogramValue : StatisticBaseValue
   }
 
   /**
-   * Add `val` to the histogram. Casts `val` to `int64_t`, then resizes and
-   * moves the vector entries as necessary.
+   * Add `val` to the histogram `count` times. Casts `val` to `int64_t`, then
+   * resizes and moves the vector entries as necessary.
    */
-  void add(Integral val)
+  void add(Integral val, uint64_t count = 1)
   {
     int64_t v = static_cast<int64_t>(val);
     if (d_hist.empty())
@@ -182,7 +182,7 @@ struct StatisticHistogramValue : StatisticBaseValue
     {
       d_hist.resize(v - d_offset + 1);
     }
-    d_hist[v - d_offset]++;
+    d_hist[v - d_offset] += count;
   }
   /** Get the value stored for key val */
   uint64_t getValue(Integral val)
@@ -0,0 +1,26 @@
+; COMMAND-LINE: --arith-float-simplex --incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+(declare-fun w () Real)
+
+(assert (<= 0 x 10))
+(assert (<= 0 y 10))
+(assert (< 0 z))
+(assert (>= (+ x y z) 7.5))
+(assert (<= (- (* 3 x) (* 2 y) w) (/ 1 3)))
+(assert (> (+ (* 2 x) (* 5 y) (* 7 z)) 40))
+(assert (< (+ x (* 4 w)) 3))
+
+(push 1)
+(assert (< (+ x y (* 2 z)) 12))
+(check-sat)
+(pop 1)
+
+(assert (<= (+ x y) 1))
+(assert (< z 1))
+(check-sat)
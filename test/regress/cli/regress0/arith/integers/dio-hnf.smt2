@@ -0,0 +1,21 @@
+; COMMAND-LINE: --dio-hnf --incremental
+; COMMAND-LINE: --dio-hnf --dio-decomps --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_LIA)
+
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(declare-fun w () Int)
+
+(assert (= (+ x y) (+ (* 2 z) 1)))
+(check-sat)
+(push 1)
+; x + y is odd, so x - y is odd as well
+(assert (= (- x y) (* 2 w)))
+(check-sat)
+(pop 1)
+(assert (= (- x y) (+ (* 2 w) 3)))
+(check-sat)
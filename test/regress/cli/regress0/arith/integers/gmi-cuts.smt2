@@ -0,0 +1,15 @@
+; COMMAND-LINE: --gmi-cuts --incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+
+(declare-fun x () Int)
+(declare-fun y () Int)
+
+(assert (and (<= 0 x) (<= x 10) (<= 0 y) (<= y 10)))
+(assert (<= 40 (+ (* 7 x) (* 11 y))))
+(assert (<= (+ (* 7 x) (* 11 y)) 40))
+(check-sat)
+; the only solution is x = 1, y = 3
+(assert (<= y 2))
+(check-sat)
@@ -0,0 +1,15 @@
+; COMMAND-LINE: --parallel-bab --parallel-bab-threads=2 --incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+
+(assert (and (<= 0 x) (<= x 10) (<= 0 y) (<= y 10) (<= 0 z) (<= z 10)))
+(assert (= (+ (* 7 x) (* 11 y) (* 13 z)) 53))
+(check-sat)
+; the solutions are (x, y, z) = (1, 3, 1), (2, 0, 3) and (6, 1, 0)
+(assert (>= (+ y z) 5))
+(check-sat)
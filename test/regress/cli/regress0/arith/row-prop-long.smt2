@@ -0,0 +1,54 @@
+; COMMAND-LINE: --arith-prop=bi --incremental
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LRA)
+
+(declare-fun x1 () Real)
+(declare-fun x2 () Real)
+(declare-fun x3 () Real)
+(declare-fun x4 () Real)
+(declare-fun x5 () Real)
+(declare-fun x6 () Real)
+(declare-fun x7 () Real)
+(declare-fun x8 () Real)
+(declare-fun x9 () Real)
+(declare-fun x10 () Real)
+(declare-fun x11 () Real)
+(declare-fun x12 () Real)
+(declare-fun x13 () Real)
+(declare-fun x14 () Real)
+(declare-fun x15 () Real)
+(declare-fun x16 () Real)
+(declare-fun x17 () Real)
+(declare-fun x18 () Real)
+(declare-fun x19 () Real)
+(declare-fun x20 () Real)
+(declare-fun y () Real)
+
+(assert (and (<= 0 x1) (<= x1 1)))
+(assert (and (<= 0 x2) (<= x2 1)))
+(assert (and (<= 0 x3) (<= x3 1)))
+(assert (and (<= 0 x4) (<= x4 1)))
+(assert (and (<= 0 x5) (<= x5 1)))
+(assert (and (<= 0 x6) (<= x6 1)))
+(assert (and (<= 0 x7) (<= x7 1)))
+(assert (and (<= 0 x8) (<= x8 1)))
+(assert (and (<= 0 x9) (<= x9 1)))
+(assert (and (<= 0 x10) (<= x10 1)))
+(assert (and (<= 0 x11) (<= x11 1)))
+(assert (and (<= 0 x12) (<= x12 1)))
+(assert (and (<= 0 x13) (<= x13 1)))
+(assert (and (<= 0 x14) (<= x14 1)))
+(assert (and (<= 0 x15) (<= x15 1)))
+(assert (and (<= 0 x16) (<= x16 1)))
+(assert (and (<= 0 x17) (<= x17 1)))
+(assert (and (<= 0 x18) (<= x18 1)))
+(assert (and (<= 0 x19) (<= x19 1)))
+(assert (and (<= 0 x20) (<= x20 1)))
+(assert (>= (+ x1 x2 x3 x4 x5 x6 x7 x8 x9 x10 x11 x12 x13 x14 x15 x16 x17 x18 x19 x20) 19))
+(assert (or (< x7 1) (> y 3)))
+(check-sat)
+(assert (< y 2))
+; the row of the sum is longer than --prop-row-length, and implies x7 >= 1
+(assert (>= (+ x1 x2 x3 x4 x5 x6 x7 x8 x9 x10 x11 x12 x13 x14 x15 x16 x17 x18 x19 x20) 20))
+(check-sat)
@@ -0,0 +1,37 @@
+; COMMAND-LINE: --arith-warm-start --incremental
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+(set-logic QF_LRA)
+
+(declare-fun x () Real)
+(declare-fun y () Real)
+(declare-fun z () Real)
+
+(assert (<= (+ x y z) 10))
+(assert (>= (- x y) 2))
+(assert (>= (+ y (* 2 z)) 3))
+
+(push 1)
+(assert (>= x 7))
+(check-sat)
+(pop 1)
+
+(push 1)
+(assert (>= x 7))
+(assert (>= z 4))
+(assert (>= y 0))
+(check-sat)
+(pop 1)
+
+(push 1)
+(assert (>= x 7))
+(assert (>= z 1))
+(check-sat)
+(pop 1)
+
+(push 1)
+(assert (>= x 7))
+(check-sat)
+(pop 1)
@@ -0,0 +1,19 @@
+; COMMAND-LINE: --decision=justification-activity
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(set-option :incremental true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (or (> x (+ y 2)) (< x (- y 2)) (= z (+ x y))))
+(assert (ite (> z 0) (< x 5) (> y 5)))
+(assert (xor (>= x 0) (>= y 0)))
+(check-sat)
+(push 1)
+(assert (and (<= 0 x 10) (<= 0 z 10)))
+(check-sat)
+(pop 1)
+(assert (and (>= x 0) (>= y 0) (>= z 0)))
+(check-sat)
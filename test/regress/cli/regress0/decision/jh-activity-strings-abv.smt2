@@ -0,0 +1,11 @@
+; COMMAND-LINE: --decision=justification-activity
+; EXPECT: sat
+(set-logic ALL)
+(declare-fun s () String)
+(declare-fun t () String)
+(declare-fun a () (Array (_ BitVec 4) (_ BitVec 4)))
+(declare-fun i () (_ BitVec 4))
+(assert (or (= (str.++ s "ab") (str.++ "ba" t)) (str.contains s "ccc")))
+(assert (ite (= (str.len s) 3) (= (select a i) #b0001) (= (select a (bvadd i #b0001)) #b0010)))
+(assert (or (not (= (select a i) #b0001)) (bvult i #b0100)))
+(check-sat)
@@ -0,0 +1,24 @@
+; COMMAND-LINE: --incremental --conflict-process=min
+; COMMAND-LINE: --incremental --conflict-process=min --conflict-process-cache=1
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_NIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(push 1)
+(assert (= x 0))
+(assert (or (> (* x y) 0) (> (* x z) 0)))
+(check-sat)
+(pop 1)
+; lemmas cached in the popped context must not be reused at the same level
+(push 1)
+(assert (or (> (* x y) 0) (> (* x z) 0)))
+(check-sat)
+(pop 1)
+(assert (> (* x y) 0))
+(check-sat)
+(assert (or (= x 0) (= y 0)))
+(check-sat)
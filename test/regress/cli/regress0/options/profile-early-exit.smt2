@@ -0,0 +1,10 @@
+; DISABLE-TESTER: dump
+; COMMAND-LINE: --early-exit --profile=profile-early-exit.folded
+; SCRUBBER: test -f profile-early-exit.folded && rm profile-early-exit.folded && cat
+; EXPECT: sat
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (> x (+ y 3)))
+(assert (<= 0 x 10))
+(check-sat)
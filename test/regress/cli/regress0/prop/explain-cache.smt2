@@ -0,0 +1,30 @@
+; COMMAND-LINE: -i --explain-cache
+; COMMAND-LINE: -i --explain-cache --explain-cache-limit=1
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun a () Int)
+(declare-fun b () Int)
+(declare-fun c () Int)
+(declare-fun p () Bool)
+(assert (or (= a b) (= a c)))
+(assert (or p (= (f a) (f b))))
+(assert (=> (= b c) (> (f a) 0)))
+(push 1)
+(assert (= b c))
+(assert (or (not p) (< (f c) 0)))
+; EXPECT: sat
+(check-sat)
+(assert (= (f b) (f c)))
+(assert (< (f b) 0))
+; EXPECT: unsat
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not (= a b)))
+(assert (= (f a) 5))
+(assert (= (f c) 6))
+; EXPECT: unsat
+(check-sat)
+(pop 1)
+; EXPECT: sat
+(check-sat)
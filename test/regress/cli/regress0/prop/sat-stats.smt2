@@ -0,0 +1,14 @@
+; COMMAND-LINE: --sat-stats-interval=1 --sat-solver=minisat
+; COMMAND-LINE: --sat-stats-interval=1 --sat-solver=cadical
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_LIA)
+(set-option :incremental true)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (or (> x (+ y 3)) (< x (- y 2))))
+(assert (<= 0 x 10))
+(assert (<= 0 y 10))
+(check-sat)
+(assert (= x y))
+(check-sat)
@@ -0,0 +1,18 @@
+; COMMAND-LINE: --sat-solver=cadical --sat-xor --bv-solver=bitblast-internal
+; COMMAND-LINE: --sat-solver=cadical --sat-xor --sat-xor-max-component=8 --bv-solver=bitblast-internal
+; COMMAND-LINE: --sat-solver=cadical --bv-solver=bitblast-internal
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(declare-fun z () (_ BitVec 16))
+(define-fun parity ((v (_ BitVec 16))) Bool
+  (xor ((_ bit2bool 0) v) ((_ bit2bool 1) v) ((_ bit2bool 2) v) ((_ bit2bool 3) v)
+       ((_ bit2bool 4) v) ((_ bit2bool 5) v) ((_ bit2bool 6) v) ((_ bit2bool 7) v)
+       ((_ bit2bool 8) v) ((_ bit2bool 9) v) ((_ bit2bool 10) v) ((_ bit2bool 11) v)
+       ((_ bit2bool 12) v) ((_ bit2bool 13) v) ((_ bit2bool 14) v) ((_ bit2bool 15) v)))
+(assert (= z (bvxor x y)))
+(assert (parity x))
+(assert (parity y))
+(assert (parity z))
+; EXPECT: unsat
+(check-sat)
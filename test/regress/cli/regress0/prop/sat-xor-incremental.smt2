@@ -0,0 +1,30 @@
+; COMMAND-LINE: --incremental --sat-solver=cadical --sat-xor
+(set-logic QF_UF)
+(declare-fun a () Bool)
+(declare-fun b () Bool)
+(declare-fun c () Bool)
+(declare-fun d () Bool)
+(assert (xor a (xor b c)))
+(push 1)
+(assert (not (xor c (xor d a))))
+(assert (= b d))
+; EXPECT: unsat
+(check-sat)
+(pop 1)
+(push 1)
+(assert (xor b (xor c d)))
+; EXPECT: sat
+(check-sat)
+(assert (not a))
+(assert (not b))
+(assert (not d))
+; EXPECT: sat
+(check-sat)
+(pop 1)
+(assert (not a))
+(assert (not b))
+; EXPECT: sat
+(check-sat)
+(assert (not c))
+; EXPECT: unsat
+(check-sat)
@@ -0,0 +1,26 @@
+; COMMAND-LINE: --incremental
+; EXPECT: unsat
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+(set-logic QF_UFLIA)
+(declare-fun f (Int) Int)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun z () Int)
+(assert (<= 0 x 1))
+(assert (<= 0 y 1))
+(assert (<= 0 z 1))
+(push 1)
+; two of x, y and z are equal, which the care graph of arithmetic must find
+(assert (distinct (f x) (f y) (f z)))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (distinct (f x) (f y)))
+(check-sat)
+(pop 1)
+(assert (= x y))
+(check-sat)
+(assert (distinct (f y) (f z) (f (- 1 x))))
+(check-sat)
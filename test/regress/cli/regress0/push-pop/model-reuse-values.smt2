@@ -0,0 +1,32 @@
+; COMMAND-LINE: --incremental --produce-models --check-models
+; EXPECT: sat
+; EXPECT: ((x (as @U_0 U)))
+; EXPECT: sat
+; EXPECT: ((x (as @U_0 U)) (y (as @U_1 U)))
+; EXPECT: sat
+; EXPECT: ((x (as @U_0 U)) (y (as @U_1 U)) (z (as @U_2 U)))
+; EXPECT: sat
+; EXPECT: ((x (as @U_0 U)) (y (as @U_1 U)))
+(set-logic QF_UFLIA)
+(declare-sort U 0)
+(declare-fun x () U)
+(declare-fun y () U)
+(declare-fun z () U)
+(declare-fun f (U) Int)
+(assert (> (f x) 0))
+(check-sat)
+(get-value (x))
+; x keeps its value, although y may be enumerated first
+(assert (distinct x y))
+(check-sat)
+(get-value (x y))
+(push 1)
+; the previous value of x or y must not be reused for z
+(assert (distinct x z))
+(assert (distinct y z))
+(check-sat)
+(get-value (x y z))
+(pop 1)
+(assert (= (f y) (+ (f x) 1)))
+(check-sat)
+(get-value (x y))
@@ -0,0 +1,22 @@
+; COMMAND-LINE: --incremental --relevance-filter
+; EXPECT: sat
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_SLIA)
+(declare-fun x () String)
+(declare-fun y () String)
+(declare-fun n () Int)
+(assert (or (= x "ab") (= x y)))
+(assert (= n (str.len y)))
+(check-sat)
+(push 1)
+(assert (or (> n 3) (str.prefixof "a" y)))
+(check-sat)
+(assert (not (= x "ab")))
+(assert (= (str.len x) 2))
+(assert (< n 2))
+(check-sat)
+(pop 1)
+(assert (> (str.len x) 1))
+(check-sat)
@@ -0,0 +1,25 @@
+; COMMAND-LINE: --incremental --sat-retain-learned-size=8
+; COMMAND-LINE: --incremental --sat-retain-learned-size=8 --produce-learned-clauses
+(set-logic QF_UFLIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun f (Int) Int)
+(declare-fun a () Bool)
+(assert (or (> x 0) (> y 0)))
+(assert (<= (+ x y) 0))
+(assert (or (= (f x) 1) (= (f y) 1)))
+(push 1)
+(assert a)
+(assert (=> a (< (f x) 0)))
+; EXPECT: sat
+(check-sat)
+(pop 1)
+(push 1)
+(assert (not a))
+(assert (= x y))
+; EXPECT: unsat
+(check-sat)
+(pop 1)
+(assert (= (f x) 2))
+; EXPECT: sat
+(check-sat)
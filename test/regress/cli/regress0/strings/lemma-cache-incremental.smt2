@@ -0,0 +1,20 @@
+; COMMAND-LINE: --lemma-cache
+; EXPECT: sat
+; EXPECT: unsat
+; EXPECT: sat
+(set-logic QF_SLIA)
+(set-option :incremental true)
+(declare-fun x () String)
+(declare-fun y () String)
+(declare-fun n () Int)
+(assert (= (str.len (str.++ x y)) n))
+(assert (or (= x "ab") (= y "abc") (> n 10)))
+(check-sat)
+(push 1)
+(assert (< n 3))
+(assert (> (str.len x) 1))
+(assert (> (str.len y) 1))
+(check-sat)
+(pop 1)
+(assert (str.prefixof "a" y))
+(check-sat)
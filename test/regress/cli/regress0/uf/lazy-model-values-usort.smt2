@@ -0,0 +1,16 @@
+; COMMAND-LINE: --lazy-model-values
+; COMMAND-LINE: --lazy-model-values --check-models
+; EXPECT: sat
+; EXPECT: (((= x y) false) ((= (h x) (h z)) true) ((= (h y) x) true))
+(set-logic QF_UF)
+(set-option :produce-models true)
+(declare-sort U 0)
+(declare-fun x () U)
+(declare-fun y () U)
+(declare-fun z () U)
+(declare-fun h (U) U)
+(assert (not (= x y)))
+(assert (= x z))
+(assert (= (h y) z))
+(check-sat)
+(get-value ((= x y) (= (h x) (h z)) (= (h y) x)))
@@ -0,0 +1,16 @@
+; COMMAND-LINE: --lazy-model-values
+; COMMAND-LINE: --lazy-model-values --check-models
+; EXPECT: sat
+; EXPECT: (((f a) 5))
+; EXPECT: (((= (f a) (g (f 0))) true))
+(set-logic QF_UFLIA)
+(set-option :produce-models true)
+(declare-fun a () Int)
+(declare-fun f (Int) Int)
+(declare-fun g (Int) Int)
+(assert (= (f 0) 5))
+(assert (= a 0))
+(assert (= (g 5) 5))
+(check-sat)
+(get-value ((f a)))
+(get-value ((= (f a) (g (f 0)))))
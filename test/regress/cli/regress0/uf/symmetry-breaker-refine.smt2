@@ -0,0 +1,17 @@
+; COMMAND-LINE: --symmetry-breaker-refine
+; EXPECT: unsat
+(set-logic QF_UF)
+(declare-sort U 0)
+(declare-const h1 U)
+(declare-const h2 U)
+(declare-const h3 U)
+(declare-const p1 U)
+(declare-const p2 U)
+(declare-const p3 U)
+(declare-const p4 U)
+(assert (or (= p1 h1) (= p1 h2) (= p1 h3)))
+(assert (or (= p2 h1) (= p2 h2) (= p2 h3)))
+(assert (or (= p3 h1) (= p3 h2) (= p3 h3)))
+(assert (or (= p4 h1) (= p4 h2) (= p4 h3)))
+(assert (distinct p1 p2 p3 p4))
+(check-sat)
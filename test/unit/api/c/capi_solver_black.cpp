@@ -1796,6 +1796,25 @@ TEST_F(TestCApiBlackSolver, get_learned_literals2)
   (void)cvc5_get_learned_literals(d_solver, CVC5_LEARNED_LIT_TYPE_INPUT, &size);
 }
 
+TEST_F(TestCApiBlackSolver, get_learned_clauses)
+{
+  size_t size;
+  ASSERT_DEATH(cvc5_get_learned_clauses(d_solver, &size),
+               "cannot get learned clauses");
+  cvc5_set_option(d_solver, "produce-learned-clauses", "true");
+  // cannot ask before a check sat
+  ASSERT_DEATH(cvc5_get_learned_clauses(d_solver, &size),
+               "cannot get learned clauses");
+
+  cvc5_check_sat(d_solver);
+  (void)cvc5_get_learned_clauses(d_solver, &size);
+
+  ASSERT_DEATH(cvc5_get_learned_clauses(nullptr, &size),
+               "unexpected NULL argument");
+  ASSERT_DEATH(cvc5_get_learned_clauses(d_solver, nullptr),
+               "unexpected NULL argument");
+}
+
 TEST_F(TestCApiBlackSolver, get_value1)
 {
   cvc5_set_option(d_solver, "produce-models", "false");
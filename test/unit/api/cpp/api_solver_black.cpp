@@ -1336,6 +1336,44 @@ TEST_F(TestApiBlackSolver, getLearnedLiterals2)
   ASSERT_NO_THROW(d_solver->getLearnedLiterals());
 }
 
+TEST_F(TestApiBlackSolver, getLearnedClauses)
+{
+  // not enabled
+  ASSERT_THROW(d_solver->getLearnedClauses(), CVC5ApiException);
+  d_solver->setOption("produce-learned-clauses", "true");
+  // cannot ask before a check sat
+  ASSERT_THROW(d_solver->getLearnedClauses(), CVC5ApiException);
+  d_solver->checkSat();
+  ASSERT_NO_THROW(d_solver->getLearnedClauses());
+}
+
+TEST_F(TestApiBlackSolver, getLearnedClauses2)
+{
+  d_solver->setOption("produce-learned-clauses", "true");
+  d_solver->setOption("incremental", "true");
+  Term x = d_tm.mkConst(d_int, "x");
+  Term y = d_tm.mkConst(d_int, "y");
+  Term zero = d_tm.mkInteger(0);
+  Term f0 = d_tm.mkTerm(
+      Kind::OR,
+      {d_tm.mkTerm(Kind::GT, {x, zero}), d_tm.mkTerm(Kind::GT, {y, zero})});
+  Term f1 = d_tm.mkTerm(Kind::LEQ, {d_tm.mkTerm(Kind::ADD, {x, y}), zero});
+  d_solver->assertFormula(f0);
+  d_solver->assertFormula(f1);
+  d_solver->checkSat();
+  std::vector<Term> cls = d_solver->getLearnedClauses();
+  // learned clauses are entailed by the assertions
+  Solver slv(d_tm);
+  slv.assertFormula(f0);
+  slv.assertFormula(f1);
+  for (const Term& cl : cls)
+  {
+    ASSERT_EQ(cl.getSort(), d_tm.getBooleanSort());
+    ASSERT_NO_THROW(slv.assertFormula(cl));
+  }
+  ASSERT_TRUE(slv.checkSat().isSat());
+}
+
 TEST_F(TestApiBlackSolver, getTimeoutCore)
 {
   d_solver->setOption("timeout-core-timeout", "100");
@@ -1089,6 +1089,17 @@ class SolverTest
     assertDoesNotThrow(() -> d_solver.getLearnedLiterals(LearnedLitType.INPUT));
   }
 
+  @Test
+  void getLearnedClauses()
+  {
+    assertThrows(CVC5ApiException.class, () -> d_solver.getLearnedClauses());
+    d_solver.setOption("produce-learned-clauses", "true");
+    // cannot ask before a check sat
+    assertThrows(CVC5ApiException.class, () -> d_solver.getLearnedClauses());
+    d_solver.checkSat();
+    assertDoesNotThrow(() -> d_solver.getLearnedClauses());
+  }
+
   @Test
   void getTimeoutCoreUnsat() throws CVC5ApiException
   {
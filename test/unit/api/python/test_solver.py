@@ -674,6 +674,15 @@ def test_learned_literals2(tm, solver):
     solver.checkSat()
     solver.getLearnedLiterals(LearnedLitType.INPUT)
 
+def test_learned_clauses(solver):
+    with pytest.raises(RuntimeError):
+        solver.getLearnedClauses()
+    solver.setOption("produce-learned-clauses", "true")
+    with pytest.raises(RuntimeError):
+        solver.getLearnedClauses()
+    solver.checkSat()
+    solver.getLearnedClauses()
+
 def test_get_timeout_core_unsat(tm, solver):
   solver.setOption("timeout-core-timeout", "100")
   solver.setOption("produce-unsat-cores", "true")
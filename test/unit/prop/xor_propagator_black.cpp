@@ -0,0 +1,172 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::prop::XorPropagator.
+ */
+
+#include "prop/xor_propagator.h"
+#include "test.h"
+#include "util/statistics_registry.h"
+
+namespace cvc5::internal {
+
+using namespace prop;
+
+namespace test {
+
+class TestPropBlackXorPropagator : public TestInternal
+{
+ protected:
+  void SetUp() override
+  {
+    d_reg.reset(new StatisticsRegistry(false, false, false));
+    d_xor.reset(new XorPropagator(*d_reg));
+  }
+  /** Assign lit and propagate, returns the propagated literals. */
+  bool assignAndPropagate(SatLiteral lit,
+                          std::vector<SatLiteral>& props,
+                          SatClause& conflict)
+  {
+    d_xor->assign(lit);
+    return d_xor->propagate(props, conflict);
+  }
+  std::unique_ptr<StatisticsRegistry> d_reg;
+  std::unique_ptr<XorPropagator> d_xor;
+};
+
+TEST_F(TestPropBlackXorPropagator, propagate)
+{
+  // 1 ^ 2 ^ 3 = 1
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(2), SatLiteral(3)},
+                            true,
+                            0));
+  ASSERT_TRUE(d_xor->isXorVar(2));
+  ASSERT_FALSE(d_xor->isXorVar(4));
+  std::vector<SatLiteral> props;
+  SatClause conflict;
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(1), props, conflict));
+  ASSERT_TRUE(props.empty());
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(2, true), props, conflict));
+  ASSERT_EQ(props.size(), 1);
+  // 3 = 1 ^ 1 ^ 0 = 0
+  ASSERT_EQ(props[0], SatLiteral(3, true));
+  SatClause reason;
+  d_xor->explain(props[0], reason);
+  ASSERT_EQ(reason.size(), 3);
+  ASSERT_EQ(reason[0], SatLiteral(3, true));
+}
+
+TEST_F(TestPropBlackXorPropagator, gauss_jordan)
+{
+  // 1 ^ 2 ^ 3 = 0 and 2 ^ 3 ^ 4 = 1 imply 1 ^ 4 = 1
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(2), SatLiteral(3)},
+                            false,
+                            0));
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(2), SatLiteral(3), SatLiteral(4)},
+                            true,
+                            0));
+  std::vector<SatLiteral> props;
+  SatClause conflict;
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(1), props, conflict));
+  ASSERT_EQ(props.size(), 1);
+  ASSERT_EQ(props[0], SatLiteral(4, true));
+  // assigning 4 inconsistently is a conflict
+  props.clear();
+  ASSERT_FALSE(assignAndPropagate(SatLiteral(4), props, conflict));
+  ASSERT_EQ(conflict.size(), 2);
+  // after backtracking, the propagation is found again
+  d_xor->unassign(4);
+  d_xor->unassign(1);
+  d_xor->notifyBacktrack();
+  props.clear();
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(4, true), props, conflict));
+  ASSERT_EQ(props.size(), 1);
+  ASSERT_EQ(props[0], SatLiteral(1));
+}
+
+TEST_F(TestPropBlackXorPropagator, watches)
+{
+  // 1 ^ 2 ^ 3 ^ 4 = 0
+  ASSERT_TRUE(d_xor->addXor(
+      {SatLiteral(1), SatLiteral(2), SatLiteral(3), SatLiteral(4)}, false, 0));
+  std::vector<SatLiteral> props;
+  SatClause conflict;
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(1), props, conflict));
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(2), props, conflict));
+  ASSERT_TRUE(props.empty());
+  // after backtracking, assigning the remaining columns in another order
+  // still propagates the last one
+  d_xor->unassign(2);
+  d_xor->notifyBacktrack();
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(3), props, conflict));
+  ASSERT_TRUE(props.empty());
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(4, true), props, conflict));
+  ASSERT_EQ(props.size(), 1);
+  ASSERT_EQ(props[0], SatLiteral(2, true));
+}
+
+TEST_F(TestPropBlackXorPropagator, components)
+{
+  // two independent components, 1 ^ 2 = 1 and 3 ^ 4 = 0
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(2)}, true, 0));
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(3), SatLiteral(4)}, false, 0));
+  // 2 ^ 3 = 0 merges them, hence 1 ^ 4 = 1
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(2), SatLiteral(3)}, false, 0));
+  ASSERT_FALSE(d_xor->addXor({SatLiteral(1), SatLiteral(4)}, false, 0));
+  std::vector<SatLiteral> props;
+  SatClause conflict;
+  ASSERT_TRUE(assignAndPropagate(SatLiteral(4), props, conflict));
+  ASSERT_EQ(props.size(), 3);
+  ASSERT_NE(std::find(props.begin(), props.end(), SatLiteral(1, true)),
+            props.end());
+  // rebuilding after a pop keeps the merged component
+  d_xor->userPop(0);
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(4)}, true, 1));
+}
+
+TEST_F(TestPropBlackXorPropagator, max_component_size)
+{
+  d_xor.reset(new XorPropagator(*d_reg, 4));
+  ASSERT_TRUE(d_xor->canAddXor({SatLiteral(1), SatLiteral(2), SatLiteral(3)}));
+  ASSERT_TRUE(d_xor->addXor(
+      {SatLiteral(1), SatLiteral(2), SatLiteral(3)}, false, 0));
+  ASSERT_TRUE(d_xor->canAddXor({SatLiteral(3), SatLiteral(4)}));
+  ASSERT_FALSE(
+      d_xor->canAddXor({SatLiteral(3), SatLiteral(4), SatLiteral(5)}));
+  // a separate component has its own bound
+  ASSERT_TRUE(d_xor->canAddXor({SatLiteral(4), SatLiteral(5)}));
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(4), SatLiteral(5)}, false, 0));
+  // but merging both exceeds it
+  ASSERT_FALSE(d_xor->canAddXor({SatLiteral(1), SatLiteral(5)}));
+}
+
+TEST_F(TestPropBlackXorPropagator, inconsistent)
+{
+  // negated literals are moved to the right-hand side
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(2, true)}, false, 0));
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(2), SatLiteral(3)}, false, 1));
+  ASSERT_FALSE(d_xor->addXor({SatLiteral(1), SatLiteral(3)}, false, 1));
+  // popping the user level removes the constraints of level 1
+  d_xor->userPop(0);
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(3)}, false, 1));
+}
+
+TEST_F(TestPropBlackXorPropagator, check)
+{
+  ASSERT_TRUE(d_xor->addXor({SatLiteral(1), SatLiteral(2)}, true, 0));
+  SatClause conflict;
+  ASSERT_TRUE(d_xor->check([](SatVariable var) { return var == 1; },
+                           conflict));
+  ASSERT_FALSE(d_xor->check([](SatVariable var) { return true; }, conflict));
+  ASSERT_EQ(conflict.size(), 2);
+  ASSERT_EQ(conflict[0], SatLiteral(1, true));
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
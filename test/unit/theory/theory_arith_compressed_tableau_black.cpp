@@ -0,0 +1,302 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::theory::arith::linear::CompressedTableau.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/compressed_tableau.h"
+#include "theory/arith/linear/tableau.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+class TestTheoryBlackArithCompressedTableau : public TestInternal
+{
+ protected:
+  using Dense = std::vector<std::vector<double>>;
+
+  /** Pivots the dense tableau t in the same way as CompressedTableau. */
+  static void densePivot(Dense& t, size_t row, size_t col, size_t leaving)
+  {
+    std::vector<double>& r = t[row];
+    double a = r[col];
+    for (double& c : r)
+    {
+      c = -c / a;
+    }
+    r[col] = 0.0;
+    r[leaving] = 1.0 / a;
+    for (size_t i = 0; i < t.size(); i++)
+    {
+      double mult = t[i][col];
+      if (i == row || mult == 0.0)
+      {
+        continue;
+      }
+      for (size_t c = 0; c < r.size(); c++)
+      {
+        t[i][c] += mult * r[c];
+      }
+      t[i][col] = 0.0;
+    }
+  }
+
+  /** Checks that the compressed tableau ct matches t. */
+  static void assertMatches(const CompressedTableau& ct, const Dense& t)
+  {
+    size_t entries = 0;
+    for (size_t c = 0; c < ct.getNumColumns(); c++)
+    {
+      size_t occurrences = 0;
+      for (size_t i = 0; i < ct.getNumRows(); i++)
+      {
+        double expected = t[i][c];
+        ASSERT_NEAR(ct.getCoefficient(i, c), expected, 1e-6);
+        if (ct.getCoefficient(i, c) != 0.0)
+        {
+          occurrences++;
+        }
+      }
+      // the occurrence lists are exact
+      ASSERT_EQ(ct.getColumn(c).size(), occurrences);
+      for (const CompressedTableau::ColumnEntry& e : ct.getColumn(c))
+      {
+        ASSERT_EQ(ct.getCoefficient(e), ct.getCoefficient(e.d_row, c));
+      }
+      entries += occurrences;
+    }
+    ASSERT_EQ(ct.getNumEntries(), entries);
+  }
+
+  /** Checks that the compressed tableau ct matches the exact tableau t. */
+  static void assertMatches(const CompressedTableau& ct,
+                            const Tableau& t,
+                            const std::vector<ArithVar>& basic)
+  {
+    for (size_t i = 0; i < basic.size(); i++)
+    {
+      size_t length = 0;
+      for (Tableau::RowIterator ri = t.basicRowIterator(basic[i]);
+           !ri.atEnd();
+           ++ri)
+      {
+        const Tableau::Entry& e = *ri;
+        if (e.getColVar() != basic[i])
+        {
+          ASSERT_NEAR(ct.getCoefficient(i, e.getColVar()),
+                      e.getCoefficient().getDouble(),
+                      1e-9);
+          length++;
+        }
+      }
+      ASSERT_EQ(ct.getRowLength(i), length);
+    }
+    for (size_t c = 0; c < ct.getNumColumns(); c++)
+    {
+      ASSERT_EQ(ct.getColumn(c).size(),
+                t.isBasic(c) ? 0 : t.getColLength(c));
+      for (const CompressedTableau::ColumnEntry& e : ct.getColumn(c))
+      {
+        ASSERT_EQ(ct.getCoefficient(e), ct.getCoefficient(e.d_row, c));
+      }
+    }
+  }
+
+  /**
+   * Replays a tableau and its pivots in the format traced by FloatSimplex
+   * with -t arith::float-tableau. The pivots are done on the exact tableau
+   * and on the compressed tableau, which are checked to agree after each
+   * pivot. The time spent pivoting is recorded as test properties.
+   */
+  void replay(const std::string& recording)
+  {
+    Tableau t;
+    CompressedTableau ct;
+    std::vector<ArithVar> basic;
+    NoEffectCCCB cb;
+    int64_t exactTime = 0;
+    int64_t floatTime = 0;
+    std::istringstream in(recording);
+    std::string line;
+    while (std::getline(in, line))
+    {
+      std::istringstream ls(line);
+      std::string kind;
+      ls >> kind;
+      if (kind == "tableau")
+      {
+        size_t numCols;
+        ls >> numCols;
+        t.increaseSizeTo(numCols);
+        ct.reset(numCols);
+      }
+      else if (kind == "row")
+      {
+        ArithVar b;
+        ls >> b;
+        std::vector<Rational> coeffs;
+        std::vector<ArithVar> vars;
+        std::vector<std::pair<uint32_t, double>> entries;
+        std::string entry;
+        while (ls >> entry)
+        {
+          size_t sep = entry.find(':');
+          ArithVar v = std::stoul(entry.substr(0, sep));
+          Rational coeff(entry.substr(sep + 1));
+          vars.push_back(v);
+          coeffs.push_back(coeff);
+          entries.emplace_back(v, coeff.getDouble());
+        }
+        t.addRow(b, coeffs, vars);
+        ASSERT_EQ(ct.addRow(entries), basic.size());
+        basic.push_back(b);
+        assertMatches(ct, t, basic);
+      }
+      else
+      {
+        ASSERT_EQ(kind, "pivot");
+        size_t row, col;
+        ls >> row >> col;
+        ASSERT_LT(row, basic.size());
+        auto start = std::chrono::steady_clock::now();
+        t.pivot(basic[row], col, cb);
+        auto mid = std::chrono::steady_clock::now();
+        ct.pivot(row, col, basic[row]);
+        auto end = std::chrono::steady_clock::now();
+        exactTime += std::chrono::duration_cast<std::chrono::microseconds>(
+                         mid - start)
+                         .count();
+        floatTime +=
+            std::chrono::duration_cast<std::chrono::microseconds>(end - mid)
+                .count();
+        basic[row] = col;
+        assertMatches(ct, t, basic);
+      }
+    }
+    RecordProperty("exact_us", std::to_string(exactTime));
+    RecordProperty("float_us", std::to_string(floatTime));
+  }
+};
+
+TEST_F(TestTheoryBlackArithCompressedTableau, pivot)
+{
+  // rows 0..m-1 have basic columns n..n+m-1
+  const size_t n = 12;
+  const size_t m = 8;
+  std::mt19937 rng(42);
+  for (size_t round = 0; round < 20; round++)
+  {
+    CompressedTableau ct;
+    ct.reset(n + m);
+    Dense t(m, std::vector<double>(n + m, 0.0));
+    std::vector<size_t> basic;
+    std::vector<bool> isBasic(n + m, false);
+    for (size_t i = 0; i < m; i++)
+    {
+      std::vector<std::pair<uint32_t, double>> entries;
+      for (size_t c = 0; c < n; c++)
+      {
+        if (rng() % 4 == 0)
+        {
+          double coeff = static_cast<double>(rng() % 9) - 4.0;
+          if (coeff != 0.0)
+          {
+            entries.emplace_back(c, coeff);
+            t[i][c] = coeff;
+          }
+        }
+      }
+      ASSERT_EQ(ct.addRow(entries), i);
+      basic.push_back(n + i);
+      isBasic[n + i] = true;
+    }
+    assertMatches(ct, t);
+    for (size_t step = 0; step < 10; step++)
+    {
+      size_t row = rng() % m;
+      std::vector<size_t> candidates;
+      for (size_t c = 0; c < n + m; c++)
+      {
+        if (!isBasic[c] && std::fabs(t[row][c]) > 1e-3)
+        {
+          candidates.push_back(c);
+        }
+      }
+      if (candidates.empty())
+      {
+        continue;
+      }
+      size_t col = candidates[rng() % candidates.size()];
+      size_t leaving = basic[row];
+      ct.pivot(row, col, leaving);
+      densePivot(t, row, col, leaving);
+      basic[row] = col;
+      isBasic[col] = true;
+      isBasic[leaving] = false;
+      // basic columns do not occur in the tableau
+      ASSERT_TRUE(ct.getColumn(col).empty());
+      assertMatches(ct, t);
+    }
+  }
+}
+
+TEST_F(TestTheoryBlackArithCompressedTableau, cancellation)
+{
+  // x2 = x0 + x1, x3 = x0 - x1
+  CompressedTableau ct;
+  ct.reset(4);
+  ct.addRow({{0, 1.0}, {1, 1.0}});
+  ct.addRow({{0, 1.0}, {1, -1.0}});
+  // x0 = x2 - x1, hence x3 = x2 - 2 x1 and x0 no longer occurs
+  ct.pivot(0, 0, 2);
+  ASSERT_TRUE(ct.getColumn(0).empty());
+  ASSERT_EQ(ct.getRowLength(1), 2);
+  ASSERT_EQ(ct.getCoefficient(1, 2), 1.0);
+  ASSERT_EQ(ct.getCoefficient(1, 1), -2.0);
+  // x1 = (x2 - x3) / 2, hence x0 = x2 - x1 = (x2 + x3) / 2
+  ct.pivot(1, 1, 3);
+  ASSERT_EQ(ct.getCoefficient(0, 2), 0.5);
+  ASSERT_EQ(ct.getCoefficient(0, 3), 0.5);
+  ASSERT_EQ(ct.getNumEntries(), 4);
+  std::vector<double> x = {0.0, 0.0, 4.0, 2.0};
+  ASSERT_EQ(ct.dot(0, x), 3.0);
+  ASSERT_EQ(ct.dot(1, x), 1.0);
+}
+
+TEST_F(TestTheoryBlackArithCompressedTableau, replay)
+{
+  replay(
+      "tableau 13\n"
+      "row 8 0:-1 1:-3 2:-2 3:-3 5:-2 6:-2 7:1/2\n"
+      "row 9 0:-2 4:1/2 5:1 6:-1 7:-1\n"
+      "row 10 4:1 5:-2\n"
+      "row 11 5:1\n"
+      "row 12 0:2 4:-2 5:1/2 6:3 7:-3/4\n"
+      "pivot 2 5\n"
+      "pivot 0 1\n"
+      "pivot 4 10\n"
+      "pivot 0 3\n"
+      "pivot 4 4\n"
+      "pivot 2 10\n"
+      "pivot 4 0\n"
+      "pivot 1 12\n");
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,148 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of the cut computation of
+ * cvc5::theory::arith::linear::GomoryCuts.
+ */
+
+#include <random>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/gomory_cuts.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+class TestTheoryBlackArithGomoryCuts : public TestInternal
+{
+ protected:
+  /** Returns sum_j cut[j] * y[j]. */
+  static Rational evaluate(const std::vector<Rational>& cut,
+                           const std::vector<Rational>& y)
+  {
+    Rational sum(0);
+    for (size_t j = 0; j < cut.size(); j++)
+    {
+      sum += cut[j] * y[j];
+    }
+    return sum;
+  }
+
+  /**
+   * Checks that the cut of x_b + sum_j coeffs[j] * y_j = rhs holds on every
+   * point with y_j in {0, ..., 4} for the integral y_j and with x_b in
+   * {-20, ..., 20}, where the last y_j is solved for if it is not integral.
+   */
+  static void checkValid(const Rational& rhs,
+                         const std::vector<Rational>& coeffs,
+                         const std::vector<bool>& integral)
+  {
+    std::vector<Rational> cut =
+        GomoryCuts::computeGmi(rhs, coeffs, integral);
+    ASSERT_EQ(cut.size(), coeffs.size());
+    size_t n = coeffs.size();
+    size_t free = integral[n - 1] ? n : n - 1;
+    std::vector<Rational> y(n, Rational(0));
+    std::vector<int> counter(free, 0);
+    for (;;)
+    {
+      for (size_t j = 0; j < free; j++)
+      {
+        y[j] = Rational(counter[j]);
+      }
+      for (int xb = -20; xb <= 20; xb++)
+      {
+        // the residual rhs - x_b - sum_{j < free} coeffs[j] * y[j]
+        Rational res = rhs - Rational(xb);
+        for (size_t j = 0; j < free; j++)
+        {
+          res -= coeffs[j] * y[j];
+        }
+        if (free == n)
+        {
+          if (res.isZero())
+          {
+            ASSERT_GE(evaluate(cut, y), Rational(1));
+          }
+          continue;
+        }
+        y[n - 1] = res / coeffs[n - 1];
+        if (y[n - 1].sgn() >= 0)
+        {
+          ASSERT_GE(evaluate(cut, y), Rational(1));
+        }
+      }
+      size_t j = 0;
+      for (; j < free && counter[j] == 4; j++)
+      {
+        counter[j] = 0;
+      }
+      if (j == free)
+      {
+        break;
+      }
+      counter[j]++;
+    }
+  }
+};
+
+TEST_F(TestTheoryBlackArithGomoryCuts, pure_integer)
+{
+  // x_b + 1/2 y_0 + 3/4 y_1 = 5/4, so f0 = 1/4
+  std::vector<Rational> cut = GomoryCuts::computeGmi(
+      Rational(5, 4), {Rational(1, 2), Rational(3, 4)}, {true, true});
+  // (1 - 1/2) / (3/4) y_0 + (1 - 3/4) / (3/4) y_1 >= 1
+  ASSERT_EQ(cut[0], Rational(2, 3));
+  ASSERT_EQ(cut[1], Rational(1, 3));
+}
+
+TEST_F(TestTheoryBlackArithGomoryCuts, mixed)
+{
+  // x_b - 2 y_0 + 1/3 y_1 = 1/2 with continuous y_0 and integral y_1
+  std::vector<Rational> cut = GomoryCuts::computeGmi(
+      Rational(1, 2), {Rational(-2), Rational(1, 3)}, {false, true});
+  ASSERT_EQ(cut[0], Rational(4));
+  ASSERT_EQ(cut[1], Rational(2, 3));
+}
+
+TEST_F(TestTheoryBlackArithGomoryCuts, random_valid)
+{
+  std::mt19937 rng(7);
+  for (size_t round = 0; round < 100; round++)
+  {
+    size_t n = 1 + rng() % 3;
+    std::vector<Rational> coeffs;
+    std::vector<bool> integral;
+    for (size_t j = 0; j < n; j++)
+    {
+      int num = static_cast<int>(rng() % 15) - 7;
+      if (num == 0)
+      {
+        num = 1;
+      }
+      coeffs.emplace_back(num, static_cast<int>(1 + rng() % 4));
+      integral.push_back(rng() % 3 != 0);
+    }
+    Rational rhs(static_cast<int>(rng() % 21) - 10,
+                 static_cast<int>(2 + rng() % 5));
+    if (rhs.isIntegral())
+    {
+      continue;
+    }
+    checkValid(rhs, coeffs, integral);
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
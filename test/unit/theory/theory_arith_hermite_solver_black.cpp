@@ -0,0 +1,267 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::theory::arith::linear::IncrementalHnf.
+ */
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/hermite_solver.h"
+#include "util/integer.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+using Row = std::vector<std::pair<size_t, Integer>>;
+
+class TestTheoryBlackArithHermiteSolver : public TestInternal
+{
+ protected:
+  /** Returns sum_i row[i].second * x[row[i].first]. */
+  static Integer evaluate(const Row& row, const std::vector<Integer>& x)
+  {
+    Integer sum;
+    for (const std::pair<size_t, Integer>& e : row)
+    {
+      if (e.first < x.size())
+      {
+        sum += e.second * x[e.first];
+      }
+    }
+    return sum;
+  }
+};
+
+TEST_F(TestTheoryBlackArithHermiteSolver, feasible)
+{
+  IncrementalHnf hnf(512);
+  // 2 x_0 + 3 x_1 = 1, 4 x_1 - 6 x_2 = 2
+  Row r0{{0, Integer(2)}, {1, Integer(3)}};
+  Row r1{{1, Integer(4)}, {2, Integer(-6)}};
+  ASSERT_EQ(hnf.addRow(r0, Integer(1)), IncrementalHnf::Result::FEASIBLE);
+  ASSERT_EQ(hnf.addRow(r1, Integer(2)), IncrementalHnf::Result::FEASIBLE);
+  ASSERT_EQ(hnf.getNumRows(), 2u);
+  ASSERT_EQ(hnf.getNumParameters(), 1u);
+  std::vector<Integer> x = hnf.getSolution();
+  ASSERT_EQ(evaluate(r0, x), Integer(1));
+  ASSERT_EQ(evaluate(r1, x), Integer(2));
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, infeasible)
+{
+  IncrementalHnf hnf(512);
+  // x_0 + x_1 - 2 x_2 = 1, x_3 = 5, x_0 - x_1 - 2 x_4 = 0
+  ASSERT_EQ(hnf.addRow({{0, Integer(1)}, {1, Integer(1)}, {2, Integer(-2)}},
+                       Integer(1)),
+            IncrementalHnf::Result::FEASIBLE);
+  ASSERT_EQ(hnf.addRow({{3, Integer(1)}}, Integer(5)),
+            IncrementalHnf::Result::FEASIBLE);
+  ASSERT_EQ(hnf.addRow({{0, Integer(1)}, {1, Integer(-1)}, {4, Integer(-2)}},
+                       Integer(0)),
+            IncrementalHnf::Result::INFEASIBLE);
+  ASSERT_EQ(hnf.getConflict(), std::vector<size_t>({0, 2}));
+
+  hnf.clear();
+  // 2 x_0 + 4 x_1 = 1
+  ASSERT_EQ(hnf.addRow({{0, Integer(2)}, {1, Integer(4)}}, Integer(1)),
+            IncrementalHnf::Result::INFEASIBLE);
+  ASSERT_EQ(hnf.getConflict(), std::vector<size_t>({0}));
+
+  hnf.clear();
+  // x_0 = 1, x_0 = 2
+  ASSERT_EQ(hnf.addRow({{0, Integer(1)}}, Integer(1)),
+            IncrementalHnf::Result::FEASIBLE);
+  ASSERT_EQ(hnf.addRow({{0, Integer(1)}}, Integer(2)),
+            IncrementalHnf::Result::INFEASIBLE);
+  ASSERT_EQ(hnf.getConflict(), std::vector<size_t>({0, 1}));
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, too_large)
+{
+  IncrementalHnf hnf(8);
+  ASSERT_EQ(hnf.addRow({{0, Integer(1)}, {1, Integer(1000)}}, Integer(3)),
+            IncrementalHnf::Result::TOO_LARGE);
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, random_feasible)
+{
+  std::mt19937 rng(11);
+  for (size_t round = 0; round < 200; ++round)
+  {
+    size_t n = 2 + rng() % 5;
+    size_t m = 1 + rng() % n;
+    std::vector<Integer> point;
+    for (size_t i = 0; i < n; ++i)
+    {
+      point.emplace_back(static_cast<int>(rng() % 21) - 10);
+    }
+    std::vector<Row> rows;
+    std::vector<Integer> rhs;
+    IncrementalHnf hnf(512);
+    for (size_t r = 0; r < m; ++r)
+    {
+      Row row;
+      for (size_t i = 0; i < n; ++i)
+      {
+        int c = static_cast<int>(rng() % 13) - 6;
+        if (c != 0 && rng() % 3 != 0)
+        {
+          row.emplace_back(i, Integer(c));
+        }
+      }
+      rows.push_back(row);
+      rhs.push_back(evaluate(row, point));
+      ASSERT_EQ(hnf.addRow(row, rhs.back()), IncrementalHnf::Result::FEASIBLE);
+    }
+    std::vector<Integer> x = hnf.getSolution();
+    for (size_t r = 0; r < m; ++r)
+    {
+      ASSERT_EQ(evaluate(rows[r], x), rhs[r]);
+    }
+  }
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, random_conflict)
+{
+  std::mt19937 rng(13);
+  for (size_t round = 0; round < 200; ++round)
+  {
+    size_t n = 2 + rng() % 4;
+    std::vector<Row> rows;
+    std::vector<Integer> rhs;
+    IncrementalHnf hnf(512);
+    IncrementalHnf::Result res = IncrementalHnf::Result::FEASIBLE;
+    for (size_t r = 0; r < 2 * n && res == IncrementalHnf::Result::FEASIBLE;
+         ++r)
+    {
+      Row row;
+      for (size_t i = 0; i < n; ++i)
+      {
+        int c = static_cast<int>(rng() % 9) - 4;
+        if (c != 0)
+        {
+          row.emplace_back(i, Integer(2 * c + (rng() % 4 == 0 ? 1 : 0)));
+        }
+      }
+      rows.push_back(row);
+      rhs.emplace_back(static_cast<int>(rng() % 11) - 5);
+      res = hnf.addRow(row, rhs.back());
+    }
+    if (res != IncrementalHnf::Result::INFEASIBLE)
+    {
+      continue;
+    }
+    // the conflict alone is infeasible and ends with the last row
+    std::vector<size_t> conflict = hnf.getConflict();
+    ASSERT_FALSE(conflict.empty());
+    ASSERT_EQ(conflict.back(), rows.size() - 1);
+    IncrementalHnf sub(512);
+    for (size_t i = 0, k = conflict.size(); i < k; ++i)
+    {
+      IncrementalHnf::Result subRes =
+          sub.addRow(rows[conflict[i]], rhs[conflict[i]]);
+      ASSERT_EQ(subRes,
+                i + 1 < k ? IncrementalHnf::Result::FEASIBLE
+                          : IncrementalHnf::Result::INFEASIBLE);
+    }
+  }
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, pop_row)
+{
+  IncrementalHnf hnf(512);
+  // x_0 + x_1 - 2 x_2 = 1
+  Row r0{{0, Integer(1)}, {1, Integer(1)}, {2, Integer(-2)}};
+  // x_0 - x_1 - 2 x_3 = 0
+  Row r1{{0, Integer(1)}, {1, Integer(-1)}, {3, Integer(-2)}};
+  // x_0 - x_1 - 2 x_3 = 1
+  Row r2{{0, Integer(1)}, {1, Integer(-1)}, {3, Integer(-2)}};
+  ASSERT_EQ(hnf.addRow(r0, Integer(1)), IncrementalHnf::Result::FEASIBLE);
+  std::vector<std::map<size_t, Integer>> params = hnf.getParameters();
+  ASSERT_EQ(hnf.addRow(r1, Integer(0)), IncrementalHnf::Result::INFEASIBLE);
+  hnf.popRow();
+  ASSERT_EQ(hnf.getNumRows(), 1u);
+  ASSERT_TRUE(hnf.getConflict().empty());
+  ASSERT_EQ(hnf.getParameters(), params);
+  ASSERT_EQ(hnf.addRow(r2, Integer(1)), IncrementalHnf::Result::FEASIBLE);
+  std::vector<Integer> x = hnf.getSolution();
+  ASSERT_EQ(evaluate(r0, x), Integer(1));
+  ASSERT_EQ(evaluate(r2, x), Integer(1));
+  hnf.popRow();
+  hnf.popRow();
+  ASSERT_EQ(hnf.getNumRows(), 0u);
+  ASSERT_EQ(hnf.getNumParameters(), 0u);
+}
+
+TEST_F(TestTheoryBlackArithHermiteSolver, random_pop_row)
+{
+  std::mt19937 rng(17);
+  for (size_t round = 0; round < 200; ++round)
+  {
+    size_t n = 2 + rng() % 5;
+    std::vector<Row> rows;
+    std::vector<Integer> rhs;
+    // the parameters after each prefix of the rows
+    IncrementalHnf hnf(512);
+    std::vector<std::vector<std::map<size_t, Integer>>> params{
+        hnf.getParameters()};
+    for (size_t step = 0; step < 20; ++step)
+    {
+      if (!rows.empty() && rng() % 3 == 0)
+      {
+        hnf.popRow();
+        rows.pop_back();
+        rhs.pop_back();
+        params.pop_back();
+        ASSERT_EQ(hnf.getParameters(), params.back());
+        continue;
+      }
+      Row row;
+      for (size_t i = 0; i < n; ++i)
+      {
+        int c = static_cast<int>(rng() % 13) - 6;
+        if (c != 0 && rng() % 3 != 0)
+        {
+          row.emplace_back(i, Integer(c));
+        }
+      }
+      rows.push_back(row);
+      rhs.emplace_back(static_cast<int>(rng() % 11) - 5);
+      if (hnf.addRow(row, rhs.back()) != IncrementalHnf::Result::FEASIBLE)
+      {
+        hnf.popRow();
+        rows.pop_back();
+        rhs.pop_back();
+        ASSERT_EQ(hnf.getParameters(), params.back());
+        continue;
+      }
+      params.push_back(hnf.getParameters());
+      // the rows hold for the solution, for which the parameters are zero
+      std::vector<Integer> x = hnf.getSolution();
+      for (size_t r = 0, m = rows.size(); r < m; ++r)
+      {
+        ASSERT_EQ(evaluate(rows[r], x), rhs[r]);
+      }
+      for (const std::map<size_t, Integer>& p : params.back())
+      {
+        ASSERT_EQ(evaluate(Row(p.begin(), p.end()), x), Integer());
+      }
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
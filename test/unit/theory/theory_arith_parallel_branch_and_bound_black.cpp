@@ -0,0 +1,271 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of
+ * cvc5::theory::arith::linear::ParallelBranchAndBound.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "test.h"
+#include "theory/arith/linear/parallel_branch_and_bound.h"
+#include "util/integer.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace theory::arith::linear;
+
+namespace test {
+
+/**
+ * A problem over the structural variables 0, ..., n - 1 and the slack
+ * variables n, ..., n + m - 1 defined by integer rows.
+ */
+struct Problem
+{
+  size_t d_numStructural;
+  std::vector<std::vector<int>> d_rows;
+  std::vector<std::optional<Integer>> d_lower;
+  std::vector<std::optional<Integer>> d_upper;
+
+  size_t size() const { return d_numStructural + d_rows.size(); }
+
+  /** Returns the value of every variable for the structural values x. */
+  std::vector<Integer> extend(const std::vector<Integer>& x) const
+  {
+    std::vector<Integer> values(x);
+    for (const std::vector<int>& row : d_rows)
+    {
+      Integer sum;
+      for (size_t j = 0; j < d_numStructural; ++j)
+      {
+        sum += Integer(row[j]) * x[j];
+      }
+      values.push_back(sum);
+    }
+    return values;
+  }
+
+  /** Returns true if values is within the bounds, if in[v] for the bounds. */
+  bool satisfies(const std::vector<Integer>& values,
+                 const std::vector<bool>& lowerIn,
+                 const std::vector<bool>& upperIn) const
+  {
+    for (size_t v = 0; v < size(); ++v)
+    {
+      if ((lowerIn[v] && d_lower[v] && values[v] < *d_lower[v])
+          || (upperIn[v] && d_upper[v] && values[v] > *d_upper[v]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Searches for a solution with every structural variable in [-box, box]
+   * that satisfies the selected bounds.
+   */
+  bool bruteForce(int box,
+                  const std::vector<bool>& lowerIn,
+                  const std::vector<bool>& upperIn) const
+  {
+    std::vector<Integer> x(d_numStructural, Integer(-box));
+    for (;;)
+    {
+      if (satisfies(extend(x), lowerIn, upperIn))
+      {
+        return true;
+      }
+      size_t j = 0;
+      for (; j < d_numStructural && x[j] == Integer(box); ++j)
+      {
+        x[j] = Integer(-box);
+      }
+      if (j == d_numStructural)
+      {
+        return false;
+      }
+      x[j] += 1;
+    }
+  }
+
+  /** Adds the bounds and the rows to bab. */
+  void fill(ParallelBranchAndBound& bab) const
+  {
+    for (size_t v = 0; v < size(); ++v)
+    {
+      if (d_lower[v])
+      {
+        bab.setLowerBound(v, *d_lower[v]);
+      }
+      if (d_upper[v])
+      {
+        bab.setUpperBound(v, *d_upper[v]);
+      }
+    }
+    for (size_t r = 0; r < d_rows.size(); ++r)
+    {
+      std::vector<std::pair<size_t, Rational>> coeffs;
+      for (size_t j = 0; j < d_numStructural; ++j)
+      {
+        if (d_rows[r][j] != 0)
+        {
+          coeffs.emplace_back(j, Rational(d_rows[r][j]));
+        }
+      }
+      bab.addRow(d_numStructural + r, coeffs);
+    }
+  }
+};
+
+class TestTheoryBlackArithParallelBranchAndBound : public TestInternal
+{
+};
+
+TEST_F(TestTheoryBlackArithParallelBranchAndBound, sat)
+{
+  // 0 <= x, y <= 10 and 7 x + 11 y = 40
+  Problem p{2,
+            {{7, 11}},
+            {Integer(0), Integer(0), Integer(40)},
+            {Integer(10), Integer(10), Integer(40)}};
+  ParallelBranchAndBound bab(p.size());
+  p.fill(bab);
+  ASSERT_EQ(bab.solve(4, 1000), ParallelBranchAndBound::Result::SAT);
+  const std::vector<Integer>& model = bab.getModel();
+  ASSERT_EQ(model[0], Integer(1));
+  ASSERT_EQ(model[1], Integer(3));
+  ASSERT_EQ(model[2], Integer(40));
+}
+
+TEST_F(TestTheoryBlackArithParallelBranchAndBound, unsat)
+{
+  // 2 x + 2 y = 1 with -5 <= x, y <= 5, and 0 <= z <= 5 is not needed
+  Problem p{3,
+            {{2, 2, 0}},
+            {Integer(-5), Integer(-5), Integer(0), Integer(1)},
+            {Integer(5), Integer(5), Integer(5), Integer(1)}};
+  ParallelBranchAndBound bab(p.size());
+  p.fill(bab);
+  ASSERT_EQ(bab.solve(3, 1000), ParallelBranchAndBound::Result::UNSAT);
+  std::vector<size_t> lower = bab.getConflictLowerBounds();
+  std::vector<size_t> upper = bab.getConflictUpperBounds();
+  ASSERT_EQ(lower.back(), 3u);
+  ASSERT_EQ(upper.back(), 3u);
+  ASSERT_EQ(std::count(lower.begin(), lower.end(), 2), 0);
+  ASSERT_EQ(std::count(upper.begin(), upper.end(), 2), 0);
+}
+
+TEST_F(TestTheoryBlackArithParallelBranchAndBound, node_limit)
+{
+  Problem p{2,
+            {{7, 11}},
+            {Integer(0), Integer(0), Integer(40)},
+            {Integer(10), Integer(10), Integer(40)}};
+  ParallelBranchAndBound bab(p.size());
+  p.fill(bab);
+  ASSERT_EQ(bab.solve(2, 1), ParallelBranchAndBound::Result::UNKNOWN);
+  ASSERT_EQ(bab.getNumNodes(), 1u);
+}
+
+TEST_F(TestTheoryBlackArithParallelBranchAndBound, interrupted)
+{
+  Problem p{2,
+            {{7, 11}},
+            {Integer(0), Integer(0), Integer(40)},
+            {Integer(10), Integer(10), Integer(40)}};
+  ParallelBranchAndBound bab(p.size());
+  p.fill(bab);
+  // the limits are checked before the first node
+  std::vector<uint64_t> calls;
+  auto stop = [&calls](uint64_t numNodes) {
+    calls.push_back(numNodes);
+    return true;
+  };
+  ASSERT_EQ(bab.solve(1, 1000, stop), ParallelBranchAndBound::Result::UNKNOWN);
+  ASSERT_EQ(bab.getNumNodes(), 0u);
+  ASSERT_EQ(calls, std::vector<uint64_t>{0});
+  // and between nodes
+  calls.clear();
+  auto stopAfterTwo = [&calls](uint64_t numNodes) {
+    calls.push_back(numNodes);
+    return numNodes >= 2;
+  };
+  ASSERT_EQ(bab.solve(1, 1000, stopAfterTwo),
+            ParallelBranchAndBound::Result::UNKNOWN);
+  ASSERT_EQ(bab.getNumNodes(), 2u);
+  ASSERT_EQ(calls, (std::vector<uint64_t>{0, 1, 2}));
+  // the callback does not survive the call to solve()
+  ASSERT_EQ(bab.solve(1, 1000), ParallelBranchAndBound::Result::SAT);
+}
+
+TEST_F(TestTheoryBlackArithParallelBranchAndBound, random)
+{
+  std::mt19937 rng(5);
+  for (size_t round = 0; round < 100; ++round)
+  {
+    Problem p;
+    p.d_numStructural = 2 + rng() % 2;
+    size_t m = 1 + rng() % 2;
+    for (size_t r = 0; r < m; ++r)
+    {
+      std::vector<int> row;
+      for (size_t j = 0; j < p.d_numStructural; ++j)
+      {
+        row.push_back(static_cast<int>(rng() % 9) - 4);
+      }
+      p.d_rows.push_back(row);
+    }
+    for (size_t v = 0; v < p.size(); ++v)
+    {
+      int lo = static_cast<int>(rng() % 7) - 3;
+      int width = v < p.d_numStructural ? 3 : static_cast<int>(rng() % 3);
+      p.d_lower.emplace_back(Integer(lo));
+      p.d_upper.emplace_back(Integer(lo + width));
+    }
+    std::vector<bool> all(p.size(), true);
+    bool feasible = p.bruteForce(6, all, all);
+
+    ParallelBranchAndBound bab(p.size());
+    p.fill(bab);
+    ParallelBranchAndBound::Result res = bab.solve(1 + round % 4, 10000);
+    if (feasible)
+    {
+      ASSERT_EQ(res, ParallelBranchAndBound::Result::SAT);
+      const std::vector<Integer>& model = bab.getModel();
+      std::vector<Integer> x(model.begin(),
+                             model.begin() + p.d_numStructural);
+      ASSERT_EQ(p.extend(x), model);
+      ASSERT_TRUE(p.satisfies(model, all, all));
+      continue;
+    }
+    ASSERT_EQ(res, ParallelBranchAndBound::Result::UNSAT);
+    // the bounds in the conflict are infeasible on their own
+    std::vector<bool> lowerIn(p.size(), false);
+    std::vector<bool> upperIn(p.size(), false);
+    for (size_t v : bab.getConflictLowerBounds())
+    {
+      lowerIn[v] = true;
+    }
+    for (size_t v : bab.getConflictUpperBounds())
+    {
+      upperIn[v] = true;
+    }
+    ASSERT_FALSE(p.bruteForce(20, lowerIn, upperIn));
+  }
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,208 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::theory::eq::EqualityEngine on synthetic
+ * congruence workloads.
+ */
+
+#include "context/context.h"
+#include "test_smt.h"
+#include "theory/uf/equality_engine.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+using namespace theory::eq;
+
+namespace test {
+
+class TestTheoryBlackUfEqualityEngine : public TestSmt
+{
+ protected:
+  void SetUp() override
+  {
+    TestSmt::SetUp();
+    d_context.reset(new context::Context());
+    d_ee.reset(new EqualityEngine(
+        d_slvEngine->getEnv(), d_context.get(), "eeTest", true));
+    d_ee->addFunctionKind(Kind::APPLY_UF);
+    TypeNode intType = d_nodeManager->integerType();
+    d_f = d_skolemManager->mkDummySkolem(
+        "f", d_nodeManager->mkFunctionType(intType, intType));
+    for (size_t i = 0; i < s_numTerms; i++)
+    {
+      d_x.push_back(d_skolemManager->mkDummySkolem("x", intType));
+      d_fx.push_back(d_nodeManager->mkNode(Kind::APPLY_UF, d_f, d_x[i]));
+      d_ee->addTerm(d_fx[i]);
+    }
+  }
+
+  void TearDown() override
+  {
+    d_ee.reset();
+    d_context.reset();
+    TestSmt::TearDown();
+  }
+
+  /** Assert x_i = x_j, returns the asserted equality. */
+  Node assertEq(size_t i, size_t j)
+  {
+    Node eq = d_x[i].eqNode(d_x[j]);
+    d_ee->assertEquality(eq, true, eq);
+    return eq;
+  }
+
+  /** Get the number of terms in the equivalence class of t. */
+  size_t classSize(TNode t)
+  {
+    size_t size = 0;
+    EqClassIterator it(d_ee->getRepresentative(t), d_ee.get());
+    for (; !it.isFinished(); ++it)
+    {
+      size++;
+    }
+    return size;
+  }
+
+  static constexpr size_t s_numTerms = 200;
+  std::unique_ptr<context::Context> d_context;
+  std::unique_ptr<EqualityEngine> d_ee;
+  Node d_f;
+  std::vector<Node> d_x;
+  std::vector<Node> d_fx;
+};
+
+TEST_F(TestTheoryBlackUfEqualityEngine, merge_chain)
+{
+  d_context->push();
+  std::vector<Node> eqs;
+  for (size_t i = 1; i < s_numTerms; i++)
+  {
+    eqs.push_back(assertEq(i - 1, i));
+  }
+  ASSERT_TRUE(d_ee->consistent());
+  ASSERT_EQ(classSize(d_x[0]), s_numTerms);
+  TNode rep = d_ee->getRepresentative(d_x[0]);
+  for (size_t i = 0; i < s_numTerms; i++)
+  {
+    ASSERT_EQ(d_ee->getRepresentative(d_x[i]), rep);
+    // congruence
+    ASSERT_TRUE(d_ee->areEqual(d_fx[0], d_fx[i]));
+  }
+  // the explanation of the congruence is the full chain
+  std::vector<TNode> assumptions;
+  d_ee->explainEquality(d_fx[0], d_fx[s_numTerms - 1], true, assumptions);
+  ASSERT_EQ(assumptions.size(), eqs.size());
+  d_context->pop();
+  ASSERT_FALSE(d_ee->areEqual(d_x[0], d_x[1]));
+  ASSERT_FALSE(d_ee->areEqual(d_fx[0], d_fx[1]));
+  ASSERT_EQ(classSize(d_x[0]), 1);
+}
+
+TEST_F(TestTheoryBlackUfEqualityEngine, merge_balanced)
+{
+  // merge classes pairwise, doubling their size in each round
+  for (size_t step = 1; step < s_numTerms; step *= 2)
+  {
+    d_context->push();
+    for (size_t i = 0; i + step < s_numTerms; i += 2 * step)
+    {
+      assertEq(i, i + step);
+    }
+  }
+  for (size_t i = 0; i < s_numTerms; i++)
+  {
+    ASSERT_TRUE(d_ee->areEqual(d_x[0], d_x[i]));
+    ASSERT_TRUE(d_ee->areEqual(d_fx[0], d_fx[i]));
+  }
+  std::vector<TNode> assumptions;
+  d_ee->explainEquality(d_x[0], d_x[s_numTerms - 1], true, assumptions);
+  ASSERT_FALSE(assumptions.empty());
+  ASSERT_LT(assumptions.size(), s_numTerms);
+  // popping one round splits the classes again
+  d_context->pop();
+  ASSERT_EQ(classSize(d_x[0]), 128);
+  ASSERT_FALSE(d_ee->areEqual(d_fx[0], d_fx[s_numTerms - 1]));
+}
+
+TEST_F(TestTheoryBlackUfEqualityEngine, constants_representatives)
+{
+  Node five = d_nodeManager->mkConstInt(Rational(5));
+  d_ee->addTerm(five);
+  d_context->push();
+  for (size_t i = 1; i < s_numTerms; i++)
+  {
+    assertEq(i - 1, i);
+  }
+  // constants are always the representatives of their classes, even if their
+  // class is smaller
+  Node eq = d_x[s_numTerms / 2].eqNode(five);
+  d_ee->assertEquality(eq, true, eq);
+  ASSERT_EQ(d_ee->getRepresentative(d_x[0]), five);
+  d_context->pop();
+  ASSERT_NE(d_ee->getRepresentative(d_x[0]), five);
+  // function applications are not internal, hence they are representatives
+  // of their own classes
+  ASSERT_EQ(d_ee->getRepresentative(d_fx[0]), d_fx[0]);
+}
+
+TEST_F(TestTheoryBlackUfEqualityEngine, explanation_cache)
+{
+  d_context->push();
+  for (size_t i = 1; i < 10; i++)
+  {
+    assertEq(i - 1, i);
+  }
+  std::vector<TNode> assumptions;
+  d_ee->explainEquality(d_fx[0], d_fx[9], true, assumptions);
+  ASSERT_EQ(assumptions.size(), 9);
+  // explaining again, in either direction and in a nested context, gives the
+  // same explanation
+  d_context->push();
+  std::vector<TNode> again;
+  d_ee->explainEquality(d_fx[9], d_fx[0], true, again);
+  ASSERT_EQ(again, assumptions);
+  d_context->pop();
+  d_context->pop();
+  // after backtracking, the explanation uses the new equalities
+  d_context->push();
+  Node eq = assertEq(0, 9);
+  assumptions.clear();
+  d_ee->explainEquality(d_fx[0], d_fx[9], true, assumptions);
+  ASSERT_EQ(assumptions.size(), 1);
+  ASSERT_EQ(assumptions[0], eq);
+  d_context->pop();
+}
+
+TEST_F(TestTheoryBlackUfEqualityEngine, application_lookup_table)
+{
+  ApplicationLookupTable table;
+  // enough entries for the table to grow several times
+  for (EqualityNodeId i = 0; i < 1000; i++)
+  {
+    table.insert(FunctionApplication(APP_UNINTERPRETED, i, i + 1), i);
+  }
+  ASSERT_EQ(table.size(), 1000);
+  ASSERT_EQ(table.find(FunctionApplication(APP_UNINTERPRETED, 7, 8)), 7);
+  ASSERT_EQ(table.find(FunctionApplication(APP_UNINTERPRETED, 8, 7)), null_id);
+  // removing the most recent entries keeps the others accessible
+  table.resize(500);
+  ASSERT_EQ(table.size(), 500);
+  for (EqualityNodeId i = 0; i < 1000; i++)
+  {
+    ASSERT_EQ(table.find(FunctionApplication(APP_UNINTERPRETED, i, i + 1)),
+              i < 500 ? i : null_id);
+  }
+  table.insert(FunctionApplication(APP_EQUALITY, 600, 601), 42);
+  ASSERT_EQ(table.find(FunctionApplication(APP_EQUALITY, 600, 601)), 42);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
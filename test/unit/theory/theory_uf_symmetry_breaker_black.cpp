@@ -0,0 +1,83 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::theory::uf::SymmetryBreaker.
+ */
+
+#include <vector>
+
+#include "test_smt.h"
+#include "theory/uf/symmetry_breaker.h"
+
+namespace cvc5::internal {
+
+using namespace theory;
+using namespace theory::uf;
+
+namespace test {
+
+class TestTheoryBlackUfSymmetryBreaker : public TestSmtNoFinishInit
+{
+ protected:
+  /**
+   * Break the symmetries of an assignment of two pigeons to three holes,
+   * which is given as a single conjunction. Syntactic template matching only
+   * compares top-level disjunctions and consecutive assertions, so it finds
+   * no permutation sets in it.
+   */
+  std::vector<Node> breakPigeonHoleSymmetries(bool refine)
+  {
+    d_slvEngine->setOption("symmetry-breaker-refine", refine ? "true" : "false");
+    d_slvEngine->finishInit();
+    TypeNode u = d_nodeManager->mkSort("U");
+    std::vector<Node> pigeons, holes;
+    for (size_t i = 0; i < 2; i++)
+    {
+      pigeons.push_back(d_skolemManager->mkDummySkolem("p", u));
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+      holes.push_back(d_skolemManager->mkDummySkolem("h", u));
+    }
+    std::vector<Node> conj;
+    for (const Node& p : pigeons)
+    {
+      std::vector<Node> disj;
+      for (const Node& h : holes)
+      {
+        disj.push_back(p.eqNode(h));
+      }
+      conj.push_back(d_nodeManager->mkNode(Kind::OR, disj));
+    }
+    SymmetryBreaker sb(d_slvEngine->getEnv(), "test");
+    sb.assertFormula(d_nodeManager->mkNode(Kind::AND, conj));
+    std::vector<Node> clauses;
+    sb.apply(clauses);
+    return clauses;
+  }
+};
+
+TEST_F(TestTheoryBlackUfSymmetryBreaker, no_refine)
+{
+  ASSERT_TRUE(breakPigeonHoleSymmetries(false).empty());
+}
+
+TEST_F(TestTheoryBlackUfSymmetryBreaker, refine)
+{
+  // the holes are found to be interchangeable, which is broken by assigning
+  // the first pigeon to one of them
+  std::vector<Node> clauses = breakPigeonHoleSymmetries(true);
+  ASSERT_FALSE(clauses.empty());
+  for (const Node& c : clauses)
+  {
+    ASSERT_TRUE(c.getKind() == Kind::EQUAL || c.getKind() == Kind::OR);
+  }
+}
+}  // namespace test
+}  // namespace cvc5::internal
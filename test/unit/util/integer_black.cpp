@@ -613,5 +613,44 @@ TEST_F(TestUtilBlackInteger, modInverse)
     }
   }
 }
+TEST_F(TestUtilBlackInteger, word_boundaries)
+{
+  // arithmetic crossing the range of machine words
+  long lmin = std::numeric_limits<long>::min();
+  long lmax = std::numeric_limits<long>::max();
+  Integer min(lmin);
+  Integer max(lmax);
+  Integer one(1);
+  Integer word = Integer(1).multiplyByPow2(sizeof(long) * 8 - 1);
+  ASSERT_EQ(max + one, word);
+  ASSERT_EQ(min - one, -word - one);
+  ASSERT_EQ(-min, word);
+  ASSERT_EQ(min.abs(), word);
+  ASSERT_EQ(min * Integer(-1), word);
+  ASSERT_EQ(max * max, word * word - word - word + one);
+  Integer x = max;
+  x += one;
+  ASSERT_EQ(x, word);
+  x -= one;
+  ASSERT_EQ(x, max);
+  ASSERT_EQ(x.getLong(), lmax);
+  x *= Integer(2);
+  ASSERT_EQ(x, max + max);
+  x -= max;
+  ASSERT_EQ(x, max);
+  ASSERT_EQ(x.getLong(), lmax);
+  ASSERT_EQ(x.hash(), max.hash());
+  ASSERT_EQ(min.floorDivideQuotient(Integer(-1)), word);
+  ASSERT_EQ(min.floorDivideRemainder(Integer(-1)), 0);
+  ASSERT_EQ(min.gcd(min), word);
+  ASSERT_EQ(min.gcd(Integer(0)), word);
+  ASSERT_TRUE(Integer(-1).divides(min));
+  ASSERT_EQ(min.exactQuotient(Integer(-1)), word);
+  ASSERT_EQ(Integer(word.toString()), word);
+  ASSERT_EQ(Integer(min.toString()), min);
+  ASSERT_LT(min, max);
+  ASSERT_LT(-word - one, min);
+  ASSERT_GT(word, max);
+}
 }  // namespace test
 }  // namespace cvc5::internal
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Micro-benchmarks for arithmetic on cvc5::Integer and cvc5::Rational.
+ *
+ * Each benchmark runs the same workload on values that fit into a machine
+ * word and on values that do not, checks the result against a closed form,
+ * and records the running times as test properties (see --gtest_output).
+ */
+
+#include <chrono>
+
+#include "test.h"
+#include "util/integer.h"
+#include "util/rational.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestUtilBlackNumberBenchmark : public TestInternal
+{
+ protected:
+  /** The number of iterations of each workload. */
+  static constexpr long s_iterations = 200000;
+
+  /** Runs f and returns its running time in microseconds. */
+  template <typename F>
+  static int64_t time(F f)
+  {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+        .count();
+  }
+
+  /** Returns sum_{i=1}^{n} (offset + i)^2 computed with Integer arithmetic. */
+  static Integer sumOfSquares(const Integer& offset, long n)
+  {
+    Integer sum;
+    for (long i = 1; i <= n; ++i)
+    {
+      Integer x = offset + Integer(i);
+      sum += x * x;
+    }
+    return sum;
+  }
+
+  /** Returns the closed form of sumOfSquares(offset, n). */
+  static Integer sumOfSquaresClosed(const Integer& offset, long n)
+  {
+    Integer in(n);
+    Integer squares =
+        (in * (in + 1) * (Integer(2) * in + 1)).exactQuotient(Integer(6));
+    Integer linear = offset * in * (in + 1);
+    return offset * offset * in + linear + squares;
+  }
+
+  /** Returns sum_{i=1}^{n} 3 * (offset + i) / 35 with Rational arithmetic. */
+  static Rational sumOfFractions(const Integer& offset, long n)
+  {
+    Rational sum;
+    Rational scale(3, 5);
+    for (long i = 1; i <= n; ++i)
+    {
+      Rational x(offset + Integer(i), Integer(7));
+      sum += x * scale;
+    }
+    return sum;
+  }
+
+  /** Returns the closed form of sumOfFractions(offset, n). */
+  static Rational sumOfFractionsClosed(const Integer& offset, long n)
+  {
+    Integer in(n);
+    Integer total = offset * in + (in * (in + 1)).exactQuotient(Integer(2));
+    return Rational(total * Integer(3), Integer(35));
+  }
+};
+
+TEST_F(TestUtilBlackNumberBenchmark, integer)
+{
+  Integer small(0);
+  Integer large = Integer(1).multiplyByPow2(100);
+  Integer smallSum, largeSum;
+  int64_t smallTime =
+      time([&]() { smallSum = sumOfSquares(small, s_iterations); });
+  int64_t largeTime =
+      time([&]() { largeSum = sumOfSquares(large, s_iterations); });
+  ASSERT_EQ(smallSum, sumOfSquaresClosed(small, s_iterations));
+  ASSERT_EQ(largeSum, sumOfSquaresClosed(large, s_iterations));
+  RecordProperty("small_us", std::to_string(smallTime));
+  RecordProperty("large_us", std::to_string(largeTime));
+}
+
+TEST_F(TestUtilBlackNumberBenchmark, rational)
+{
+  Integer small(0);
+  Integer large = Integer(1).multiplyByPow2(100);
+  Rational smallSum, largeSum;
+  int64_t smallTime =
+      time([&]() { smallSum = sumOfFractions(small, s_iterations); });
+  int64_t largeTime =
+      time([&]() { largeSum = sumOfFractions(large, s_iterations); });
+  ASSERT_EQ(smallSum, sumOfFractionsClosed(small, s_iterations));
+  ASSERT_EQ(largeSum, sumOfFractionsClosed(large, s_iterations));
+  RecordProperty("small_us", std::to_string(smallTime));
+  RecordProperty("large_us", std::to_string(largeTime));
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * This file is part of the cvc5 project.
+ *
+ * Copyright (c) 2009-2025 by the authors listed in the file AUTHORS
+ * in the top-level source directory and their institutional affiliations.
+ * All rights reserved.  See the file COPYING in the top-level source
+ * directory for licensing information.
+ * ****************************************************************************
+ *
+ * Black box testing of cvc5::Profiler.
+ */
+
+#include <sstream>
+
+#include "smt/profiler.h"
+#include "test_node.h"
+
+namespace cvc5::internal {
+namespace test {
+
+class TestUtilBlackProfiler : public TestNode
+{
+};
+
+TEST_F(TestUtilBlackProfiler, lemmas)
+{
+  Profiler p(d_nodeManager.get(), "", options::ProfileMetric::LEMMAS);
+  {
+    Profiler::Scope solve(&p, "solve");
+    {
+      Profiler::Scope check(&p, "check-full");
+      {
+        Profiler::Scope arith(&p, "THEORY_ARITH");
+        p.notifyLemma();
+        p.notifyLemma();
+      }
+      {
+        Profiler::Scope uf(&p, std::string("THEORY_UF"));
+        p.notifyLemma();
+      }
+    }
+    {
+      // scopes with the same stack are merged
+      Profiler::Scope check(&p, "check-full");
+      Profiler::Scope arith(&p, "THEORY_ARITH");
+      p.notifyLemma();
+    }
+  }
+  // disabled scopes do not affect the profile
+  Profiler::Scope disabled(nullptr, "disabled");
+  std::stringstream ss;
+  p.write(ss);
+  ASSERT_EQ(ss.str(),
+            "cvc5;solve;check-full;THEORY_ARITH 3\n"
+            "cvc5;solve;check-full;THEORY_UF 1\n");
+}
+
+TEST_F(TestUtilBlackProfiler, nodes)
+{
+  Profiler p(d_nodeManager.get(), "", options::ProfileMetric::NODES);
+  {
+    Profiler::Scope outer(&p, "outer");
+    Node x = d_nodeManager->mkBoundVar("x", *d_intTypeNode);
+    {
+      Profiler::Scope inner(&p, "inner");
+      Node y = d_nodeManager->mkBoundVar("y", *d_intTypeNode);
+    }
+  }
+  std::stringstream ss;
+  p.write(ss);
+  ASSERT_NE(ss.str().find("cvc5;outer "), std::string::npos);
+  ASSERT_NE(ss.str().find("cvc5;outer;inner "), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace cvc5::internal
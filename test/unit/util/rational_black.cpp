@@ -13,6 +13,7 @@
  * Black box testing of cvc5::Rational.
  */
 
+#include <limits>
 #include <sstream>
 
 #include "test.h"
@@ -42,5 +43,49 @@ TEST_F(TestUtilBlackRational, fromDecimal)
   ASSERT_THROW(Rational::fromDecimal("1.2/3");, std::invalid_argument);
   ASSERT_THROW(Rational::fromDecimal("Hello, world!");, std::invalid_argument);
 }
+
+TEST_F(TestUtilBlackRational, word_boundaries)
+{
+  // arithmetic crossing the range of machine words
+  long lmin = std::numeric_limits<long>::min();
+  long lmax = std::numeric_limits<long>::max();
+  Integer word = Integer(1).multiplyByPow2(sizeof(long) * 8 - 1);
+  Rational min(lmin);
+  Rational max(lmax);
+  Rational one(1);
+  ASSERT_EQ(max + one, Rational(word));
+  ASSERT_EQ(min - one, Rational(-word - Integer(1)));
+  ASSERT_EQ(-min, Rational(word));
+  ASSERT_EQ(min.abs(), Rational(word));
+  ASSERT_EQ(min / Rational(-1), Rational(word));
+  ASSERT_EQ((max * max).getNumerator(), Integer(lmax) * Integer(lmax));
+  ASSERT_EQ(Rational(lmin, -1L), Rational(word));
+  ASSERT_EQ(Rational(1L, lmin), Rational(Integer(-1), word));
+  ASSERT_EQ(Rational(lmax, 2L) * Rational(2), max);
+  ASSERT_EQ(Rational(1L, lmax) + Rational(1L, lmax), Rational(2L, lmax));
+  ASSERT_EQ(Rational(1L, lmax) + Rational(1L, lmax - 1),
+            Rational(Integer(lmax) + Integer(lmax - 1),
+                     Integer(lmax) * Integer(lmax - 1)));
+  // results that fit into words again compare equal to small values
+  Rational x = max + one;
+  x -= one;
+  ASSERT_EQ(x, max);
+  ASSERT_EQ(x.hash(), max.hash());
+  ASSERT_EQ(x.toString(), max.toString());
+  x = Rational(word, Integer(2)) / Rational(word);
+  ASSERT_EQ(x, Rational(1, 2));
+  ASSERT_EQ(x.hash(), Rational(1, 2).hash());
+  ASSERT_EQ(x.getDenominator(), Integer(2));
+  // canonical signs and comparisons
+  ASSERT_EQ(Rational(3, -6), Rational(-1, 2));
+  ASSERT_EQ(Rational(3, -6).getDenominator(), Integer(2));
+  ASSERT_LT(Rational(lmax - 1, lmax), Rational(lmax, lmax - 1));
+  ASSERT_LT(Rational(lmin), Rational(word, Integer(-lmax)));
+  ASSERT_EQ(Rational(7, 2).floor(), Integer(3));
+  ASSERT_EQ(Rational(-7, 2).floor(), Integer(-4));
+  ASSERT_EQ(Rational(-7, 2).ceiling(), Integer(-3));
+  ASSERT_EQ(Rational(-7, 2).toString(), "-7/2");
+  ASSERT_EQ(Rational(-3, 4).getDouble(), -0.75);
+}
 }  // namespace test
 }  // namespace cvc5::internal